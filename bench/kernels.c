@@ -0,0 +1,396 @@
+#include "raylib.h"
+#include <stdbool.h>
+#include <stdio.h>
+#include <stdlib.h>
+#include <string.h>
+#include <math.h>
+
+// Custom headers
+#include "typedefs.h"
+#include "config.h"
+#include "asteroids.h"
+#include "collisions.h"
+#include "enemies.h"
+#include "particles.h"
+#include "resources.h"
+#include "platform.h"
+#include "world.h"
+#include "random.h"
+#include "timerwheel.h"
+#include "lifecycle.h"
+
+// Microbenchmarks for the simulation kernels, run on synthetic game states:
+//   kernel_bench [results.json] [samples]
+// Each kernel is timed at a quarter, half and all of its pool. A summary goes to stdout
+// and per-entity timings to the JSON file (bench_results.json by default).
+
+#define BENCH_DEFAULT_SAMPLES 201
+#define BENCH_WARMUP_SAMPLES 20
+#define BENCH_MAX_SAMPLES 10000
+#define BENCH_COUNT_STEPS 3
+#define BENCH_SEED 1234u
+#define BENCH_DELTA_TIME (1.0f / SIM_TICK_RATE)
+
+typedef struct {
+    const char* name;
+    const char* unit;                            // What one counted entity is
+    int poolSize;                                // Largest count the kernel runs at
+    void (*prepare)(GameState* state, int count);
+    int (*run)(GameState* state, int count);     // Returns the entities processed
+} BenchKernel;
+
+typedef struct {
+    double median;
+    double p10;
+    double p90;
+    double mean;
+    double stddev;
+    double min;
+} BenchStats;
+
+static GameState benchState;
+static int splitTargets[MAX_ASTEROIDS];
+static volatile float benchSink;   // Keeps results of pure kernels alive
+
+static float randomRange(float low, float high) {
+    return low + (high - low) * (GetRandomValue(0, 10000) / 10000.0f);
+}
+
+// Empty every entity pool and park the ship in the middle of the map
+static void resetPools(GameState* state) {
+    memset(state->bullets, 0, sizeof(state->bullets));
+    memset(state->asteroids, 0, sizeof(state->asteroids));
+    memset(state->enemies, 0, sizeof(state->enemies));
+    memset(state->enemyBullets, 0, sizeof(state->enemyBullets));
+    memset(state->particles, 0, sizeof(state->particles));
+    memset(state->powerups, 0, sizeof(state->powerups));
+    resetWorld(state);
+    
+    state->ship.base = (GameObject){ MAP_WIDTH / 2.0f, MAP_HEIGHT / 2.0f, 0, 0, 0, 20.0f, true };
+    state->health = MAX_HEALTH;
+    state->lives = 3;
+    state->isInvulnerable = true;
+    state->screenState = GAME_STATE;
+    state->currentWave = 10;
+    resetTimerWheel(&state->timers, state->simTick);
+}
+
+// Asteroids of random size and velocity inside a square around the map centre
+static void placeAsteroids(GameState* state, int count, float spread) {
+    for (int i = 0; i < count; i++) {
+        Asteroid* asteroid = &state->asteroids[i];
+        asteroid->base.active = true;
+        asteroid->size = GetRandomValue(1, 3);
+        asteroid->base.radius = 20.0f * asteroid->size;
+        asteroid->base.x = MAP_WIDTH / 2.0f + randomRange(-spread, spread);
+        asteroid->base.y = MAP_HEIGHT / 2.0f + randomRange(-spread, spread);
+        asteroid->base.dx = randomRange(-2.0f, 2.0f);
+        asteroid->base.dy = randomRange(-2.0f, 2.0f);
+        asteroid->base.angle = (float)GetRandomValue(0, 359);
+    }
+}
+
+// Mark count randomly chosen particle slots live, so the pool is fragmented like in play
+static void placeParticles(GameState* state, int count) {
+    int placed = 0;
+    while (placed < count) {
+        Particle* particle = &state->particles[GetRandomValue(0, MAX_PARTICLES - 1)];
+        if (particle->active) continue;
+        
+        particle->active = true;
+        particle->life = randomRange(0.1f, PARTICLE_LIFETIME);
+        particle->position = (Vector2){ randomRange(0, MAP_WIDTH), randomRange(0, MAP_HEIGHT) };
+        particle->velocity = (Vector2){ randomRange(-3.0f, 3.0f), randomRange(-3.0f, 3.0f) };
+        particle->radius = 3.0f;
+        particle->color = (Color){ 255, 120, 0, 255 };
+        placed++;
+    }
+}
+
+// checkCollision: count bullets against every asteroid
+static void prepareCollisionPairs(GameState* state, int count) {
+    resetPools(state);
+    placeAsteroids(state, MAX_ASTEROIDS, 1500.0f);
+    for (int i = 0; i < count; i++) {
+        state->bullets[i] = (GameObject){ MAP_WIDTH / 2.0f + randomRange(-1500.0f, 1500.0f),
+                                          MAP_HEIGHT / 2.0f + randomRange(-1500.0f, 1500.0f), 0, 0, 0, 2.0f, true };
+    }
+}
+
+static int runCollisionPairs(GameState* state, int count) {
+    int hits = 0;
+    for (int i = 0; i < count; i++) {
+        for (int j = 0; j < MAX_ASTEROIDS; j++) {
+            hits += checkCollision(&state->bullets[i], &state->asteroids[j].base);
+        }
+    }
+    benchSink = (float)hits;
+    return count * MAX_ASTEROIDS;
+}
+
+// Asteroid-asteroid response: packed tightly enough that many pairs overlap
+static void prepareAsteroidResponse(GameState* state, int count) {
+    resetPools(state);
+    placeAsteroids(state, count, 40.0f * sqrtf((float)count));
+}
+
+static int runAsteroidResponse(GameState* state, int count) {
+    resolveAsteroidCollisions(state);
+    return count;
+}
+
+// calculateAsteroidAvoidance: every enemy slot scans count asteroids
+static void prepareAvoidance(GameState* state, int count) {
+    resetPools(state);
+    placeAsteroids(state, count, 800.0f);
+    for (int i = 0; i < MAX_ENEMIES; i++) {
+        Enemy* enemy = &state->enemies[i];
+        enemy->base = (GameObject){ MAP_WIDTH / 2.0f + randomRange(-800.0f, 800.0f),
+                                    MAP_HEIGHT / 2.0f + randomRange(-800.0f, 800.0f), 0, 0, 0, 25.0f, true };
+        enemy->type = ENEMY_SCOUT;
+    }
+}
+
+static int runAvoidance(GameState* state, int count) {
+    float total = 0.0f;
+    for (int i = 0; i < MAX_ENEMIES; i++) {
+        Vector2 avoid = calculateAsteroidAvoidance(state, &state->enemies[i]);
+        total += avoid.x + avoid.y;
+    }
+    benchSink = total;
+    return MAX_ENEMIES * count;
+}
+
+// updateScoutBehavior: count scouts close enough to each other to form groups
+static void prepareScoutGrouping(GameState* state, int count) {
+    resetPools(state);
+    for (int i = 0; i < count; i++) {
+        Enemy* enemy = &state->enemies[i];
+        enemy->base = (GameObject){ MAP_WIDTH / 2.0f + 900.0f + randomRange(-300.0f, 300.0f),
+                                    MAP_HEIGHT / 2.0f + randomRange(-300.0f, 300.0f),
+                                    randomRange(-2.0f, 2.0f), randomRange(-2.0f, 2.0f), 0, 25.0f, true };
+        enemy->type = ENEMY_SCOUT;
+        enemy->health = SCOUT_ENEMY_HEALTH;
+        enemy->fireReadyTick = state->simTick + (unsigned int)GetRandomValue(0, 2 * SIM_TICK_RATE);
+        enemy->moveAngle = (float)GetRandomValue(0, 359);
+        enemy->headingTick = state->simTick + (unsigned int)GetRandomValue(1, 3 * SIM_TICK_RATE);
+    }
+}
+
+static int runScoutGrouping(GameState* state, int count) {
+    Vector2 scoutPositions[MAX_ENEMIES];
+    int scoutIndices[MAX_ENEMIES];
+    int groupDesires[MAX_ENEMIES];
+    int activeScouts = collectScoutData(state, scoutPositions, scoutIndices, groupDesires);
+    
+    float shipX = state->ship.base.x;
+    float shipY = state->ship.base.y;
+    for (int s = 0; s < activeScouts; s++) {
+        int i = scoutIndices[s];
+        Enemy* enemy = &state->enemies[i];
+        float dx = shipX - enemy->base.x;
+        float dy = shipY - enemy->base.y;
+        float distance = sqrtf(dx * dx + dy * dy);
+        float angle = atan2f(dx, -dy) * 180.0f / PI;
+        updateScoutBehavior(state, enemy, i, distance, angle, (Vector2){ 0, 0 },
+                            scoutPositions, scoutIndices, groupDesires, activeScouts);
+    }
+    return count;
+}
+
+// updateParticles: count live particles spread over the pool
+static void prepareParticleUpdate(GameState* state, int count) {
+    resetPools(state);
+    placeParticles(state, count);
+}
+
+static int runParticleUpdate(GameState* state, int count) {
+    updateParticles(state, BENCH_DELTA_TIME);
+    return count;
+}
+
+// Slot search: emit into a pool that already holds count live particles
+static void prepareSlotSearch(GameState* state, int count) {
+    resetPools(state);
+    placeParticles(state, count);
+}
+
+static int runEmitParticles(GameState* state, int count) {
+    (void)count;
+    emitParticles(state, 8);
+    return 8;
+}
+
+static int runEnemyExplosion(GameState* state, int count) {
+    (void)count;
+    createEnemyExplosion(state, MAP_WIDTH / 2.0f, MAP_HEIGHT / 2.0f, ENEMY_EXPLOSION_PARTICLES);
+    return ENEMY_EXPLOSION_PARTICLES;
+}
+
+// splitAsteroid: count large asteroids scattered over the pool, leaving room for their halves
+static void prepareSplit(GameState* state, int count) {
+    resetPools(state);
+    int stride = MAX_ASTEROIDS / count;
+    for (int i = 0; i < count; i++) {
+        Asteroid* asteroid = &state->asteroids[i * stride];
+        asteroid->base = (GameObject){ randomRange(100.0f, MAP_WIDTH - 100.0f),
+                                       randomRange(100.0f, MAP_HEIGHT - 100.0f), 0, 0, 0, 60.0f, true };
+        asteroid->size = 3;
+        splitTargets[i] = i * stride;
+    }
+}
+
+static int runSplit(GameState* state, int count) {
+    for (int i = 0; i < count; i++) {
+        splitAsteroid(state, splitTargets[i], DESPAWN_DESTROYED);
+    }
+    return count;
+}
+
+// updateEnemyBullets: count enemy shots flying through a field of asteroids and enemies
+static void prepareEnemyBullets(GameState* state, int count) {
+    resetPools(state);
+    placeAsteroids(state, MAX_ASTEROIDS / 2, 1500.0f);
+    for (int i = 0; i < MAX_ENEMIES / 2; i++) {
+        state->enemies[i].base = (GameObject){ MAP_WIDTH / 2.0f + randomRange(-1500.0f, 1500.0f),
+                                               MAP_HEIGHT / 2.0f + randomRange(-1500.0f, 1500.0f), 0, 0, 0, 25.0f, true };
+        state->enemies[i].type = ENEMY_TANK;
+        state->enemies[i].health = TANK_ENEMY_HEALTH;
+    }
+    for (int i = 0; i < count; i++) {
+        Bullet* bullet = &state->enemyBullets[i];
+        float angle = randomRange(0.0f, 2.0f * PI);
+        bullet->base = (GameObject){ MAP_WIDTH / 2.0f + randomRange(-1500.0f, 1500.0f),
+                                     MAP_HEIGHT / 2.0f + randomRange(-1500.0f, 1500.0f),
+                                     cosf(angle) * 6.0f, sinf(angle) * 6.0f, 0, 4.0f, true };
+        bullet->type = BULLET_NORMAL;
+        bullet->damage = 10;
+        bullet->isPlayerBullet = (i % 4) == 0;
+    }
+}
+
+static int runEnemyBullets(GameState* state, int count) {
+    updateEnemyBullets(state);
+    return count;
+}
+
+static const BenchKernel kernels[] = {
+    { "checkCollision", "pair", MAX_BULLETS, prepareCollisionPairs, runCollisionPairs },
+    { "resolveAsteroidCollisions", "asteroid", MAX_ASTEROIDS, prepareAsteroidResponse, runAsteroidResponse },
+    { "calculateAsteroidAvoidance", "enemy-asteroid pair", MAX_ASTEROIDS, prepareAvoidance, runAvoidance },
+    { "updateScoutBehavior", "scout", MAX_ENEMIES, prepareScoutGrouping, runScoutGrouping },
+    { "updateParticles", "particle", MAX_PARTICLES, prepareParticleUpdate, runParticleUpdate },
+    { "emitParticles", "particle emitted", MAX_PARTICLES, prepareSlotSearch, runEmitParticles },
+    { "createEnemyExplosion", "particle emitted", MAX_PARTICLES, prepareSlotSearch, runEnemyExplosion },
+    { "splitAsteroid", "asteroid", MAX_ASTEROIDS / 3, prepareSplit, runSplit },
+    { "updateEnemyBullets", "bullet", MAX_ENEMY_BULLETS, prepareEnemyBullets, runEnemyBullets }
+};
+
+#define KERNEL_COUNT ((int)(sizeof(kernels) / sizeof(kernels[0])))
+
+static int compareDoubles(const void* a, const void* b) {
+    double x = *(const double*)a;
+    double y = *(const double*)b;
+    return (x > y) - (x < y);
+}
+
+static double percentile(const double* sorted, int count, double fraction) {
+    int index = (int)(fraction * (count - 1) + 0.5);
+    return sorted[index];
+}
+
+// Every sample starts from a freshly prepared state; only run() is timed
+static BenchStats measureKernel(const BenchKernel* kernel, int count, int samples, double* times) {
+    SetRandomSeed(BENCH_SEED);
+    seedGameRandom(&benchState, BENCH_SEED);
+    
+    for (int s = -BENCH_WARMUP_SAMPLES; s < samples; s++) {
+        kernel->prepare(&benchState, count);
+        recountEntities(&benchState);
+        double start = getMonotonicTime();
+        int entities = kernel->run(&benchState, count);
+        double elapsed = getMonotonicTime() - start;
+        
+        if (s >= 0) {
+            times[s] = elapsed * 1e9 / (entities > 0 ? entities : 1);
+        }
+    }
+    
+    BenchStats stats = {0};
+    double sum = 0.0;
+    for (int s = 0; s < samples; s++) sum += times[s];
+    stats.mean = sum / samples;
+    
+    double variance = 0.0;
+    for (int s = 0; s < samples; s++) variance += (times[s] - stats.mean) * (times[s] - stats.mean);
+    stats.stddev = samples > 1 ? sqrt(variance / (samples - 1)) : 0.0;
+    
+    qsort(times, samples, sizeof(double), compareDoubles);
+    stats.min = times[0];
+    stats.p10 = percentile(times, samples, 0.10);
+    stats.median = percentile(times, samples, 0.50);
+    stats.p90 = percentile(times, samples, 0.90);
+    return stats;
+}
+
+int main(int argc, char* argv[]) {
+    const char* jsonPath = argc > 1 ? argv[1] : "bench_results.json";
+    int samples = argc > 2 ? atoi(argv[2]) : BENCH_DEFAULT_SAMPLES;
+    if (samples < 1 || samples > BENCH_MAX_SAMPLES) {
+        fprintf(stderr, "Usage: %s [results.json] [samples 1-%d]\n", argv[0], BENCH_MAX_SAMPLES);
+        return 1;
+    }
+    
+    // Powerup spawns look their textures up in the cache, so load them as the game does
+    SetTraceLogLevel(LOG_WARNING);
+    SetConfigFlags(FLAG_WINDOW_HIDDEN);
+    InitWindow(320, 240, "Asteroids kernel benchmarks");
+    markMainThread();
+    initResources(&benchState);
+    loadAllTextures(&benchState);
+    
+    FILE* json = fopen(jsonPath, "w");
+    if (json == NULL) {
+        fprintf(stderr, "Error: Could not create %s\n", jsonPath);
+        CloseWindow();
+        return 1;
+    }
+    
+    double* times = (double*)malloc(sizeof(double) * samples);
+    if (times == NULL) {
+        fprintf(stderr, "Error: Failed to allocate sample buffer\n");
+        fclose(json);
+        CloseWindow();
+        return 1;
+    }
+    
+    fprintf(json, "{\n  \"samples\": %d,\n  \"warmup\": %d,\n  \"seed\": %u,\n  \"results\": [", samples,
+            BENCH_WARMUP_SAMPLES, BENCH_SEED);
+    printf("%-28s %8s %10s %10s %10s %10s  %s\n", "kernel", "count", "median", "p10", "p90", "stddev", "ns per");
+    
+    bool first = true;
+    for (int k = 0; k < KERNEL_COUNT; k++) {
+        const BenchKernel* kernel = &kernels[k];
+        for (int step = 1; step <= BENCH_COUNT_STEPS; step++) {
+            int count = kernel->poolSize >> (BENCH_COUNT_STEPS - step);
+            if (count < 1) count = 1;
+            
+            BenchStats stats = measureKernel(kernel, count, samples, times);
+            printf("%-28s %8d %10.2f %10.2f %10.2f %10.2f  %s\n", kernel->name, count, stats.median, stats.p10,
+                   stats.p90, stats.stddev, kernel->unit);
+            fprintf(json, "%s\n    {\"kernel\": \"%s\", \"unit\": \"%s\", \"count\": %d, \"median_ns\": %.3f, "
+                    "\"p10_ns\": %.3f, \"p90_ns\": %.3f, \"mean_ns\": %.3f, \"stddev_ns\": %.3f, \"min_ns\": %.3f}",
+                    first ? "" : ",", kernel->name, kernel->unit, count, stats.median, stats.p10, stats.p90,
+                    stats.mean, stats.stddev, stats.min);
+            first = false;
+        }
+    }
+    fprintf(json, "\n  ]\n}\n");
+    fclose(json);
+    free(times);
+    
+    unloadAllTextures(&benchState);
+    CloseWindow();
+    printf("Wrote %s\n", jsonPath);
+    return 0;
+}
\ No newline at end of file
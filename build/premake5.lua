@@ -14,6 +14,25 @@ newoption
 	default = "opengl33"
 }
 
+newoption
+{
+	trigger = "perf-counters",
+	description = "attribute hardware performance counters to subsystem scopes (Linux only)"
+}
+
+newoption
+{
+	trigger = "stress-pools",
+	description = "enlarge the entity pools so stress scenarios can go past normal gameplay limits"
+}
+
+function stress_pool_defines()
+    filter {"options:stress-pools"}
+        defines {"MAX_ASTEROIDS=400", "MAX_ENEMIES=200", "MAX_ENEMY_BULLETS=1000", "MAX_PARTICLES=5000", "MAX_POWERUPS=500"}
+
+    filter{}
+end
+
 function download_progress(total, current)
     local ratio = current / total;
     ratio = math.min(math.max(ratio, 0), 1);
@@ -175,6 +194,7 @@ if (downloadRaylib) then
         includedirs { raylib_dir .."/src/external/glfw/include" }
         flags { "ShadowedVariables"}
         platform_defines()
+        stress_pool_defines()
 
         filter "action:vs*"
             defines{"_WINSOCK_DEPRECATED_NO_WARNINGS", "_CRT_SECURE_NO_WARNINGS"}
@@ -191,12 +211,76 @@ if (downloadRaylib) then
         filter "system:linux"
             links {"pthread", "m", "dl", "rt", "X11"}
 
+        filter {"system:linux", "options:perf-counters"}
+            defines {"ASTEROIDS_PERF_COUNTERS"}
+
         filter "system:macosx"
             links {"OpenGL.framework", "Cocoa.framework", "IOKit.framework", "CoreFoundation.framework", "CoreAudio.framework", "CoreVideo.framework", "AudioToolbox.framework"}
 
         filter{}
 		
 
+    project "kernel_bench"
+        kind "ConsoleApp"
+        location "build_files/"
+        targetdir "../bin/%{cfg.buildcfg}"
+
+        language "C"
+        cdialect "C17"
+
+        -- The game's own sources, minus its entry point, driven by the benchmark's main
+        files {"../bench/**.c", "../src/**.c", "../include/**.h"}
+        removefiles {"../src/main.c"}
+        includedirs { "../include" }
+        defines { "BENCHMARK" }
+
+        links {"raylib"}
+
+        includedirs {raylib_dir .. "/src" }
+        includedirs {raylib_dir .."/src/external" }
+        includedirs { raylib_dir .."/src/external/glfw/include" }
+        platform_defines()
+        stress_pool_defines()
+
+        filter "action:vs*"
+            defines{"_WINSOCK_DEPRECATED_NO_WARNINGS", "_CRT_SECURE_NO_WARNINGS"}
+            dependson {"raylib"}
+            links {"raylib.lib"}
+            characterset ("Unicode")
+
+        filter "system:windows"
+            defines{"_WIN32"}
+            links {"winmm", "gdi32", "opengl32"}
+            libdirs {"../bin/%{cfg.buildcfg}"}
+
+        filter "system:linux"
+            links {"pthread", "m", "dl", "rt", "X11"}
+
+        filter "system:macosx"
+            links {"OpenGL.framework", "Cocoa.framework", "IOKit.framework", "CoreFoundation.framework", "CoreAudio.framework", "CoreVideo.framework", "AudioToolbox.framework"}
+
+        filter{}
+
+
+    project "telemetry_summary"
+        kind "ConsoleApp"
+        location "build_files/"
+        targetdir "../bin/%{cfg.buildcfg}"
+
+        language "C"
+        cdialect "C17"
+
+        files {"../tools/telemetry_summary.c"}
+        includedirs { "../include" }
+
+        -- Only raylib's type declarations are needed, nothing is linked
+        includedirs {raylib_dir .. "/src" }
+
+        filter "action:vs*"
+            defines{"_CRT_SECURE_NO_WARNINGS"}
+        filter{}
+
+
     project "raylib"
         kind "StaticLib"
     
@@ -214,6 +298,13 @@ if (downloadRaylib) then
         filter{}
 
         includedirs {raylib_dir .. "/src", raylib_dir .. "/src/external/glfw/include" }
+
+        -- Route raylib's allocations through the game's allocation tracker (src/memtrack.c).
+        -- Force-included by path rather than adding ../include, whose config.h would shadow raylib's.
+        forceincludes { "../include/memtrack.h" }
+        defines { "RL_MALLOC(sz)=trackedMalloc(sz)", "RL_CALLOC(n,sz)=trackedCalloc(n,sz)",
+                  "RL_REALLOC(ptr,sz)=trackedRealloc(ptr,sz)", "RL_FREE(ptr)=trackedFree(ptr)" }
+
         vpaths
         {
             ["Header Files"] = { raylib_dir .. "/src/**.h"},
@@ -0,0 +1,14 @@
+#ifndef ASTEROIDMESH_H
+#define ASTEROIDMESH_H
+
+// Custom headers
+#include "typedefs.h"
+
+int acquireAsteroidMesh(int sizeClass, unsigned int seed);
+void generateAsteroidMeshes(void);
+int getMenuAsteroidSizeClass(float radius);
+void beginAsteroidBatch(int maxOutlines);
+void batchAsteroidOutline(int meshId, float x, float y, float radius, Vector2 rotation, Color color);
+void endAsteroidBatch(void);
+
+#endif // ASTEROIDMESH_H
\ No newline at end of file
@@ -5,6 +5,8 @@
 #include "typedefs.h"
 
 void createAsteroids(GameState* state, int count);
-void splitAsteroid(GameState* state, int index);
+void createAsteroidsOfSize(GameState* state, int count, int size);
+void splitAsteroid(GameState* state, int index, DespawnCause cause);
+void resolveAsteroidCollisions(GameState* state);
 
 #endif // ASTEROIDS_H
\ No newline at end of file
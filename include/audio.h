@@ -10,5 +10,8 @@ void updateSoundVolume(GameState* state, float volume);
 void updateMusicVolume(GameState* state, float volume);
 void switchMusic(GameState* state, Music* newMusic);
 void unloadMusic(GameState* state);
+void playGameSound(const GameState* state, int sound);
+void playGameSoundScaled(const GameState* state, int sound, float volumeScale);
+void playQueuedSounds(GameState* state);
 
 #endif // AUDIO_H
\ No newline at end of file
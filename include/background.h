@@ -0,0 +1,12 @@
+#ifndef BACKGROUND_H
+#define BACKGROUND_H
+
+// Custom headers
+#include "typedefs.h"
+
+void initBackground(void);
+void renderBackground(Camera2D camera, float worldWidth, float worldHeight);
+void setBackgroundParallax(bool enabled);
+void unloadBackground(void);
+
+#endif // BACKGROUND_H
\ No newline at end of file
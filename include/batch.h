@@ -0,0 +1,29 @@
+#ifndef BATCH_H
+#define BATCH_H
+
+#include <stdbool.h>
+
+// Custom headers
+#include "typedefs.h"
+
+// Headless game instances: no window, textures or sound, each with its own seed.
+// Any number can live in one process and be stepped side by side across cores.
+
+// Fills in one tick of input for an instance
+typedef void (*BatchPilot)(const GameState* state, InputFrame* input);
+
+// Start a fresh game in state, ready to step
+void initGameInstance(GameState* state, unsigned int seed, WorldSize world);
+
+// Worker threads for stepGameBatch; the calling thread counts as one of them
+bool initBatchWorkers(int threads);
+void shutdownBatchWorkers(void);
+
+// Advance every running instance one tick in parallel. With a pilot, inputs are filled in
+// by it first; otherwise inputs[i] is used as given.
+void stepGameBatch(GameState* instances, InputFrame* inputs, int count, BatchPilot pilot);
+
+// Play options->count bot games and report throughput and the waves they reached
+int runBatch(const BatchOptions* options);
+
+#endif // BATCH_H
\ No newline at end of file
@@ -0,0 +1,10 @@
+#ifndef BOT_H
+#define BOT_H
+
+// Custom headers
+#include "typedefs.h"
+
+// Fill in one tick of input for a scripted pilot flying the given game
+void updateBotInput(const GameState* state, InputFrame* input);
+
+#endif // BOT_H
\ No newline at end of file
@@ -0,0 +1,15 @@
+#ifndef CMDLINE_H
+#define CMDLINE_H
+
+#include <stdbool.h>
+
+// Custom headers
+#include "typedefs.h"
+
+// Options for headless trace runs, stress scenarios and the world size; with none the game starts normally.
+// Prints usage and returns false on anything it doesn't understand.
+bool parseLaunchOptions(int argc, char* argv[], LaunchOptions* options);
+const char* getScenarioName(ScenarioType type);
+const char* getAsteroidSizeName(int size);
+
+#endif // CMDLINE_H
\ No newline at end of file
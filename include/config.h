@@ -10,7 +10,69 @@
 // HIGH SCORE SETTINGS
 // =============================================================================
 #define MAX_HIGH_SCORES 10
-#define SCORE_FILE_PATH "highscores.txt"
+#define SCORE_FILE_PATH "highscores.dat"
+#define SCORE_TEMP_FILE_PATH "highscores.dat.tmp"  // Written first, then renamed over SCORE_FILE_PATH
+#define SCORE_LEGACY_FILE_PATH "highscores.txt"    // Old text format, imported when no binary file exists
+#define SCORE_FILE_MAGIC 0x53484153u               // "SAHS" read as little-endian bytes
+#define SCORE_FILE_VERSION 1
+#define SCOREBOARD_WIDTH 350
+#define SCOREBOARD_HEIGHT 360
+
+// =============================================================================
+// TELEMETRY SETTINGS
+// =============================================================================
+#define TELEMETRY_FILE_PREFIX "telemetry_"     // Followed by the run's start time and ".bin"
+#define TELEMETRY_FILE_MAGIC 0x4C545341u       // "ASTL" read as little-endian bytes
+#define TELEMETRY_FILE_VERSION 1
+#define TELEMETRY_RING_CAPACITY 4096           // Events buffered between flushes, must be a power of two
+#define TELEMETRY_FLUSH_INTERVAL 0.5           // Seconds between background writes
+#define TELEMETRY_FRAME_BUCKETS 16             // Frame-time histogram buckets; the last one is open-ended
+#define TELEMETRY_FRAME_BUCKET_WIDTH 0.002f    // Seconds of frame time covered by each bucket
+#define TELEMETRY_HISTOGRAM_INTERVAL 1.0f      // Seconds of gameplay folded into each histogram sample
+
+// =============================================================================
+// PROFILER SETTINGS
+// =============================================================================
+#define MAX_SUBSYSTEM_DEPTH 8             // Nested subsystem scopes tracked per thread
+#define ALLOCATION_WARMUP_TICKS 120       // Gameplay ticks allowed to allocate before steady state is enforced
+
+// =============================================================================
+// TRACE SETTINGS
+// =============================================================================
+#define TRACE_FILE_MAGIC 0x43525441u      // "ATRC" read as a little-endian integer
+#define TRACE_FILE_VERSION 6              // 6: each part also records an exact hash of its integer fields
+#define TRACE_DEFAULT_SEED 1u
+#define TRACE_DEFAULT_WAVES 3
+#define TRACE_MAX_TICKS (SIM_TICK_RATE * 60 * 30)  // Recording stops after 30 simulated minutes
+
+// =============================================================================
+// STRESS SCENARIO SETTINGS
+// =============================================================================
+#define SCENARIO_DEFAULT_FRAMES 1800      // Measured frames per run (30 seconds at 60 fps)
+#define SCENARIO_WARMUP_FRAMES 120        // Frames run before measuring starts
+#define SCENARIO_DEFAULT_SEED 1u
+#define SCENARIO_GROUP_SIZE 6             // Scouts per tight group
+#define SCENARIO_GROUP_SPREAD 50.0f       // Radius scouts of one group spawn within
+#define SCENARIO_MIN_DISTANCE 300.0f      // Closest a scenario spawns anything to the ship
+#define SCENARIO_MAX_DISTANCE 700.0f      // Farthest; keeps enemies inside ENEMY_DETECTION_RADIUS
+
+// =============================================================================
+// BATCH SIMULATION SETTINGS
+// =============================================================================
+#define BATCH_DEFAULT_TICKS (SIM_TICK_RATE * 60 * 10)  // Ten simulated minutes per game
+#define BATCH_DEFAULT_SEED 1u             // Instance i plays with seed + i
+#define BATCH_MAX_THREADS 64
+#define BATCH_CLAIM_SIZE 4                // Instances a worker steps per claim
+#define BATCH_WAVE_BUCKETS 16             // Waves reported individually; later ones share the last row
+
+// =============================================================================
+// FLIGHT RECORDER SETTINGS
+// =============================================================================
+#define FLIGHT_RECORDER_FRAMES 300        // Frames kept in the rolling window (5 seconds at 60 fps)
+#define FLIGHT_RECORDER_POST_FRAMES 60    // Frames still recorded after a hitch before the window is dumped
+#define HITCH_BUDGET_FACTOR 2.0f          // Gameplay frames longer than this many target frame times are hitches
+#define MAX_HITCH_DUMPS 20                // Dumps written per session at most
+#define HITCH_FILE_PREFIX "hitch_"        // Followed by the session start time, the frame number and ".csv"
 
 // =============================================================================
 // WINDOW & MAP SETTINGS
@@ -20,6 +82,89 @@
 #define MAP_WIDTH 2500
 #define MAP_HEIGHT 1000
 #define BOUNDARY_COLOR (Color){ 30, 30, 80, 255 }  // Dark blue boundary
+#define SPACE_COLOR (Color){ 5, 5, 15, 255 }        // Background colour of space
+#define GRID_COLOR (Color){ 20, 20, 40, 100 }       // Map grid lines
+#define GRID_SPACING 200
+#define MIN_WINDOW_WIDTH 640
+#define MIN_WINDOW_HEIGHT 360
+#define DEFAULT_RENDER_SCALE 1.0f      // Internal resolution as a fraction of the window
+#define MIN_RENDER_SCALE 0.5f
+
+// =============================================================================
+// LARGE WORLD SETTINGS
+// =============================================================================
+#define LARGE_WORLD_WIDTH (MAP_WIDTH * 5)         // Together 20x the area of the normal map
+#define LARGE_WORLD_HEIGHT (MAP_HEIGHT * 4)
+#define SECTOR_SIZE 800                           // Square sectors, as wide as the enemy detection radius
+#define SECTOR_MAX_COLUMNS ((LARGE_WORLD_WIDTH + SECTOR_SIZE - 1) / SECTOR_SIZE)
+#define SECTOR_MAX_ROWS ((LARGE_WORLD_HEIGHT + SECTOR_SIZE - 1) / SECTOR_SIZE)
+#define SECTOR_MAX_COUNT (SECTOR_MAX_COLUMNS * SECTOR_MAX_ROWS)
+#define SECTOR_ACTIVE_RANGE 1                     // Sectors this many steps from the ship's run full simulation
+#define SECTOR_RELEASE_RANGE 2                    // Active sectors go dormant again beyond this many steps
+#define SECTOR_DORMANT_INTERVAL 30                // Ticks between coarse updates of each dormant sector
+#define SECTOR_MAX_ASTEROIDS 16                   // Asteroids a dormant sector holds; more stay active
+#define SECTOR_MAX_ENEMIES 8                      // Enemies a dormant sector holds; more stay active
+#define SECTOR_GENERATED_ASTEROIDS 4              // A new sector gets 1 to this many asteroids
+#define SECTOR_GENERATED_ENEMIES 2                // ...and up to this many enemies once enemy waves begin
+#define SECTOR_SPAWN_CLEARANCE 300.0f             // Woken entities wait until they are at least this far from the ship
+
+// =============================================================================
+// BACKGROUND SETTINGS
+// =============================================================================
+#define BACKGROUND_TILE_SIZE 512          // Size of each pre-rendered background chunk
+#define BACKGROUND_STARS_PER_TILE 70      // Stars baked into each map tile
+#define BACKGROUND_PARALLAX_LAYERS 2      // Number of distant star layers
+#define BACKGROUND_PARALLAX_STARS 45      // Stars in each parallax layer texture
+#define BACKGROUND_SEED 1337              // Seed for the procedural starfield
+
+// =============================================================================
+// RENDER COMMAND SETTINGS
+// =============================================================================
+#define RENDER_COMMAND_CAPACITY 4096      // World draw commands buffered per frame
+
+// =============================================================================
+// FRAME PACING SETTINGS
+// =============================================================================
+#define GAME_FRAME_RATE 60                // Gameplay always redraws at full rate
+#define MENU_FRAME_RATE 30                // Animated main menu
+#define IDLE_POLL_RATE 20                 // Input/music polling on static screens
+#define UNFOCUSED_POLL_RATE 15            // Background polling, still fast enough to feed music
+#define IDLE_HEARTBEAT 1.0f               // Seconds between forced redraws of a static screen
+#define MAX_FRAME_DELTA 0.1f              // Clamp for frame time after an idle stretch
+
+// =============================================================================
+// SIMULATION THREAD SETTINGS
+// =============================================================================
+#define SIM_TICK_RATE 60                  // Fixed simulation steps per second (movement is per tick)
+#define SIM_MAX_CATCHUP_TICKS 5           // Ticks run back to back before the schedule is reset
+#define INPUT_QUEUE_CAPACITY 64           // Sampled input frames waiting for the simulation
+#define SOUND_QUEUE_CAPACITY 64           // Sounds waiting to be played on the main thread
+#define INTERPOLATION_SNAP_DISTANCE 64.0f // Moves longer than this in one tick are drawn without blending
+#define TEXTURE_CACHE_SIZE 16             // Distinct texture files shared between spawned entities
+
+// =============================================================================
+// TIMER WHEEL SETTINGS
+// =============================================================================
+// Each enemy, bomb and powerup holds one live event; superseded ones wait until their deadline,
+// so four per pooled object plus the game-wide events keeps stress-pool builds in range too
+#define MAX_GAME_TIMERS (4 * (MAX_ENEMIES + MAX_ENEMY_BULLETS + MAX_POWERUPS) + 64)
+#define TIMER_WHEEL_BITS 6
+#define TIMER_WHEEL_SLOTS (1 << TIMER_WHEEL_BITS)
+#define TIMER_WHEEL_LEVELS 3              // Reaches 64^3 ticks (73 minutes); later deadlines wait at the top
+
+// =============================================================================
+// ENTITY LIFECYCLE SETTINGS
+// =============================================================================
+#define MAX_ENTITY_LISTENERS 4            // Spawn or despawn subscribers each, like telemetry and sound
+
+// =============================================================================
+// QUALITY GOVERNOR SETTINGS
+// =============================================================================
+#define GOVERNOR_SAMPLE_COUNT 60          // Frames in the rolling average
+#define GOVERNOR_DEGRADE_RATIO 1.15f      // Drop quality when frames take this much of the budget
+#define GOVERNOR_BUSY_RATIO 0.85f         // ...but only while frame work itself takes this much
+#define GOVERNOR_RESTORE_RATIO 0.5f       // Raise quality when frame work fits in this much
+#define GOVERNOR_HOLD_TIME 2.0f           // Seconds to wait after a change before the next one
 
 // =============================================================================
 // PLAYER SHIP SETTINGS
@@ -35,7 +180,10 @@
 // =============================================================================
 // PLAYER WEAPONS & AMMUNITION
 // =============================================================================
+// Entity pool sizes can be raised from the build for stress scenarios (premake5 --stress-pools)
+#ifndef MAX_BULLETS
 #define MAX_BULLETS 30
+#endif
 #define BULLET_SPEED 10.0f
 
 // =============================================================================
@@ -50,6 +198,7 @@
 #define GRENADE_FIRE_RATE 1.5f         // 1.5 second cooldown between grenade shots
 #define RELOAD_TIME 5.0f
 #define FIRE_RATE 0.35f  // Time between shots in seconds for normal weapon
+#define WEAPON_COOLDOWN_SCALE 0.5f     // Cooldowns were once counted down twice a tick; keeps the rates players know
 
 // Player Grenade Settings
 #define PLAYER_GRENADE_TIMER 1.0f      // Time before player grenade explodes
@@ -60,29 +209,49 @@
 // =============================================================================
 // ASTEROIDS
 // =============================================================================
+#ifndef MAX_ASTEROIDS
 #define MAX_ASTEROIDS 50
+#endif
 #define BASE_ASTEROID_COUNT 10
 #define ASTEROID_INCREMENT 2
 #define LARGE_ASTEROID_DAMAGE 40
 #define MEDIUM_ASTEROID_DAMAGE 20
 #define SMALL_ASTEROID_DAMAGE 10
+#define ASTEROID_SIZE_CLASSES 3             // Small, medium and large
+#define ASTEROID_MESH_VARIANTS 8            // Distinct outlines cached per size class
+#define ASTEROID_MESH_MAX_VERTICES 16
+#define ASTEROID_MESH_JAGGEDNESS 0.3f       // How far vertices may dip inside the hitbox radius
+#define ASTEROID_MESH_SEED 4242
 
 // =============================================================================
 // PARTICLE EFFECTS
 // =============================================================================
+#ifndef MAX_PARTICLES
 #define MAX_PARTICLES 500
+#endif
 #define PARTICLE_LIFETIME 1.0f
 #define PARTICLE_SPEED 2.0f
+#define ENEMY_EXPLOSION_PARTICLES 20
+#define GRENADE_EXPLOSION_PARTICLES 15
 
 // =============================================================================
 // ENEMY SETTINGS
 // =============================================================================
+#ifndef MAX_ENEMIES
 #define MAX_ENEMIES 20
+#endif
+#ifndef MAX_ENEMY_BULLETS
 #define MAX_ENEMY_BULLETS 100
+#endif
 #define ENEMY_BULLET_SPEED 6.0f
 #define ENEMY_DETECTION_RADIUS 800.0f // Change this to adjust how far enemies can detect the player
 #define ENEMY_SPAWN_TIME 10.0f
 
+// AI level of detail: enemies that can't see the player only re-decide where to wander every few ticks
+#define AI_LOD_FAR_INTERVAL 4              // Ticks between decisions outside ENEMY_DETECTION_RADIUS
+#define AI_LOD_DISTANT_RADIUS 1600.0f      // Beyond this from the ship enemies decide even less often
+#define AI_LOD_DISTANT_INTERVAL 8
+
 // Tank Enemy
 #define TANK_ENEMY_RADIUS 30.0f // This changes the size of the tank enemy
 #define TANK_ENEMY_SPEED 1.2f
@@ -117,6 +286,15 @@
 #define SCOUT_SEPARATION_RADIUS 40.0f   // Minimum distance between scouts in a group
 #define SCOUT_SEPARATION_FORCE 0.8f     // Strength of separation force to prevent clipping
 
+// Enemy Navigation (flow field toward the ship over a coarse grid)
+#define FLOW_FIELD_CELL_SIZE 50                 // Map units per grid cell
+#define FLOW_FIELD_COLUMNS ((MAP_WIDTH + FLOW_FIELD_CELL_SIZE - 1) / FLOW_FIELD_CELL_SIZE)
+#define FLOW_FIELD_ROWS ((MAP_HEIGHT + FLOW_FIELD_CELL_SIZE - 1) / FLOW_FIELD_CELL_SIZE)
+#define FLOW_FIELD_CELLS (FLOW_FIELD_COLUMNS * FLOW_FIELD_ROWS)
+#define FLOW_FIELD_INTERVAL 6                   // Ticks between rebuilds while the ship stays in one cell
+#define FLOW_FIELD_ASTEROID_COST 12             // Cost multiplier for stepping into a cell an asteroid covers
+#define FLOW_FIELD_CLEARANCE 30.0f              // Margin kept around asteroids, about a tank's radius
+
 // =============================================================================
 // WAVE SYSTEM
 // =============================================================================
@@ -195,7 +373,9 @@
 // =============================================================================
 // POWERUP SETTINGS
 // =============================================================================
+#ifndef MAX_POWERUPS
 #define MAX_POWERUPS 50
+#endif
 #define HEALTH_POWERUP_HEAL_AMOUNT 20
 #define HEALTH_POWERUP_DROP_CHANCE 10   // 10% chance
 #define LIFE_POWERUP_DROP_CHANCE 2      // 2% chance for life drop
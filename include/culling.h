@@ -0,0 +1,15 @@
+#ifndef CULLING_H
+#define CULLING_H
+
+// Custom headers
+#include "typedefs.h"
+
+Rectangle getCameraView(Camera2D camera);
+bool isCircleInView(Rectangle view, float x, float y, float radius);
+bool isSegmentInView(Rectangle view, Vector2 start, Vector2 end);
+bool cullCircle(Rectangle view, CullCategory category, float x, float y, float radius);
+bool cullSegment(Rectangle view, CullCategory category, Vector2 start, Vector2 end);
+void resetCullStats(void);
+CullStats getCullStats(void);
+
+#endif // CULLING_H
\ No newline at end of file
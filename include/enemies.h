@@ -5,9 +5,22 @@
 #include "typedefs.h"
 
 void spawnEnemy(GameState* state, EnemyType type);
-void updateEnemies(GameState* state, float deltaTime);
+bool spawnEnemyAt(GameState* state, EnemyType type, float x, float y);
+void updateEnemies(GameState* state);
 void fireEnemyWeapon(GameState* state, Enemy* enemy);
 void explodeGrenade(GameState* state, int grenadeIndex);
 float getEnemyTextureScale(EnemyType type);
 
+// Timer wheel events
+void spawnWaveEnemy(GameState* state, unsigned int deadline);
+void burnGrenadeFuse(GameState* state, int grenadeIndex, unsigned int deadline);
+void changeEnemyHeading(GameState* state, int i, unsigned int deadline);
+
+// Per-pass kernels of updateEnemies, also driven directly by the benchmark suite
+Vector2 calculateAsteroidAvoidance(GameState* state, Enemy* enemy);
+int collectScoutData(GameState* state, Vector2* scoutPositions, int* scoutIndices, int* groupDesires);
+void updateScoutBehavior(GameState* state, Enemy* enemy, int enemyIndex, float distanceToPlayer, float angleToPlayer, Vector2 avoidVector, Vector2* scoutPositions, int* scoutIndices, int* groupDesires, int activeScouts);
+void updateEnemyBullets(GameState* state);
+void createEnemyExplosion(GameState* state, float x, float y, int particleCount);
+
 #endif // ENEMIES_H
\ No newline at end of file
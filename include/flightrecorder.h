@@ -0,0 +1,19 @@
+#ifndef FLIGHTRECORDER_H
+#define FLIGHTRECORDER_H
+
+// Custom headers
+#include "typedefs.h"
+
+// Rolling record of the last few seconds of frames. When a gameplay frame blows its
+// budget, the frames around it are written to a CSV file on the I/O thread.
+// Main thread only.
+
+void initFlightRecorder(void);
+const FlightFrame* endFlightFrame(GameScreenState screenState, const RenderSnapshot* snapshot);
+void shutdownFlightRecorder(void);
+
+// Events counted into the current frame
+void noteAssetLoad(void);
+void noteSoundPlayed(void);
+
+#endif // FLIGHTRECORDER_H
\ No newline at end of file
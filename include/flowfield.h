@@ -0,0 +1,10 @@
+#ifndef FLOWFIELD_H
+#define FLOWFIELD_H
+
+// Custom headers
+#include "typedefs.h"
+
+void updateFlowField(GameState* state);
+Vector2 getFlowDirection(const FlowField* field, float x, float y);
+
+#endif // FLOWFIELD_H
\ No newline at end of file
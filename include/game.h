@@ -5,5 +5,6 @@
 #include "typedefs.h"
 
 void updateGame(GameState* state, float deltaTime);
+void beginWaveTransition(GameState* state);
 
 #endif // GAME_H
\ No newline at end of file
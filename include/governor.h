@@ -0,0 +1,16 @@
+#ifndef GOVERNOR_H
+#define GOVERNOR_H
+
+// Custom headers
+#include "typedefs.h"
+
+void beginGovernorFrame(void);
+void markGovernorWorkDone(void);
+void updateGovernor(float frameTime);
+void lockQualityLevel(QualityLevel level);
+int scaleParticleCount(int count);
+bool governorAllowsDetail(void);
+GovernorStats getGovernorStats(void);
+const char* getQualityName(QualityLevel level);
+
+#endif // GOVERNOR_H
\ No newline at end of file
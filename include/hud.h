@@ -0,0 +1,15 @@
+#ifndef HUD_H
+#define HUD_H
+
+// Custom headers
+#include "typedefs.h"
+
+void initHud(void);
+void invalidateHud(void);
+void updateHud(const RenderSnapshot* state);
+void drawHud(const RenderSnapshot* state);
+HudStats getHudStats(void);
+void resetHudStats(void);
+void unloadHud(void);
+
+#endif // HUD_H
\ No newline at end of file
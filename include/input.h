@@ -9,7 +9,8 @@ void handlePauseInput(GameState* state);
 void handleOptionsInput(GameState* state);
 void handleGameOverInput(GameState* state);
 void handleInfoInput(GameState* state);
-void handleInput(GameState* state);
+void sampleGameInput(InputFrame* frame);
+void handleInput(GameState* state, const InputFrame* input);
 void updateMenuAsteroids(GameState* state, float deltaTime);
 
 #endif // INPUT_H
\ No newline at end of file
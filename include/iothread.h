@@ -0,0 +1,13 @@
+#ifndef IOTHREAD_H
+#define IOTHREAD_H
+
+// Background thread for file work, so the game loop never waits on the disk
+
+typedef void (*IoJobFunc)(void* data);
+
+void initIoThread(void);
+void queueIoJob(IoJobFunc run, IoJobFunc complete, void* data);
+void processIoCompletions(void);
+void shutdownIoThread(void);
+
+#endif // IOTHREAD_H
\ No newline at end of file
@@ -0,0 +1,12 @@
+#ifndef LAYERS_H
+#define LAYERS_H
+
+// Custom headers
+#include "typedefs.h"
+
+void beginCachedLayer(RenderTexture2D layer);
+void endCachedLayer(void);
+void drawCachedLayer(RenderTexture2D layer, Vector2 position, unsigned char alpha);
+bool windowSizeChanged(int* width, int* height);
+
+#endif // LAYERS_H
\ No newline at end of file
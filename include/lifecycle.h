@@ -0,0 +1,37 @@
+#ifndef LIFECYCLE_H
+#define LIFECYCLE_H
+
+#include <stdbool.h>
+
+// Custom headers
+#include "typedefs.h"
+
+// Spawn and despawn events for asteroid, enemy, projectile and powerup slots. Every change of
+// an active flag in those pools goes through here, so state->entities always holds the live
+// counts and the scoring and drop hooks of an entity run in one place. Side systems such as
+// sound and telemetry subscribe as listeners instead.
+
+// Called on the simulation thread once the slot is live; the entity is fully set up
+typedef void (*SpawnListener)(GameState* state, EntityKind kind, int index);
+
+// Called after the gameplay hooks; the slot is already free but still holds the entity
+typedef void (*DespawnListener)(GameState* state, EntityKind kind, int index, DespawnCause cause);
+
+// Register before any game runs. Adding one twice is ignored; false when the table is full.
+bool addSpawnListener(SpawnListener listener);
+bool addDespawnListener(DespawnListener listener);
+
+// Raise the spawn event for a slot; asteroids need their size and enemies their type set first.
+// Ignored if the slot is already live.
+void spawnEntity(GameState* state, EntityKind kind, int index);
+
+// Raise the despawn event and free the slot; ignored if it is not live
+void despawnEntity(GameState* state, EntityKind kind, int index, DespawnCause cause);
+
+// Rebuild the counts from the pools after they were filled or cleared wholesale
+void recountEntities(GameState* state);
+
+// Everything the wave is waited on is gone: asteroids, and enemies once they have all spawned
+bool isWaveCleared(const GameState* state);
+
+#endif // LIFECYCLE_H
\ No newline at end of file
@@ -0,0 +1,23 @@
+#ifndef MEMTRACK_H
+#define MEMTRACK_H
+
+#include <stddef.h>
+
+// Counting wrappers around the C allocator.
+// raylib is built with RL_MALLOC and friends pointing here (see premake5.lua),
+// so this header must not depend on raylib or any game types.
+
+void* trackedMalloc(size_t size);
+void* trackedCalloc(size_t count, size_t size);
+void* trackedRealloc(void* pointer, size_t size);
+void trackedFree(void* pointer);
+
+// Allocation accounting. MemoryStats is completed in typedefs.h, which every caller includes.
+struct MemoryStats;
+int getThreadAllocationCount(void);
+void checkTickAllocations(unsigned int tick, int allocations);
+void endMemoryFrame(void);
+struct MemoryStats getMemoryStats(void);
+void printMemoryReport(void);
+
+#endif // MEMTRACK_H
\ No newline at end of file
@@ -0,0 +1,15 @@
+#ifndef PACING_H
+#define PACING_H
+
+// Custom headers
+#include "typedefs.h"
+
+void beginPacedFrame(GameScreenState screenState);
+float getPacedFrameTime(void);
+bool shouldRedraw(GameScreenState screenState);
+void endPacedFrame(bool redrawn);
+void setPacingUncapped(bool uncapped);
+PacingStats getPacingStats(GameScreenState screenState);
+void printPacingReport(void);
+
+#endif // PACING_H
\ No newline at end of file
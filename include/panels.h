@@ -0,0 +1,13 @@
+#ifndef PANELS_H
+#define PANELS_H
+
+// Custom headers
+#include "typedefs.h"
+
+const MenuTextLayout* getMenuTextLayout(void);
+const char* updateCachedLabel(CachedLabel* label, const char* format, int value, int fontSize);
+void updateInfoPanel(const GameState* state);
+void drawInfoPanel(const GameState* state);
+void unloadPanels(void);
+
+#endif // PANELS_H
\ No newline at end of file
@@ -0,0 +1,13 @@
+#ifndef PERFCOUNTERS_H
+#define PERFCOUNTERS_H
+
+// Custom headers
+#include "typedefs.h"
+
+// Per-thread hardware counters read around subsystem scopes (see profiler.c).
+// Samples are cumulative since the thread's counters were opened.
+
+bool readPerfCounters(PerfSample* sample);   // False when counters are unavailable on this thread
+void addPerfCounters(SubsystemId subsystem, const PerfSample* self);
+
+#endif // PERFCOUNTERS_H
\ No newline at end of file
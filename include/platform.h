@@ -0,0 +1,56 @@
+#ifndef PLATFORM_H
+#define PLATFORM_H
+
+#include <stdbool.h>
+#include <stdio.h>
+
+// Thin wrappers over the OS thread, lock and clock APIs.
+// Kept free of raylib types so platform.c can include the native headers.
+
+typedef struct { void* handle; } PlatformThread;
+typedef struct { void* handle; } PlatformMutex;
+typedef struct { void* handle; } PlatformCondition;
+
+typedef int (*PlatformThreadFunc)(void* arg);
+
+// Storage class for per-thread variables
+#if defined(_MSC_VER)
+#define THREAD_LOCAL __declspec(thread)
+#else
+#define THREAD_LOCAL _Thread_local
+#endif
+
+// Threads
+bool createThread(PlatformThread* thread, PlatformThreadFunc func, void* arg);
+void joinThread(PlatformThread* thread);
+void markMainThread(void);
+bool isMainThread(void);
+int getProcessorCount(void);
+
+// Locks and condition variables
+bool createMutex(PlatformMutex* mutex);
+void lockMutex(PlatformMutex* mutex);
+void unlockMutex(PlatformMutex* mutex);
+void destroyMutex(PlatformMutex* mutex);
+bool createCondition(PlatformCondition* condition);
+void waitCondition(PlatformCondition* condition, PlatformMutex* mutex);
+void signalCondition(PlatformCondition* condition);
+void broadcastCondition(PlatformCondition* condition);
+void destroyCondition(PlatformCondition* condition);
+
+// Sequentially consistent atomics on plain ints
+int atomicLoad(volatile int* value);
+void atomicStore(volatile int* value, int newValue);
+int atomicExchange(volatile int* value, int newValue);
+int atomicAdd(volatile int* value, int amount);  // Returns the previous value
+bool atomicCompareExchange(volatile int* value, int expected, int desired);  // True when value was expected and is now desired
+
+// Time
+double getMonotonicTime(void);
+void sleepSeconds(double seconds);
+
+// Files
+bool syncFile(FILE* file);
+bool replaceFile(const char* source, const char* destination);
+
+#endif // PLATFORM_H
\ No newline at end of file
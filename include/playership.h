@@ -5,6 +5,7 @@
 #include "typedefs.h"
 
 void fireWeapon(GameState* state);
+unsigned int getWeaponCooldownTicks(float cooldown);
 
 #endif // PLAYERSHIP_H
 
@@ -9,5 +9,6 @@ void spawnLifePowerup(GameState* state, float x, float y);
 void spawnShotgunPowerup(GameState* state, float x, float y);
 void spawnGrenadePowerup(GameState* state, float x, float y);
 void updatePowerups(GameState* state, float deltaTime);
+void expirePowerup(GameState* state, int i, unsigned int deadline);
 
 #endif // POWERUPS_H
\ No newline at end of file
@@ -0,0 +1,19 @@
+#ifndef PROFILER_H
+#define PROFILER_H
+
+// Custom headers
+#include "typedefs.h"
+
+// Subsystem scopes, per thread
+void beginSubsystem(SubsystemId subsystem);
+void endSubsystem(void);
+SubsystemId getCurrentSubsystem(void);
+const char* getSubsystemName(SubsystemId subsystem);
+void collectSubsystemTimes(float times[SUBSYSTEM_COUNT]);
+void setSubsystemTiming(bool enabled);
+
+// Hardware counters; only collected in builds with ASTEROIDS_PERF_COUNTERS on Linux
+void countSubsystemEntities(int entities);
+void printPerfReport(void);
+
+#endif // PROFILER_H
\ No newline at end of file
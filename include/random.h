@@ -0,0 +1,11 @@
+#ifndef RANDOM_H
+#define RANDOM_H
+
+// Custom headers
+#include "typedefs.h"
+
+// Gameplay randomness lives in each GameState so separate games never share a sequence
+void seedGameRandom(GameState* state, unsigned int seed);
+int getGameRandomValue(GameState* state, int min, int max);
+
+#endif // RANDOM_H
\ No newline at end of file
@@ -4,15 +4,16 @@
 // Custom headers
 #include "typedefs.h"
 
-void renderGame(const GameState* state);
-void renderGameObject(const GameObject* obj, int sides, const GameState* state);
-void renderParticles(const GameState* state);
-void renderEnemies(const GameState* state);
-void renderPowerups(const GameState* state);
+void renderGame(const RenderSnapshot* state);
+void renderGameObject(const GameObject* obj, int sides, const RenderSnapshot* state);
+void renderParticles(const RenderSnapshot* state);
+void renderEnemies(const RenderSnapshot* state);
+void renderPowerups(const RenderSnapshot* state);
 void renderMenu(const GameState* state);
 void renderInfo(const GameState* state);
 void renderPause(const GameState* state);
 void renderOptions(const GameState* state);
 void renderGameOver(const GameState* state);
+void unloadPauseSnapshot(void);
 
 #endif // RENDER_H
\ No newline at end of file
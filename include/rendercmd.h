@@ -0,0 +1,19 @@
+#ifndef RENDERCMD_H
+#define RENDERCMD_H
+
+// Custom headers
+#include "typedefs.h"
+
+void beginRenderCommands(void);
+void pushSprite(RenderLayer layer, Texture2D texture, Rectangle source, Rectangle dest, Vector2 origin, float rotation, Color tint);
+void pushCircle(RenderLayer layer, Vector2 center, float radius, Color color);
+void pushCircleLines(RenderLayer layer, Vector2 center, float radius, Color color);
+void pushRectangle(RenderLayer layer, Rectangle rectangle, Color color);
+void pushLine(RenderLayer layer, Vector2 start, Vector2 end, Color color);
+void pushThickLine(RenderLayer layer, Vector2 start, Vector2 end, float thickness, Color color);
+void pushText(RenderLayer layer, const char* text, Vector2 position, int fontSize, Color color);
+void pushAsteroid(RenderLayer layer, int meshId, Vector2 position, float radius, Vector2 rotation, Color color);
+void submitRenderCommands(void);
+RenderCommandStats getRenderCommandStats(void);
+
+#endif // RENDERCMD_H
\ No newline at end of file
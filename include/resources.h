@@ -13,6 +13,9 @@ void loadAllTextures(GameState* state);
 // Unload all game textures
 void unloadAllTextures(GameState* state);
 
+// Skip all texture loading; for simulations that never draw
+void setHeadlessResources(bool headless);
+
 // Load a specific texture only if not already loaded
 Texture2D loadTextureOnce(const char* path);
 
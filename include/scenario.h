@@ -0,0 +1,17 @@
+#ifndef SCENARIO_H
+#define SCENARIO_H
+
+#include <stdbool.h>
+
+// Custom headers
+#include "typedefs.h"
+
+// Synthetic stress loads started from the command line. The load is topped back up every
+// tick, and frame times are collected for a fixed number of frames and printed as percentiles.
+
+void startScenario(GameState* state, const ScenarioOptions* options);
+void updateScenario(GameState* state);
+bool recordScenarioFrame(const FlightFrame* frame);
+void endScenario(void);
+
+#endif // SCENARIO_H
\ No newline at end of file
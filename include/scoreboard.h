@@ -4,8 +4,11 @@
 #include "typedefs.h"
 
 void loadHighScores(GameState* state);
-void saveHighScores(GameState* state);
+void saveHighScores(void);
 void addHighScore(GameState* state, int score, int wave);
+void updateScoreboard(const GameState* state, int width);
 void renderScoreboard(const GameState* state, int x, int y, int width);
+void unloadScoreboard(void);
+void unloadHighScores(void);
 
 #endif // SCOREBOARD_H
\ No newline at end of file
@@ -0,0 +1,13 @@
+#ifndef SCORESTORE_H
+#define SCORESTORE_H
+
+// Custom headers
+#include "typedefs.h"
+
+bool appendScoreRun(ScoreHistory* history, const HighScore* run);
+void freeScoreHistory(ScoreHistory* history);
+bool readScoreFile(const char* path, ScoreHistory* history);
+bool importLegacyScores(const char* path, ScoreHistory* history);
+bool writeScoreFile(const char* path, const char* tempPath, const HighScore* runs, int count);
+
+#endif // SCORESTORE_H
\ No newline at end of file
@@ -0,0 +1,18 @@
+#ifndef SIMULATION_H
+#define SIMULATION_H
+
+// Custom headers
+#include "typedefs.h"
+
+void initSimulation(GameState* state);
+void stepGame(GameState* state, const InputFrame* input);
+void resumeSimulation(void);
+void pauseSimulation(void);
+bool isSimulationActive(void);
+void submitInputFrame(const InputFrame* frame);
+const RenderSnapshot* acquireRenderSnapshot(void);
+void captureRenderSnapshot(const GameState* state, const EntityPositions* previous, RenderSnapshot* snapshot);
+SimulationStats getSimulationStats(void);
+void shutdownSimulation(void);
+
+#endif // SIMULATION_H
\ No newline at end of file
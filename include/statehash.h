@@ -0,0 +1,13 @@
+#ifndef STATEHASH_H
+#define STATEHASH_H
+
+// Custom headers
+#include "typedefs.h"
+
+// Deterministic digest of everything gameplay depends on, taken after a simulation tick.
+// Textures, cosmetics and render-only fields are left out.
+
+void digestGameState(const GameState* state, StateDigest* digest);
+const char* getStatePartName(StatePart part);
+
+#endif // STATEHASH_H
\ No newline at end of file
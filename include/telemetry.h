@@ -0,0 +1,32 @@
+#ifndef TELEMETRY_H
+#define TELEMETRY_H
+
+// Custom headers
+#include "typedefs.h"
+
+// Per-run gameplay and frame-time events, written to disk by a background thread.
+// Recording never blocks: events go into a lock-free ring and are dropped when it is full.
+
+// File layout, all fields little-endian:
+//   header: magic, version, simulation tick rate, histogram bucket count, bucket width in microseconds
+//   event: type (u8), arg (u8), wave (u16), tick (u32), value (i32)
+#define TELEMETRY_HEADER_SIZE 20
+#define TELEMETRY_EVENT_SIZE 12
+
+void initTelemetry(void);
+void recordTelemetry(TelemetryEventType type, int arg, int wave, unsigned int tick, int value);
+void shutdownTelemetry(void);
+const char* getTelemetryPoolName(TelemetryPool pool);
+
+// Simulation thread
+void recordGameTelemetry(const GameState* state, TelemetryEventType type, int arg, int value);
+void beginRunTelemetry(const GameState* state);
+void endRunTelemetry(const GameState* state);
+void endWaveTelemetry(const GameState* state);
+void samplePoolTelemetry(const GameState* state);
+
+// Main thread
+void recordFrameTelemetry(float frameTime, int wave, unsigned int tick);
+void flushFrameTelemetry(void);
+
+#endif // TELEMETRY_H
\ No newline at end of file
@@ -0,0 +1,29 @@
+#ifndef TIMERWHEEL_H
+#define TIMERWHEEL_H
+
+#include <stdbool.h>
+
+// Custom headers
+#include "typedefs.h"
+
+// Gameplay timers keyed by absolute simulation tick. Each tick only touches the timers that
+// are due; later ones wait in coarser slots and move down as their tick approaches.
+// Timers are never cancelled. Owners keep the deadline they expect, and the event is ignored
+// when it no longer matches, so rescheduling is just a new deadline.
+
+void resetTimerWheel(TimerWheel* wheel, unsigned int tick);
+bool scheduleTimer(TimerWheel* wheel, unsigned int deadline, TimerEvent event, int owner);
+
+// Take the next timer due by tick; false once none are left
+bool popExpiredTimer(TimerWheel* wheel, unsigned int tick, GameTimer* expired);
+
+// Schedule an event the given number of seconds from the current tick; returns its deadline
+unsigned int scheduleGameTimer(GameState* state, float seconds, TimerEvent event, int owner);
+
+// Ticks a countdown of this many seconds used to last; never less than one
+unsigned int ticksFromSeconds(float seconds);
+
+// Seconds left until a deadline, or 0 once it has passed
+float secondsUntilTick(unsigned int deadline, unsigned int tick);
+
+#endif // TIMERWHEEL_H
\ No newline at end of file
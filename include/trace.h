@@ -0,0 +1,18 @@
+#ifndef TRACE_H
+#define TRACE_H
+
+// Custom headers
+#include "typedefs.h"
+
+// Golden traces: a scripted, seeded run recorded as per-tick input and state digests,
+// replayed later to catch simulation changes that alter gameplay.
+// Header: magic, version, seed, waves, tick count, part count (little-endian u32s).
+// Each tick: input (held, pressed, mouse x, mouse y) then per part hash u64, exact hash u64, live count, 4 float sums.
+#define TRACE_HEADER_SIZE 24
+#define TRACE_INPUT_SIZE 16
+#define TRACE_PART_SIZE 36
+#define TRACE_TICK_SIZE (TRACE_INPUT_SIZE + STATE_PART_COUNT * TRACE_PART_SIZE)
+
+int runTrace(GameState* state, const TraceOptions* options);
+
+#endif // TRACE_H
\ No newline at end of file
@@ -22,6 +22,8 @@ typedef struct {
 typedef struct {
     GameObject base;
     int size; // 3 = large, 2 = medium, 1 = small
+    int meshId;            // Outline in the shared asteroid mesh cache
+    Vector2 meshRotation;  // Cosine and sine of base.angle, computed at spawn
 } Asteroid;
 
 typedef struct {
@@ -32,6 +34,7 @@ typedef struct {
     float radius;
     float angle;
     float rotationSpeed;
+    int meshId;
     bool active;
 } MenuAsteroid;
 
@@ -53,21 +56,25 @@ typedef enum {
     INFO_STATE
 } GameScreenState;
 
+#define SCREEN_STATE_COUNT (INFO_STATE + 1)
+
 typedef enum {
     ENEMY_TANK,
     ENEMY_SCOUT
 } EnemyType;
 
+#define ENEMY_TYPE_COUNT (ENEMY_SCOUT + 1)
+
 typedef struct {
     GameObject base;
     EnemyType type;
     int health;
-    float fireTimer;
+    unsigned int fireReadyTick;   // simTick the next shot (or scout burst) may start
     int burstCount;    // For scout enemy burst fire
-    float burstTimer;
+    unsigned int burstReadyTick;  // simTick of the next shot in a burst
     bool isBursting;
     float moveAngle;   // Angle for movement direction
-    float moveTimer;   // Timer for changing movement direction
+    unsigned int headingTick;     // simTick the wander direction next changes
     Texture2D texture;
 } Enemy;
 
@@ -76,13 +83,23 @@ typedef enum {
     BULLET_GRENADE
 } BulletType;
 
+// What hurt the player, for telemetry
+typedef enum {
+    DAMAGE_ASTEROID,
+    DAMAGE_SCOUT_BULLET,
+    DAMAGE_TANK_GRENADE,
+    DAMAGE_GRENADE_BLAST,
+    DAMAGE_SOURCE_COUNT
+} DamageSource;
+
 typedef struct {
     GameObject base;
     int damage;
     bool isPlayerBullet; // To distinguish player bullets from enemy bullets
     BulletType type;     // New field for bullet type
-    float timer;         // Timer for grenade explosion
+    unsigned int fuseTick; // simTick a grenade explodes
     bool hasExploded;    // Flag to prevent multiple explosions
+    DamageSource source; // What fired it, so damage to the player can be attributed
 } Bullet;
 
 typedef enum {
@@ -101,7 +118,7 @@ typedef enum {
 typedef struct {
     GameObject base;
     PowerupType type;
-    float lifetime;
+    unsigned int expireTick;   // simTick it disappears if not collected
     float pulseTimer;
     Texture2D texture;
 } Powerup;
@@ -112,6 +129,119 @@ typedef struct {
     char date[12];  // Format: MM/DD/YYYY
 } HighScore;
 
+// Path costs toward the ship over a coarse grid, shared by every chasing enemy
+typedef struct {
+    int cost[FLOW_FIELD_CELLS];                 // Cheapest path cost to the ship's cell
+    Vector2 direction[FLOW_FIELD_CELLS];        // Unit step toward the cheapest neighbour
+    unsigned char covered[FLOW_FIELD_CELLS];    // An asteroid overlaps the cell
+    Vector2 origin;                             // World position of the grid's top-left corner
+    int targetCell;
+    Vector2 target;                             // Ship position the field was built for
+    unsigned int builtTick;
+    bool valid;
+} FlowField;
+
+// Gameplay events the timer wheel fires on their deadline tick
+typedef enum {
+    TIMER_WAVE_START,          // The wave transition is over
+    TIMER_RELOAD,              // The normal weapon finishes reloading
+    TIMER_INVULNERABILITY,     // Invulnerability after a respawn wears off
+    TIMER_BLINK,               // The ship toggles visibility while invulnerable
+    TIMER_ENEMY_SPAWN,         // The spawner adds the wave's next enemy
+    TIMER_POWERUP_EXPIRY,      // owner: powerup slot
+    TIMER_GRENADE_FUSE,        // owner: enemyBullets slot
+    TIMER_ENEMY_HEADING        // owner: enemy slot; picks a new wander direction
+} TimerEvent;
+
+typedef struct {
+    unsigned int deadline;
+    TimerEvent event;
+    int owner;                 // Entity slot the event is for, or -1
+    int next;                  // Next entry in the same slot or in the free list, -1 at the end
+} GameTimer;
+
+// Scheduled events in slots of 1, 64 and 4096 ticks; see timerwheel.h
+typedef struct {
+    GameTimer entries[MAX_GAME_TIMERS];
+    int slots[TIMER_WHEEL_LEVELS][TIMER_WHEEL_SLOTS];  // First entry of each slot, -1 when empty
+    int freeList;
+    int count;
+    unsigned int now;          // Tick whose level-0 slot is being fired
+} TimerWheel;
+
+// Pools whose slots raise spawn and despawn events, see lifecycle.h
+typedef enum {
+    ENTITY_BULLET,             // Player bullets
+    ENTITY_ASTEROID,
+    ENTITY_ENEMY,
+    ENTITY_ENEMY_BULLET,       // Enemy shots, plus grenades and shrapnel from either side
+    ENTITY_POWERUP,
+    ENTITY_KIND_COUNT
+} EntityKind;
+
+// Why an entity left its pool; decides which gameplay hooks run
+typedef enum {
+    DESPAWN_SHOT,              // Destroyed by something the player fired
+    DESPAWN_DESTROYED,         // Destroyed by a collision or enemy fire
+    DESPAWN_EXPIRED,           // Left the map, went off or ran out of time
+    DESPAWN_COLLECTED,         // Powerup picked up by the ship
+    DESPAWN_SLEEP,             // Packed into a dormant sector of the large world
+    DESPAWN_CLEARED            // Swept away by a new wave or a debug key
+} DespawnCause;
+
+// Live entities, kept by the spawn and despawn events instead of rescanning the pools
+typedef struct {
+    int live[ENTITY_KIND_COUNT];
+    int asteroidsBySize[4];              // Indexed by size 1-3
+    int enemiesByType[ENEMY_TYPE_COUNT];
+} EntityCounts;
+
+typedef enum {
+    WORLD_NORMAL,   // The classic single-screen-set map, simulated in full
+    WORLD_LARGE     // 20x the area, streamed in sectors around the ship
+} WorldSize;
+
+typedef enum {
+    SECTOR_UNGENERATED,   // Never came near the ship; contents come from its seed on first approach
+    SECTOR_DORMANT,       // Coarse drift only, entities packed into the sector
+    SECTOR_ACTIVE         // Entities live in the gameplay pools
+} SectorStatus;
+
+// Just enough of an asteroid to rebuild it when its sector wakes up
+typedef struct {
+    Vector2 position;
+    Vector2 velocity;   // Per tick, like GameObject dx/dy
+    float angle;
+    int size;
+    int meshId;
+} DormantAsteroid;
+
+typedef struct {
+    SectorStatus status;
+    unsigned int random;    // Generator state, seeded from the world seed and the sector index
+    int asteroidCount;
+    DormantAsteroid asteroids[SECTOR_MAX_ASTEROIDS];
+    int tanks;              // Enemies are only kept as counts while dormant
+    int scouts;
+} Sector;
+
+typedef struct {
+    WorldSize size;
+    float width;
+    float height;
+    int columns;            // Sector grid in use, at most SECTOR_MAX_COLUMNS by SECTOR_MAX_ROWS
+    int rows;
+    unsigned int seed;
+    Sector sectors[SECTOR_MAX_COUNT];
+} World;
+
+// Every finished run, oldest first; the scoreboard shows the best MAX_HIGH_SCORES of these
+typedef struct {
+    HighScore* runs;
+    int count;
+    int capacity;
+} ScoreHistory;
+
 typedef struct {
     Ship ship;
     GameObject bullets[MAX_BULLETS];
@@ -124,14 +254,14 @@ typedef struct {
     int normalAmmo;
     int shotgunAmmo;
     int grenadeAmmo;           // field for grenade ammo
-    float fireTimer;           // General fire timer
-    float shotgunFireTimer;    // Specific timer for shotgun cooldown
-    float grenadeFireTimer;    // Specific timer for grenade cooldown
+    unsigned int fireReadyTick;     // simTick the normal weapon may fire again
+    unsigned int shotgunReadyTick;  // Same for the shotgun
+    unsigned int grenadeReadyTick;  // Same for the grenade launcher
     int score;
     int lives;
     int health;
     Camera2D camera;
-    float reloadTimer;
+    unsigned int reloadDoneTick;    // simTick the running reload completes
     bool isReloading;
     bool running;
     bool Debug;
@@ -146,16 +276,18 @@ typedef struct {
     Rectangle volumeSlider;
     Rectangle musicVolumeSlider;
     Rectangle mainMenuButton;
+    Rectangle renderScaleButton;
+    Texture2D crosshairTexture;
+    bool hasCustomCursor;
     bool windowFocused;
     Sound sounds[MAX_SOUNDS];
     bool soundLoaded;
-    float enemySpawnTimer;
+    unsigned int enemySpawnTick;    // simTick of the next spawn; 0 when none is due
     int currentWave;
-    int asteroidsRemaining;
-    float waveDelayTimer;
+    unsigned int nextWaveTick;      // simTick the wave transition ends
     bool inWaveTransition;
     char waveMessage[64];
-    float waveMessageTimer;
+    unsigned int waveMessageEndTick;
     float soundVolume;
     bool isDraggingSlider;
     bool isDraggingMusicSlider;
@@ -165,17 +297,403 @@ typedef struct {
     Music* currentMusic;  // Pointer to track which music is currently active
     bool musicLoaded;
     float musicVolume;
-    float invulnerabilityTimer;
+    unsigned int invulnerabilityEndTick;
     bool isInvulnerable;
-    float blinkTimer;
+    unsigned int blinkTick;         // simTick the ship next toggles visibility
     bool shipVisible;
     int enemiesSpawnedThisWave;
     int maxEnemiesThisWave;
     int EnemySpawnComplete;
     HighScore highScores[MAX_HIGH_SCORES];
     int scoreCount;
+    Vector2 aimPosition;  // Cursor in world space, updated by the simulation each tick
+    unsigned int simTick;        // Simulation ticks run since this game started
+    unsigned int waveStartTick;  // simTick when the current wave started
+    unsigned char bulletWeapon[MAX_BULLETS];  // WeaponType that fired each player bullet
+    bool waveLocked;             // Stress scenarios keep the current wave from ending
+    FlowField flowField;         // Enemy navigation, rebuilt by updateEnemies
+    World world;                 // Map bounds, plus the sectors of a streamed large world
+    unsigned int randomState[4]; // Gameplay random generator, see random.h
+    TimerWheel timers;           // Deadlines above fire through here, see timerwheel.h
+    EntityCounts entities;       // Live counts per pool and type, see lifecycle.h
 } GameState;
 
+// Buttons the simulation reacts to, sampled on the main thread
+typedef enum {
+    INPUT_THRUST             = 1 << 0,
+    INPUT_STRAFE_LEFT        = 1 << 1,
+    INPUT_STRAFE_RIGHT       = 1 << 2,
+    INPUT_REVERSE            = 1 << 3,
+    INPUT_FIRE               = 1 << 4,
+    INPUT_PAUSE              = 1 << 5,
+    INPUT_RELOAD             = 1 << 6,
+    INPUT_TOGGLE_DEBUG       = 1 << 7,
+    INPUT_KILL_ASTEROIDS     = 1 << 8,
+    INPUT_KILL_ENEMIES       = 1 << 9,
+    INPUT_SKIP_WAVE          = 1 << 10
+} InputButton;
+
+// One main-thread input sample, queued for the simulation thread
+typedef struct {
+    unsigned int held;     // Buttons down when sampled
+    unsigned int pressed;  // Buttons that went down since the previous sample
+    Vector2 mouse;         // Cursor in internal screen coordinates
+} InputFrame;
+
+// Entity positions at the start of a tick; NAN marks slots that were inactive
+typedef struct {
+    Vector2 ship;
+    Vector2 bullets[MAX_BULLETS];
+    Vector2 asteroids[MAX_ASTEROIDS];
+    Vector2 enemies[MAX_ENEMIES];
+    Vector2 enemyBullets[MAX_ENEMY_BULLETS];
+    Vector2 particles[MAX_PARTICLES];
+    Vector2 powerups[MAX_POWERUPS];
+} EntityPositions;
+
+// Copy of everything the game screen draws, published by the simulation after each tick
+typedef struct {
+    unsigned long long tick;
+    unsigned int simTick;
+    double publishTime;
+    GameScreenState screenState;
+    Ship ship;
+    GameObject bullets[MAX_BULLETS];
+    Asteroid asteroids[MAX_ASTEROIDS];
+    Enemy enemies[MAX_ENEMIES];
+    Bullet enemyBullets[MAX_ENEMY_BULLETS];
+    Particle particles[MAX_PARTICLES];
+    Powerup powerups[MAX_POWERUPS];
+    EntityPositions previous;
+    Camera2D camera;
+    float worldWidth;
+    float worldHeight;
+    WeaponType currentWeapon;
+    int normalAmmo;
+    int shotgunAmmo;
+    int grenadeAmmo;
+    int score;
+    int lives;
+    int health;
+    float reloadTimer;
+    bool isReloading;
+    int currentWave;
+    int asteroidsRemaining;
+    EntityCounts entities;
+    int enemiesSpawnedThisWave;
+    int maxEnemiesThisWave;
+    char waveMessage[64];
+    float waveMessageTimer;
+    bool isInvulnerable;
+    bool shipVisible;
+    bool Debug;
+    bool hasCustomCursor;
+    Texture2D crosshairTexture;
+} RenderSnapshot;
+
+typedef struct {
+    unsigned long long ticks;  // Simulation ticks run since start
+    int skippedTicks;          // Ticks dropped when the simulation fell too far behind
+    float tickTime;            // Rolling average of time spent inside one tick (seconds)
+    int queuedInputs;          // Input frames consumed by the last tick
+} SimulationStats;
+
+// Areas of work that time and allocations are attributed to
+typedef enum {
+    SUBSYSTEM_OTHER,
+    SUBSYSTEM_INPUT,
+    SUBSYSTEM_SIMULATION,
+    SUBSYSTEM_COLLISIONS,
+    SUBSYSTEM_ENEMIES,
+    SUBSYSTEM_PARTICLES,
+    SUBSYSTEM_POWERUPS,
+    SUBSYSTEM_RENDER,
+    SUBSYSTEM_AUDIO,
+    SUBSYSTEM_RESOURCES,
+    SUBSYSTEM_IO,
+    SUBSYSTEM_COUNT
+} SubsystemId;
+
+typedef struct MemoryStats {
+    int frameAllocations;     // Allocations during the last frame, from any thread
+    int frameFrees;
+    int frameBytes;           // Bytes requested during the last frame
+    int peakAllocations;      // Most allocations seen in a single frame
+    int peakBytes;
+    int allocatingFrames;     // Frames that allocated at all
+    int frames;
+    int tickAllocations;      // Allocations made by gameplay ticks after warm-up
+    long long totalAllocations[SUBSYSTEM_COUNT];
+    long long totalBytes[SUBSYSTEM_COUNT];
+    int peakScopeAllocations[SUBSYSTEM_COUNT];  // Most allocations by one subsystem in a single frame
+} MemoryStats;
+
+// Hardware events counted by the optional perf counter build
+typedef enum {
+    PERF_CYCLES,
+    PERF_INSTRUCTIONS,
+    PERF_L1D_MISSES,
+    PERF_LLC_MISSES,
+    PERF_BRANCH_MISSES,
+    PERF_COUNTER_COUNT
+} PerfCounter;
+
+typedef struct {
+    unsigned long long values[PERF_COUNTER_COUNT];
+} PerfSample;
+
+// Events in the per-run telemetry stream; new types are only ever appended
+typedef enum {
+    TELEMETRY_RUN_START,        // value: simulation tick rate
+    TELEMETRY_RUN_END,          // value: final score
+    TELEMETRY_WAVE_END,         // arg: 1 if cleared, 0 if the run ended first; value: ticks spent in the wave
+    TELEMETRY_KILL,             // arg: EnemyType
+    TELEMETRY_SHOT,             // arg: WeaponType; value: projectiles spawned
+    TELEMETRY_HIT,              // arg: WeaponType
+    TELEMETRY_DAMAGE,           // arg: DamageSource; value: health lost
+    TELEMETRY_POWERUP_SPAWN,    // arg: PowerupType
+    TELEMETRY_POWERUP_COLLECT,  // arg: PowerupType
+    TELEMETRY_POOL_PEAK,        // arg: TelemetryPool; value: most slots in use at once during the wave
+    TELEMETRY_FRAME_HISTOGRAM,  // arg: bucket; value: frames that landed in it
+    TELEMETRY_EVENT_COUNT
+} TelemetryEventType;
+
+// Fixed-size entity pools whose occupancy is tracked
+typedef enum {
+    TELEMETRY_POOL_BULLETS,
+    TELEMETRY_POOL_ASTEROIDS,
+    TELEMETRY_POOL_ENEMIES,
+    TELEMETRY_POOL_ENEMY_BULLETS,
+    TELEMETRY_POOL_PARTICLES,
+    TELEMETRY_POOL_POWERUPS,
+    TELEMETRY_POOL_COUNT
+} TelemetryPool;
+
+typedef struct {
+    unsigned char type;   // TelemetryEventType
+    unsigned char arg;
+    unsigned short wave;
+    unsigned int tick;    // GameState.simTick when recorded
+    int value;
+} TelemetryEvent;
+
+// One main loop iteration as kept by the flight recorder
+typedef struct {
+    unsigned int frame;                      // Main loop iteration number
+    float frameTime;                         // Seconds since the previous iteration ended, unclamped
+    float subsystemTime[SUBSYSTEM_COUNT];    // Self time spent in each subsystem, on any thread
+    int poolCounts[TELEMETRY_POOL_COUNT];    // Active entities in the newest snapshot
+    int assetLoads;                          // Textures and render targets created
+    int soundsPlayed;
+    int allocations;
+    int wave;                                // 0 outside gameplay
+    bool gameplay;
+} FlightFrame;
+
+// Parts of the game state hashed separately, so a mismatch points at what diverged
+typedef enum {
+    STATE_PART_PLAYER,
+    STATE_PART_BULLETS,
+    STATE_PART_ASTEROIDS,
+    STATE_PART_ENEMIES,
+    STATE_PART_ENEMY_BULLETS,
+    STATE_PART_PARTICLES,
+    STATE_PART_POWERUPS,
+    STATE_PART_WAVE,
+    STATE_PART_COUNT
+} StatePart;
+
+typedef struct {
+    unsigned long long hash;   // FNV-1a over the exact bits of every live field
+    unsigned long long exact;  // FNV-1a over the integer, flag and tick fields alone
+    int active;                // Live entities in the part
+    float sums[4];             // Summed positions and velocities, compared with a tolerance
+} StatePartDigest;
+
+typedef struct {
+    StatePartDigest parts[STATE_PART_COUNT];
+} StateDigest;
+
+typedef enum {
+    TRACE_OFF,
+    TRACE_RECORD,
+    TRACE_VERIFY
+} TraceMode;
+
+// Command line options for scripted regression runs
+typedef struct {
+    TraceMode mode;
+    const char* path;
+    unsigned int seed;
+    int waves;
+    float tolerance;           // 0 compares hashes bit for bit
+} TraceOptions;
+
+// Synthetic loads the game can start straight into
+typedef enum {
+    SCENARIO_NONE,
+    SCENARIO_ASTEROIDS,        // Asteroids of one size class or a mix of all three
+    SCENARIO_SCOUTS,           // Scouts in tight groups
+    SCENARIO_TANKS,            // Tanks in grenade range of the ship
+    SCENARIO_PARTICLES,        // Explosions fired until the particle pool is full
+    SCENARIO_POWERUPS,         // Every powerup slot in use
+    SCENARIO_COUNT
+} ScenarioType;
+
+typedef struct {
+    ScenarioType type;
+    int count;                 // Entities kept alive; clamped to the pool
+    int asteroidSize;          // 1-3, or 0 for a mix of all sizes
+    int frames;                // Measured frames before the game exits
+    unsigned int seed;
+} ScenarioOptions;
+
+// Headless games run side by side for bots and balance sweeps
+typedef struct {
+    int count;                 // Instances; 0 runs the normal game
+    int ticks;                 // Ticks each instance is stepped at most
+    int threads;               // Workers including the calling thread; 0 uses every core
+    unsigned int seed;
+    WorldSize world;
+} BatchOptions;
+
+// Everything main takes from the command line
+typedef struct {
+    TraceOptions trace;
+    ScenarioOptions scenario;
+    BatchOptions batch;
+    WorldSize world;
+} LaunchOptions;
+
+// Categories used to report how much of each entity pool the camera culled
+typedef enum {
+    CULL_PARTICLES,
+    CULL_BULLETS,
+    CULL_ASTEROIDS,
+    CULL_ENEMIES,
+    CULL_POWERUPS,
+    CULL_DEBUG,
+    CULL_CATEGORY_COUNT
+} CullCategory;
+
+typedef struct {
+    int drawn[CULL_CATEGORY_COUNT];
+    int culled[CULL_CATEGORY_COUNT];
+} CullStats;
+
+// Draw layers for world render commands, submitted back to front
+typedef enum {
+    LAYER_PARTICLES,
+    LAYER_SHIP,
+    LAYER_BULLETS,
+    LAYER_ASTEROIDS,
+    LAYER_ENEMY_DEBUG,
+    LAYER_ENEMIES,
+    LAYER_ENEMY_BULLETS,
+    LAYER_POWERUPS,
+    LAYER_OVERLAY,
+    RENDER_LAYER_COUNT
+} RenderLayer;
+
+// Primitive kinds, in the order they are drawn when they share a layer and texture
+typedef enum {
+    RENDER_SPRITE,
+    RENDER_CIRCLE,
+    RENDER_RECTANGLE,
+    RENDER_THICK_LINE,
+    RENDER_CIRCLE_LINES,
+    RENDER_LINE,
+    RENDER_ASTEROID,
+    RENDER_TEXT
+} RenderCommandKind;
+
+// One deferred draw; everything needed to submit it later is copied in
+typedef struct {
+    unsigned long long sortKey;
+    unsigned char layer;
+    unsigned char kind;
+    unsigned int textureId;
+    Color color;
+    union {
+        struct { Texture2D texture; Rectangle source; Rectangle dest; Vector2 origin; float rotation; } sprite;
+        struct { Vector2 center; float radius; } circle;
+        struct { Vector2 start; Vector2 end; float thickness; } line;
+        Rectangle rectangle;
+        struct { const char* text; Vector2 position; int fontSize; } text;   // text must be a string literal
+        struct { int meshId; Vector2 position; float radius; Vector2 rotation; } asteroid;
+    } data;
+} RenderCommand;
+
+typedef struct {
+    int commands;                      // Commands recorded this frame
+    int batches;                       // Groups of commands submitted with the same texture and primitive type
+    int dropped;                       // Commands lost because the buffer was full
+    int perLayer[RENDER_LAYER_COUNT];
+} RenderCommandStats;
+
+// Irregular asteroid outline with vertices on a unit circle, shared between asteroids
+typedef struct {
+    int vertexCount;
+    Vector2 vertices[ASTEROID_MESH_MAX_VERTICES];
+    bool generated;
+} AsteroidMesh;
+
+typedef struct {
+    int frames;             // Frames the HUD was drawn
+    int renders;            // Times the cached HUD layer was re-rendered
+    int waveMessageRenders; // Times the wave message layer was re-rendered
+} HudStats;
+
+// Time and work spent in one screen state, used to compare frame pacing policies
+typedef struct {
+    double wallTime;    // Seconds spent in the state
+    double cpuTime;     // Process CPU seconds spent in the state
+    int iterations;     // Main loop iterations
+    int redraws;        // Iterations that actually rendered a frame
+} PacingStats;
+
+// Cosmetic quality steps chosen by the frame-time governor
+typedef enum {
+    QUALITY_HIGH,
+    QUALITY_MEDIUM,
+    QUALITY_LOW,
+    QUALITY_LEVEL_COUNT
+} QualityLevel;
+
+typedef struct {
+    QualityLevel level;
+    float averageFrameTime; // Rolling average of full frame time (seconds)
+    float averageWorkTime;  // Rolling average of update + render time (seconds)
+    float particleScale;    // Multiplier applied to particle emission counts
+    float renderScaleCap;   // Highest internal render scale allowed
+    int changes;            // Number of quality changes so far
+} GovernorStats;
+
+// Text widths for the static menu screens, measured once instead of every frame
+typedef struct {
+    int menuTitleWidth;
+    int playWidth;
+    int optionsWidth;
+    int quitWidth;
+    int resumeWidth;
+    int backWidth;
+    int mainMenuWidth;
+    int pauseTitleWidth;
+    int optionsTitleWidth;
+    int soundVolumeWidth;
+    int musicVolumeWidth;
+    int gameOverTitleWidth;
+    int versionWidth;
+} MenuTextLayout;
+
+// A formatted label that is only re-formatted and re-measured when its value changes
+typedef struct {
+    int value;
+    bool valid;
+    char text[64];
+    int width;
+} CachedLabel;
+
 typedef struct {
     int minRadius;
     int maxRadius;
@@ -0,0 +1,18 @@
+#ifndef VIEWPORT_H
+#define VIEWPORT_H
+
+// Custom headers
+#include "typedefs.h"
+
+void initViewport(void);
+void updateViewport(void);
+void beginFrame(void);
+void endFrame(void);
+void setRenderScale(float scale);
+float getRenderScale(void);
+void setRenderScaleCap(float cap);
+float getEffectiveRenderScale(void);
+float cycleRenderScale(void);
+void unloadViewport(void);
+
+#endif // VIEWPORT_H
\ No newline at end of file
@@ -0,0 +1,11 @@
+#ifndef WORLD_H
+#define WORLD_H
+
+// Custom headers
+#include "typedefs.h"
+
+void resetWorld(GameState* state);
+void updateWorld(GameState* state);
+Rectangle getSpawnArea(const GameState* state);
+
+#endif // WORLD_H
\ No newline at end of file
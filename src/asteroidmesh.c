@@ -0,0 +1,106 @@
+#include "raylib.h"
+#include "rlgl.h"
+#include <stdbool.h>
+#include <math.h>
+
+// Custom headers
+#include "typedefs.h"
+#include "config.h"
+#include "asteroidmesh.h"
+
+// Outlines are all generated at startup and then shared by every asteroid that picks them
+static AsteroidMesh meshCache[ASTEROID_SIZE_CLASSES * ASTEROID_MESH_VARIANTS] = {0};
+
+// Small deterministic generator so meshes never touch the gameplay RNG
+static unsigned int meshRandom(unsigned int* seed) {
+    *seed ^= *seed << 13;
+    *seed ^= *seed >> 17;
+    *seed ^= *seed << 5;
+    return *seed;
+}
+
+static float meshRandomFloat(unsigned int* seed) {
+    return (meshRandom(seed) % 10000) / 10000.0f;
+}
+
+// Build a lumpy outline; larger rocks get more vertices
+static void generateAsteroidMesh(AsteroidMesh* mesh, int sizeClass, int variant) {
+    unsigned int seed = ASTEROID_MESH_SEED + sizeClass * 7919u + variant * 104729u;
+    
+    int minVertices = 7 + sizeClass * 2;
+    int vertexCount = minVertices + (int)(meshRandom(&seed) % 3);
+    if (vertexCount > ASTEROID_MESH_MAX_VERTICES) vertexCount = ASTEROID_MESH_MAX_VERTICES;
+    
+    float step = 2.0f * PI / vertexCount;
+    for (int i = 0; i < vertexCount; i++) {
+        // Jitter the angle a little so the spacing isn't perfectly even
+        float angle = i * step + (meshRandomFloat(&seed) - 0.5f) * step * 0.5f;
+        float radius = 1.0f - meshRandomFloat(&seed) * ASTEROID_MESH_JAGGEDNESS;
+        
+        // Same orientation convention as the old octagons (0 degrees points up)
+        mesh->vertices[i].x = sinf(angle) * radius;
+        mesh->vertices[i].y = -cosf(angle) * radius;
+    }
+    
+    mesh->vertexCount = vertexCount;
+    mesh->generated = true;
+}
+
+// Get the cached mesh id for a size class (1-3) and spawn seed; only reads, so any thread may ask
+int acquireAsteroidMesh(int sizeClass, unsigned int seed) {
+    if (sizeClass < 1) sizeClass = 1;
+    if (sizeClass > ASTEROID_SIZE_CLASSES) sizeClass = ASTEROID_SIZE_CLASSES;
+    
+    int variant = (int)(seed % ASTEROID_MESH_VARIANTS);
+    return (sizeClass - 1) * ASTEROID_MESH_VARIANTS + variant;
+}
+
+// Build every variant up front, before any simulation thread starts; the cache is read-only after
+void generateAsteroidMeshes(void) {
+    for (int sizeClass = 0; sizeClass < ASTEROID_SIZE_CLASSES; sizeClass++) {
+        for (int variant = 0; variant < ASTEROID_MESH_VARIANTS; variant++) {
+            AsteroidMesh* mesh = &meshCache[sizeClass * ASTEROID_MESH_VARIANTS + variant];
+            if (!mesh->generated) generateAsteroidMesh(mesh, sizeClass, variant);
+        }
+    }
+}
+
+// Menu asteroids have a free radius, so bucket it into the game's size classes
+int getMenuAsteroidSizeClass(float radius) {
+    if (radius >= 33.0f) return 3;
+    if (radius >= 24.0f) return 2;
+    return 1;
+}
+
+// Start one line-list draw that all following outlines are added to
+void beginAsteroidBatch(int maxOutlines) {
+    rlCheckRenderBatchLimit(maxOutlines * ASTEROID_MESH_MAX_VERTICES * 2);
+    rlBegin(RL_LINES);
+}
+
+// Add a transformed outline to the current batch
+void batchAsteroidOutline(int meshId, float x, float y, float radius, Vector2 rotation, Color color) {
+    const AsteroidMesh* mesh = &meshCache[meshId];
+    if (!mesh->generated) return;
+    
+    rlColor4ub(color.r, color.g, color.b, color.a);
+    
+    // Rotate, scale and translate each vertex once
+    Vector2 points[ASTEROID_MESH_MAX_VERTICES];
+    for (int i = 0; i < mesh->vertexCount; i++) {
+        float vx = mesh->vertices[i].x * radius;
+        float vy = mesh->vertices[i].y * radius;
+        points[i].x = x + vx * rotation.x - vy * rotation.y;
+        points[i].y = y + vx * rotation.y + vy * rotation.x;
+    }
+    
+    for (int i = 0; i < mesh->vertexCount; i++) {
+        int next = (i + 1) % mesh->vertexCount;
+        rlVertex2f(points[i].x, points[i].y);
+        rlVertex2f(points[next].x, points[next].y);
+    }
+}
+
+void endAsteroidBatch(void) {
+    rlEnd();
+}
\ No newline at end of file
@@ -9,65 +9,74 @@
 // Include custom headers
 #include "typedefs.h"
 #include "config.h"
-#include "powerups.h"
+#include "asteroids.h"
+#include "asteroidmesh.h"
+#include "collisions.h"
+#include "world.h"
+#include "random.h"
+#include "lifecycle.h"
+
+// Pick a cached outline for a freshly spawned asteroid and precompute its rotation.
+// The outline follows from the spin angle already drawn and the slot, so choosing it never
+// takes a number from the gameplay RNG.
+static void assignAsteroidMesh(Asteroid* asteroid, int slot) {
+    asteroid->meshId = acquireAsteroidMesh(asteroid->size, (unsigned int)asteroid->base.angle + (unsigned int)slot * 3u);
+    
+    float radians = asteroid->base.angle * PI / 180.0f;
+    asteroid->meshRotation = (Vector2){ cosf(radians), sinf(radians) };
+}
 
 void createAsteroids(GameState* state, int count) {
+    createAsteroidsOfSize(state, count, 3); // Waves start with large asteroids
+}
+
+// Size 1-3 from small to large
+void createAsteroidsOfSize(GameState* state, int count, int size) {
+    Rectangle area = getSpawnArea(state);
     int created = 0;
     
     for (int i = 0; i < MAX_ASTEROIDS && created < count; i++) {
         if (!state->asteroids[i].base.active) {
-            state->asteroids[i].base.active = true;
-            state->asteroids[i].size = 3; // Start with large asteroids
+            state->asteroids[i].size = size;
             state->asteroids[i].base.radius = 20.0f * state->asteroids[i].size;
             
-            // Place asteroid away from the ship but within map bounds
+            // Place asteroid away from the ship but within the spawn area
             do {
-                state->asteroids[i].base.x = GetRandomValue(
-                    state->asteroids[i].base.radius, 
-                    MAP_WIDTH - state->asteroids[i].base.radius
+                state->asteroids[i].base.x = getGameRandomValue(state, 
+                    area.x + state->asteroids[i].base.radius, 
+                    area.x + area.width - state->asteroids[i].base.radius
                 );
                 
-                state->asteroids[i].base.y = GetRandomValue(
-                    state->asteroids[i].base.radius, 
-                    MAP_HEIGHT - state->asteroids[i].base.radius
+                state->asteroids[i].base.y = getGameRandomValue(state, 
+                    area.y + state->asteroids[i].base.radius, 
+                    area.y + area.height - state->asteroids[i].base.radius
                 );
                 
             } while (sqrt(pow(state->asteroids[i].base.x - state->ship.base.x, 2) + 
                          pow(state->asteroids[i].base.y - state->ship.base.y, 2)) < 200);
             
             // Random velocity
-            float angle = GetRandomValue(0, 359) * PI / 180.0f;
-            float speed = 1.0f + GetRandomValue(0, 100) / 100.0f;
+            float angle = getGameRandomValue(state, 0, 359) * PI / 180.0f;
+            float speed = 1.0f + getGameRandomValue(state, 0, 100) / 100.0f;
             state->asteroids[i].base.dx = sin(angle) * speed;
             state->asteroids[i].base.dy = -cos(angle) * speed;
-            state->asteroids[i].base.angle = GetRandomValue(0, 359);
+            state->asteroids[i].base.angle = getGameRandomValue(state, 0, 359);
+            assignAsteroidMesh(&state->asteroids[i], i);
+            spawnEntity(state, ENTITY_ASTEROID, i);
             
             created++;
         }
     }
 }
 
-void splitAsteroid(GameState* state, int index) {
+void splitAsteroid(GameState* state, int index, DespawnCause cause) {
     // Get the asteroid properties before deactivating it
     float x = state->asteroids[index].base.x;
     float y = state->asteroids[index].base.y;
     int size = state->asteroids[index].size;
-
-    // Only large asteroids (size 3) have a chance to drop life powerups
-    if (size == 3) {
-        spawnLifePowerup(state, x, y);
-    }
     
-    // Try to spawn a health powerup before deactivating the asteroid
-    spawnHealthPowerup(state, x, y);
-    
-    // Play asteroid hit sound
-    if (state->soundLoaded) {
-        PlaySound(state->sounds[SOUND_ASTEROID_HIT]);
-    }
-    
-    // Deactivate the hit asteroid
-    state->asteroids[index].base.active = false;
+    // The despawn event drops powerups, plays the hit sound and scores
+    despawnEntity(state, ENTITY_ASTEROID, index, cause);
     
     // If it's not the smallest size, split into two smaller asteroids
     if (size > 1) {
@@ -76,25 +85,87 @@ void splitAsteroid(GameState* state, int index) {
         
         for (int i = 0; i < MAX_ASTEROIDS && created < 2; i++) {
             if (!state->asteroids[i].base.active) {
-                state->asteroids[i].base.active = true;
                 state->asteroids[i].size = newSize;
                 state->asteroids[i].base.radius = 20.0f * newSize;
                 state->asteroids[i].base.x = x;
                 state->asteroids[i].base.y = y;
                 
                 // Random velocity
-                float angle = GetRandomValue(0, 359) * PI / 180.0f;
-                float speed = 1.5f + GetRandomValue(0, 100) / 100.0f;
+                float angle = getGameRandomValue(state, 0, 359) * PI / 180.0f;
+                float speed = 1.5f + getGameRandomValue(state, 0, 100) / 100.0f;
                 state->asteroids[i].base.dx = sin(angle) * speed;
                 state->asteroids[i].base.dy = -cos(angle) * speed;
-                state->asteroids[i].base.angle = GetRandomValue(0, 359);
+                state->asteroids[i].base.angle = getGameRandomValue(state, 0, 359);
+                assignAsteroidMesh(&state->asteroids[i], i);
+                spawnEntity(state, ENTITY_ASTEROID, i);
                 
                 created++;
             }
         }
-        state->asteroidsRemaining++;
-    } else {
-        // Only decrement when the smallest asteroid is destroyed (no split)
-        state->asteroidsRemaining--;
+    }
+}
+
+// Push overlapping asteroids apart and exchange momentum between them
+void resolveAsteroidCollisions(GameState* state) {
+    for (int i = 0; i < MAX_ASTEROIDS; i++) {
+        if (state->asteroids[i].base.active) {
+            for (int j = i + 1; j < MAX_ASTEROIDS; j++) {
+                if (state->asteroids[j].base.active && 
+                    checkCollision(&state->asteroids[i].base, &state->asteroids[j].base)) {
+                    
+                    // Calculate collision response
+                    float dx = state->asteroids[j].base.x - state->asteroids[i].base.x;
+                    float dy = state->asteroids[j].base.y - state->asteroids[i].base.y;
+                    float distance = sqrt(dx * dx + dy * dy);
+                    
+                    // Avoid division by zero
+                    if (distance == 0) distance = 0.01f;
+                    
+                    // Normalize direction
+                    float nx = dx / distance;
+                    float ny = dy / distance;
+                    
+                    // Calculate relative velocity
+                    float dvx = state->asteroids[j].base.dx - state->asteroids[i].base.dx;
+                    float dvy = state->asteroids[j].base.dy - state->asteroids[i].base.dy;
+                    
+                    // Calculate velocity along the normal direction
+                    float velocityAlongNormal = dvx * nx + dvy * ny;
+                    
+                    // Don't resolve if velocities are separating
+                    if (velocityAlongNormal > 0) continue;
+                    
+                    // Calculate restitution (bounciness)
+                    float restitution = 0.8f;
+                    
+                    // Calculate impulse scalar
+                    float impulse = -(1 + restitution) * velocityAlongNormal;
+                    
+                    // Calculate mass ratio based on size
+                    float totalMass = state->asteroids[i].size + state->asteroids[j].size;
+                    float massRatio1 = state->asteroids[j].size / totalMass;
+                    float massRatio2 = state->asteroids[i].size / totalMass;
+                    
+                    // Apply impulse
+                    float impulsex = impulse * nx;
+                    float impulsey = impulse * ny;
+                    
+                    state->asteroids[i].base.dx -= impulsex * massRatio1;
+                    state->asteroids[i].base.dy -= impulsey * massRatio1;
+                    state->asteroids[j].base.dx += impulsex * massRatio2;
+                    state->asteroids[j].base.dy += impulsey * massRatio2;
+                    
+                    // Prevent asteroids from getting stuck together by separating them
+                    float overlap = state->asteroids[i].base.radius + state->asteroids[j].base.radius - distance;
+                    if (overlap > 0) {
+                        // Move asteroids apart based on their size/mass
+                        state->asteroids[i].base.x -= nx * overlap * massRatio1 * 0.5f;
+                        state->asteroids[i].base.y -= ny * overlap * massRatio1 * 0.5f;
+                        state->asteroids[j].base.x += nx * overlap * massRatio2 * 0.5f;
+                        state->asteroids[j].base.y += ny * overlap * massRatio2 * 0.5f;
+                    }
+                }
+            }
+        }
     }
 }
@@ -5,6 +5,32 @@
 //custom headers
 #include "typedefs.h"
 #include "config.h"
+#include "platform.h"
+#include "flightrecorder.h"
+#include "audio.h"
+#include "lifecycle.h"
+
+// Sounds raised by the simulation thread; raylib audio is only driven from the main thread
+typedef struct {
+    int sound;
+    float volumeScale;  // Multiplier on the sound volume setting for this one play
+} QueuedSound;
+
+static QueuedSound soundQueue[SOUND_QUEUE_CAPACITY];
+static volatile int soundQueueHead = 0;  // Next slot the main thread plays
+static volatile int soundQueueTail = 0;  // Next slot the simulation writes
+
+// Destroyed asteroids and enemies are heard; sleeping, expired and cleared ones go quietly
+static void onEntityDespawned(GameState* state, EntityKind kind, int index, DespawnCause cause) {
+    (void)index;
+    if (cause != DESPAWN_SHOT && cause != DESPAWN_DESTROYED) return;
+    
+    if (kind == ENTITY_ASTEROID) {
+        playGameSound(state, SOUND_ASTEROID_HIT);
+    } else if (kind == ENTITY_ENEMY) {
+        playGameSound(state, SOUND_ENEMY_EXPLODE);
+    }
+}
 
 void loadSounds(GameState* state) {
     if (state->soundLoaded) return;
@@ -28,6 +54,7 @@ void loadSounds(GameState* state) {
     }
     
     state->soundLoaded = true;
+    addDespawnListener(onEntityDespawned);
 }
 
 void loadMusic(GameState* state) {
@@ -101,4 +128,41 @@ void unloadMusic(GameState* state) {
         
         state->musicLoaded = false;
     }
+}
+
+// Queue a sound effect at a scaled volume; full queues drop the sound rather than block the simulation
+void playGameSoundScaled(const GameState* state, int sound, float volumeScale) {
+    if (!state->soundLoaded) return;
+    
+    int tail = atomicLoad(&soundQueueTail);
+    int next = (tail + 1) % SOUND_QUEUE_CAPACITY;
+    if (next == atomicLoad(&soundQueueHead)) return;
+    
+    soundQueue[tail] = (QueuedSound){ sound, volumeScale };
+    atomicStore(&soundQueueTail, next);
+}
+
+void playGameSound(const GameState* state, int sound) {
+    playGameSoundScaled(state, sound, 1.0f);
+}
+
+// Play everything the simulation queued since the last frame
+void playQueuedSounds(GameState* state) {
+    int head = atomicLoad(&soundQueueHead);
+    int tail = atomicLoad(&soundQueueTail);
+    
+    while (head != tail) {
+        const QueuedSound* queued = &soundQueue[head];
+        if (queued->volumeScale != 1.0f) {
+            // Set the volume for this play only, then restore it
+            SetSoundVolume(state->sounds[queued->sound], state->soundVolume * queued->volumeScale);
+            PlaySound(state->sounds[queued->sound]);
+            SetSoundVolume(state->sounds[queued->sound], state->soundVolume);
+        } else {
+            PlaySound(state->sounds[queued->sound]);
+        }
+        noteSoundPlayed();
+        head = (head + 1) % SOUND_QUEUE_CAPACITY;
+    }
+    atomicStore(&soundQueueHead, head);
 }
\ No newline at end of file
@@ -0,0 +1,211 @@
+#include "raylib.h"
+#include <stdbool.h>
+#include <stdio.h>
+#include <math.h>
+
+// Custom headers
+#include "typedefs.h"
+#include "config.h"
+#include "background.h"
+#include "culling.h"
+
+#define BACKGROUND_TILES_X ((MAP_WIDTH + BACKGROUND_TILE_SIZE - 1) / BACKGROUND_TILE_SIZE)
+#define BACKGROUND_TILES_Y ((MAP_HEIGHT + BACKGROUND_TILE_SIZE - 1) / BACKGROUND_TILE_SIZE)
+
+// Pre-rendered starfield chunks covering the normal map, repeated across larger worlds,
+// plus the distant star layers
+typedef struct {
+    RenderTexture2D tiles[BACKGROUND_TILES_Y][BACKGROUND_TILES_X];
+    RenderTexture2D parallax[BACKGROUND_PARALLAX_LAYERS];
+    bool parallaxEnabled;
+    bool loaded;
+} Background;
+
+static Background background = {0};
+
+// How far each parallax layer moves relative to the camera (0 = fixed, 1 = world)
+static const float parallaxFactors[BACKGROUND_PARALLAX_LAYERS] = { 0.15f, 0.4f };
+
+// Small deterministic generator so the starfield never touches the gameplay RNG
+static unsigned int starSeed = BACKGROUND_SEED;
+
+static int starRandom(int min, int max) {
+    starSeed ^= starSeed << 13;
+    starSeed ^= starSeed >> 17;
+    starSeed ^= starSeed << 5;
+    return min + (int)(starSeed % (unsigned int)(max - min + 1));
+}
+
+// Draw a handful of stars inside a square area
+static void drawStars(float originX, float originY, int size, int count, unsigned char maxBrightness) {
+    for (int i = 0; i < count; i++) {
+        float x = originX + starRandom(0, size - 1);
+        float y = originY + starRandom(0, size - 1);
+        unsigned char brightness = (unsigned char)starRandom(maxBrightness / 3, maxBrightness);
+        Color starColor = { brightness, brightness, (unsigned char)fminf(255, brightness + 30), 255 };
+        
+        // Most stars are single pixels, a few are slightly bigger
+        if (starRandom(0, 9) == 0) {
+            DrawCircleV((Vector2){ x, y }, 1.5f, starColor);
+        } else {
+            DrawPixelV((Vector2){ x, y }, starColor);
+        }
+    }
+}
+
+// Bake one map tile: stars on a transparent background, so the distant layers show through.
+// The grid and boundary depend on the world size.
+static void bakeMapTile(RenderTexture2D target, int tileX, int tileY) {
+    float originX = tileX * BACKGROUND_TILE_SIZE;
+    float originY = tileY * BACKGROUND_TILE_SIZE;
+    
+    // Camera that maps this tile's world area onto the texture
+    Camera2D tileCamera = { 0 };
+    tileCamera.target = (Vector2){ originX, originY };
+    tileCamera.zoom = 1.0f;
+    
+    BeginTextureMode(target);
+    ClearBackground(BLANK);
+    BeginMode2D(tileCamera);
+    
+    drawStars(originX, originY, BACKGROUND_TILE_SIZE, BACKGROUND_STARS_PER_TILE, 200);
+    
+    EndMode2D();
+    EndTextureMode();
+}
+
+// Bake a tileable layer of faint stars on a transparent background
+static void bakeParallaxLayer(RenderTexture2D target, int layer) {
+    BeginTextureMode(target);
+    ClearBackground(BLANK);
+    drawStars(0, 0, BACKGROUND_TILE_SIZE, BACKGROUND_PARALLAX_STARS, (unsigned char)(90 + layer * 50));
+    EndTextureMode();
+}
+
+void initBackground(void) {
+    if (background.loaded) return;
+    
+    starSeed = BACKGROUND_SEED;
+    
+    for (int y = 0; y < BACKGROUND_TILES_Y; y++) {
+        for (int x = 0; x < BACKGROUND_TILES_X; x++) {
+            background.tiles[y][x] = LoadRenderTexture(BACKGROUND_TILE_SIZE, BACKGROUND_TILE_SIZE);
+            bakeMapTile(background.tiles[y][x], x, y);
+        }
+    }
+    
+    for (int i = 0; i < BACKGROUND_PARALLAX_LAYERS; i++) {
+        background.parallax[i] = LoadRenderTexture(BACKGROUND_TILE_SIZE, BACKGROUND_TILE_SIZE);
+        bakeParallaxLayer(background.parallax[i], i);
+    }
+    
+    background.parallaxEnabled = true;
+    background.loaded = true;
+}
+
+// Draw a render texture (they are stored upside down) at a position
+static void drawRenderTile(RenderTexture2D tile, float x, float y) {
+    Rectangle source = { 0, 0, (float)tile.texture.width, -(float)tile.texture.height };
+    DrawTextureRec(tile.texture, source, (Vector2){ x, y }, WHITE);
+}
+
+// Draw only the top-left width x height of a render texture; the flipped rows of that
+// part sit at the bottom of the texture
+static void drawRenderTilePart(RenderTexture2D tile, float x, float y, float width, float height) {
+    Rectangle source = { 0, (float)tile.texture.height - height, width, -height };
+    DrawTextureRec(tile.texture, source, (Vector2){ x, y }, WHITE);
+}
+
+// Grid lines over the visible part of the world, to help visualize the larger map
+static void drawGrid(Rectangle view, float worldWidth, float worldHeight) {
+    float left = fmaxf(view.x, 0.0f);
+    float top = fmaxf(view.y, 0.0f);
+    float right = fminf(view.x + view.width, worldWidth);
+    float bottom = fminf(view.y + view.height, worldHeight);
+    if (left >= right || top >= bottom) return;
+    
+    for (int x = (int)ceilf(left / GRID_SPACING) * GRID_SPACING; x <= right && x < worldWidth; x += GRID_SPACING) {
+        DrawLine(x, (int)top, x, (int)bottom, GRID_COLOR);
+    }
+    for (int y = (int)ceilf(top / GRID_SPACING) * GRID_SPACING; y <= bottom && y < worldHeight; y += GRID_SPACING) {
+        DrawLine((int)left, y, (int)right, y, GRID_COLOR);
+    }
+}
+
+void renderBackground(Camera2D camera, float worldWidth, float worldHeight) {
+    if (!background.loaded) return;
+    
+    Rectangle view = getCameraView(camera);
+    
+    // Distant star layers first, in screen space, wrapped so they cover the whole view
+    if (background.parallaxEnabled) {
+        for (int i = 0; i < BACKGROUND_PARALLAX_LAYERS; i++) {
+            float scrollX = fmodf(camera.target.x * parallaxFactors[i], BACKGROUND_TILE_SIZE);
+            float scrollY = fmodf(camera.target.y * parallaxFactors[i], BACKGROUND_TILE_SIZE);
+            if (scrollX < 0) scrollX += BACKGROUND_TILE_SIZE;
+            if (scrollY < 0) scrollY += BACKGROUND_TILE_SIZE;
+            
+            for (float y = -scrollY; y < WINDOW_HEIGHT; y += BACKGROUND_TILE_SIZE) {
+                for (float x = -scrollX; x < WINDOW_WIDTH; x += BACKGROUND_TILE_SIZE) {
+                    drawRenderTile(background.parallax[i], x, y);
+                }
+            }
+        }
+    }
+    
+    // Map tiles in world space on top, only the ones the camera can see
+    BeginMode2D(camera);
+    
+    int firstX = (int)floorf(view.x / BACKGROUND_TILE_SIZE);
+    int firstY = (int)floorf(view.y / BACKGROUND_TILE_SIZE);
+    int lastX = (int)floorf((view.x + view.width) / BACKGROUND_TILE_SIZE);
+    int lastY = (int)floorf((view.y + view.height) / BACKGROUND_TILE_SIZE);
+    
+    int tilesX = ((int)worldWidth + BACKGROUND_TILE_SIZE - 1) / BACKGROUND_TILE_SIZE;
+    int tilesY = ((int)worldHeight + BACKGROUND_TILE_SIZE - 1) / BACKGROUND_TILE_SIZE;
+    
+    if (firstX < 0) firstX = 0;
+    if (firstY < 0) firstY = 0;
+    if (lastX > tilesX - 1) lastX = tilesX - 1;
+    if (lastY > tilesY - 1) lastY = tilesY - 1;
+    
+    // Worlds larger than the baked set reuse it; the stars hide the repeat.
+    // Tiles on the far edges are cut at the boundary so no stars land outside the map.
+    for (int y = firstY; y <= lastY; y++) {
+        float tileY = (float)(y * BACKGROUND_TILE_SIZE);
+        float height = fminf(BACKGROUND_TILE_SIZE, worldHeight - tileY);
+        for (int x = firstX; x <= lastX; x++) {
+            float tileX = (float)(x * BACKGROUND_TILE_SIZE);
+            float width = fminf(BACKGROUND_TILE_SIZE, worldWidth - tileX);
+            drawRenderTilePart(background.tiles[y % BACKGROUND_TILES_Y][x % BACKGROUND_TILES_X],
+                               tileX, tileY, width, height);
+        }
+    }
+    
+    drawGrid(view, worldWidth, worldHeight);
+    
+    // Map boundaries
+    DrawRectangleLines(0, 0, (int)worldWidth, (int)worldHeight, BOUNDARY_COLOR);
+    
+    EndMode2D();
+}
+
+void setBackgroundParallax(bool enabled) {
+    background.parallaxEnabled = enabled;
+}
+
+void unloadBackground(void) {
+    if (!background.loaded) return;
+    
+    for (int y = 0; y < BACKGROUND_TILES_Y; y++) {
+        for (int x = 0; x < BACKGROUND_TILES_X; x++) {
+            UnloadRenderTexture(background.tiles[y][x]);
+        }
+    }
+    
+    for (int i = 0; i < BACKGROUND_PARALLAX_LAYERS; i++) {
+        UnloadRenderTexture(background.parallax[i]);
+    }
+    
+    background.loaded = false;
+}
@@ -0,0 +1,234 @@
+#include "raylib.h"
+#include <stdbool.h>
+#include <stdio.h>
+#include <string.h>
+
+// Custom headers
+#include "typedefs.h"
+#include "config.h"
+#include "batch.h"
+#include "simulation.h"
+#include "initialize.h"
+#include "random.h"
+#include "resources.h"
+#include "asteroidmesh.h"
+#include "platform.h"
+#include "memtrack.h"
+#include "bot.h"
+#include "profiler.h"
+
+// One batch step at a time is handed to the workers; each claims a few instances at once
+typedef struct {
+    PlatformThread threads[BATCH_MAX_THREADS];
+    int threadCount;           // Background workers, not counting the caller
+    PlatformMutex lock;
+    PlatformCondition wake;    // A new step is ready
+    PlatformCondition done;    // The last instance of a step finished
+    GameState* instances;
+    InputFrame* inputs;
+    BatchPilot pilot;
+    int count;
+    volatile int next;         // Next unclaimed instance
+    volatile int finished;     // Instances stepped so far this step
+    int generation;            // Bumped per step so sleeping workers know there is work
+    bool quit;
+} BatchWorkers;
+
+static BatchWorkers workers = {0};
+
+void initGameInstance(GameState* state, unsigned int seed, WorldSize world) {
+    memset(state, 0, sizeof(*state));
+    state->world.size = world;
+    state->running = true;
+    
+    // Same start as a trace run with this seed
+    seedGameRandom(state, seed);
+    resetGameData(state);
+    state->screenState = GAME_STATE;
+}
+
+// Step instances until the current step has none left to claim
+static void stepClaimedInstances(void) {
+    for (;;) {
+        int first = atomicAdd(&workers.next, BATCH_CLAIM_SIZE);
+        int count = workers.count;
+        if (first >= count) return;
+        
+        int last = first + BATCH_CLAIM_SIZE < count ? first + BATCH_CLAIM_SIZE : count;
+        for (int i = first; i < last; i++) {
+            GameState* state = &workers.instances[i];
+            if (state->screenState != GAME_STATE) continue;
+            
+            if (workers.pilot != NULL) workers.pilot(state, &workers.inputs[i]);
+            stepGame(state, &workers.inputs[i]);
+        }
+        
+        // Whoever steps the last instance wakes the caller
+        int stepped = last - first;
+        if (atomicAdd(&workers.finished, stepped) + stepped == count) {
+            lockMutex(&workers.lock);
+            signalCondition(&workers.done);
+            unlockMutex(&workers.lock);
+        }
+    }
+}
+
+static int batchWorker(void* arg) {
+    (void)arg;
+    int seen = 0;
+    
+    lockMutex(&workers.lock);
+    for (;;) {
+        while (!workers.quit && workers.generation == seen) {
+            waitCondition(&workers.wake, &workers.lock);
+        }
+        if (workers.quit) break;
+        seen = workers.generation;
+        
+        unlockMutex(&workers.lock);
+        stepClaimedInstances();
+        lockMutex(&workers.lock);
+    }
+    unlockMutex(&workers.lock);
+    return 0;
+}
+
+bool initBatchWorkers(int threads) {
+    if (threads < 1) threads = 1;
+    if (threads > BATCH_MAX_THREADS) threads = BATCH_MAX_THREADS;
+    
+    // Simulations on other threads must never reach the GPU or build meshes lazily
+    setHeadlessResources(true);
+    generateAsteroidMeshes();
+    setSubsystemTiming(false);
+    
+    workers.threadCount = 0;
+    workers.generation = 0;
+    workers.quit = false;
+    atomicStore(&workers.next, 0);
+    atomicStore(&workers.finished, 0);
+    if (!createMutex(&workers.lock) || !createCondition(&workers.wake) || !createCondition(&workers.done)) {
+        printf("Error: Failed to create batch worker locks\n");
+        return false;
+    }
+    
+    for (int i = 0; i < threads - 1; i++) {
+        if (!createThread(&workers.threads[i], batchWorker, NULL)) {
+            printf("Warning: Started %d of %d batch workers\n", i + 1, threads);
+            break;
+        }
+        workers.threadCount++;
+    }
+    return true;
+}
+
+void shutdownBatchWorkers(void) {
+    lockMutex(&workers.lock);
+    workers.quit = true;
+    broadcastCondition(&workers.wake);
+    unlockMutex(&workers.lock);
+    
+    for (int i = 0; i < workers.threadCount; i++) {
+        joinThread(&workers.threads[i]);
+    }
+    workers.threadCount = 0;
+    
+    destroyCondition(&workers.done);
+    destroyCondition(&workers.wake);
+    destroyMutex(&workers.lock);
+}
+
+void stepGameBatch(GameState* instances, InputFrame* inputs, int count, BatchPilot pilot) {
+    if (count <= 0) return;
+    
+    lockMutex(&workers.lock);
+    workers.instances = instances;
+    workers.inputs = inputs;
+    workers.pilot = pilot;
+    workers.count = count;
+    atomicStore(&workers.finished, 0);
+    atomicStore(&workers.next, 0);
+    workers.generation++;
+    broadcastCondition(&workers.wake);
+    unlockMutex(&workers.lock);
+    
+    // The caller works too, then waits for any instances still in flight
+    stepClaimedInstances();
+    
+    lockMutex(&workers.lock);
+    while (atomicLoad(&workers.finished) < count) {
+        waitCondition(&workers.done, &workers.lock);
+    }
+    unlockMutex(&workers.lock);
+}
+
+int runBatch(const BatchOptions* options) {
+    int threads = options->threads > 0 ? options->threads : getProcessorCount();
+    GameState* instances = (GameState*)trackedMalloc(sizeof(GameState) * options->count);
+    InputFrame* inputs = (InputFrame*)trackedCalloc(options->count, sizeof(InputFrame));
+    if (instances == NULL || inputs == NULL) {
+        printf("Error: Could not allocate %d batch instances\n", options->count);
+        trackedFree(instances);
+        trackedFree(inputs);
+        return 1;
+    }
+    if (!initBatchWorkers(threads)) {
+        trackedFree(instances);
+        trackedFree(inputs);
+        return 1;
+    }
+    
+    for (int i = 0; i < options->count; i++) {
+        initGameInstance(&instances[i], options->seed + (unsigned int)i, options->world);
+    }
+    printf("Batch: %d games, up to %d ticks each, %d threads, seeds %u-%u\n", options->count, options->ticks,
+           threads, options->seed, options->seed + (unsigned int)(options->count - 1));
+    
+    double start = getMonotonicTime();
+    long long instanceTicks = 0;
+    int ticks = 0;
+    for (; ticks < options->ticks; ticks++) {
+        int running = 0;
+        for (int i = 0; i < options->count; i++) {
+            if (instances[i].screenState == GAME_STATE) running++;
+        }
+        if (running == 0) break;
+        
+        stepGameBatch(instances, inputs, options->count, updateBotInput);
+        instanceTicks += running;
+    }
+    double elapsed = getMonotonicTime() - start;
+    shutdownBatchWorkers();
+    
+    // Where each game got to: over after losing every life, or still going when time ran out
+    int wavesReached[BATCH_WAVE_BUCKETS] = {0};
+    int gamesOver = 0;
+    double scoreSum = 0.0;
+    double waveSum = 0.0;
+    for (int i = 0; i < options->count; i++) {
+        const GameState* state = &instances[i];
+        int bucket = state->currentWave < BATCH_WAVE_BUCKETS ? state->currentWave : BATCH_WAVE_BUCKETS;
+        wavesReached[bucket - 1]++;
+        if (state->screenState == GAME_OVER_STATE) gamesOver++;
+        scoreSum += state->score;
+        waveSum += state->currentWave;
+    }
+    
+    printf("Batch report: %lld instance-ticks in %.2f s, %.0f instance-ticks/s\n", instanceTicks, elapsed,
+           elapsed > 0.0 ? instanceTicks / elapsed : 0.0);
+    printf("  %d of %d games over after %d ticks, mean wave %.2f, mean score %.1f\n", gamesOver, options->count,
+           ticks, waveSum / options->count, scoreSum / options->count);
+    printf("  %-6s %8s\n", "wave", "games");
+    for (int i = 0; i < BATCH_WAVE_BUCKETS; i++) {
+        if (wavesReached[i] == 0) continue;
+        if (i == BATCH_WAVE_BUCKETS - 1) {
+            printf("  %4d+  %8d\n", i + 1, wavesReached[i]);
+        } else {
+            printf("  %4d   %8d\n", i + 1, wavesReached[i]);
+        }
+    }
+    
+    trackedFree(instances);
+    trackedFree(inputs);
+    return 0;
+}
\ No newline at end of file
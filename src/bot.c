@@ -0,0 +1,79 @@
+#include "raylib.h"
+#include <stdbool.h>
+#include <string.h>
+#include <math.h>
+
+// Custom headers
+#include "typedefs.h"
+#include "config.h"
+#include "bot.h"
+
+// Enemies, asteroids and shots closer than this make the scripted pilot back off
+#define BOT_THREAT_DISTANCE 300.0f
+// Beyond this the pilot closes in on its target
+#define BOT_APPROACH_DISTANCE 600.0f
+
+static void noteNearest(const GameState* state, const GameObject* object, const GameObject** nearest, float* nearestDistance) {
+    if (!object->active) return;
+    
+    float dx = object->x - state->ship.base.x;
+    float dy = object->y - state->ship.base.y;
+    float distance = dx * dx + dy * dy;
+    if (distance < *nearestDistance) {
+        *nearestDistance = distance;
+        *nearest = object;
+    }
+}
+
+// Scripted pilot for traces and batch runs: shoots the nearest enemy (or asteroid), backs away from anything too close
+void updateBotInput(const GameState* state, InputFrame* input) {
+    memset(input, 0, sizeof(*input));
+    
+    const GameObject* target = NULL;
+    float targetDistance = INFINITY;
+    for (int i = 0; i < MAX_ENEMIES; i++) noteNearest(state, &state->enemies[i].base, &target, &targetDistance);
+    if (target == NULL) {
+        for (int i = 0; i < MAX_ASTEROIDS; i++) noteNearest(state, &state->asteroids[i].base, &target, &targetDistance);
+    }
+    
+    const GameObject* threat = NULL;
+    float threatDistance = INFINITY;
+    for (int i = 0; i < MAX_ENEMIES; i++) noteNearest(state, &state->enemies[i].base, &threat, &threatDistance);
+    for (int i = 0; i < MAX_ASTEROIDS; i++) noteNearest(state, &state->asteroids[i].base, &threat, &threatDistance);
+    for (int i = 0; i < MAX_ENEMY_BULLETS; i++) {
+        if (!state->enemyBullets[i].isPlayerBullet) {
+            noteNearest(state, &state->enemyBullets[i].base, &threat, &threatDistance);
+        }
+    }
+    
+    if (target == NULL) return;
+    
+    Vector2 aim = { target->x, target->y };
+    input->mouse = GetWorldToScreen2D(aim, state->camera);
+    input->held |= INPUT_FIRE;
+    
+    if (state->currentWeapon == WEAPON_NORMAL && state->normalAmmo <= 0 && !state->isReloading) {
+        input->pressed |= INPUT_RELOAD;
+    }
+    
+    // Ship-relative directions of the four movement keys, facing the target
+    float facing = atan2f(target->x - state->ship.base.x, -(target->y - state->ship.base.y));
+    float s = sinf(facing);
+    float c = cosf(facing);
+    
+    if (threat != NULL && threatDistance < BOT_THREAT_DISTANCE * BOT_THREAT_DISTANCE) {
+        // Take whichever key moves most directly away from the threat
+        float tx = threat->x - state->ship.base.x;
+        float ty = threat->y - state->ship.base.y;
+        const struct { InputButton button; float dx, dy; } moves[] = {
+            { INPUT_THRUST, s, -c }, { INPUT_REVERSE, -s, c }, { INPUT_STRAFE_LEFT, -c, -s }, { INPUT_STRAFE_RIGHT, c, s }
+        };
+        int best = 0;
+        for (int i = 1; i < 4; i++) {
+            if (moves[i].dx * tx + moves[i].dy * ty < moves[best].dx * tx + moves[best].dy * ty) best = i;
+        }
+        input->held |= moves[best].button;
+    } else if (targetDistance > BOT_APPROACH_DISTANCE * BOT_APPROACH_DISTANCE) {
+        input->held |= INPUT_THRUST;
+    }
+}
\ No newline at end of file
@@ -0,0 +1,164 @@
+#include <stdbool.h>
+#include <stdio.h>
+#include <stdlib.h>
+#include <string.h>
+
+// Custom headers
+#include "typedefs.h"
+#include "config.h"
+#include "cmdline.h"
+
+static const char* scenarioNames[SCENARIO_COUNT] = {
+    [SCENARIO_NONE] = "none",
+    [SCENARIO_ASTEROIDS] = "asteroids",
+    [SCENARIO_SCOUTS] = "scouts",
+    [SCENARIO_TANKS] = "tanks",
+    [SCENARIO_PARTICLES] = "particles",
+    [SCENARIO_POWERUPS] = "powerups"
+};
+
+static const char* asteroidSizeNames[4] = { "mixed", "small", "medium", "large" };
+
+static const char* worldSizeNames[2] = { "normal", "large" };
+
+static void printUsage(const char* program) {
+    printf("Usage: %s [options]\n", program);
+    printf("  --record-trace file [--seed n] [--waves n]   Record a scripted golden trace and exit\n");
+    printf("  --verify-trace file [--tolerance x]          Replay a trace and report the first divergence\n");
+    printf("  --scenario name [--count n] [--frames n] [--seed n] [--size small|medium|large|mixed]\n");
+    printf("      Start straight into a stress load (asteroids, scouts, tanks, particles, powerups),\n");
+    printf("      print frame-time percentiles after the given number of frames and exit\n");
+    printf("  --world normal|large                         Play on the normal map or a 20x larger streamed one\n");
+    printf("  --batch n [--ticks n] [--threads n] [--seed n] [--world normal|large]\n");
+    printf("      Play n headless bot games in parallel, print throughput and the waves reached and exit\n");
+}
+
+// Index of name in names, or -1
+static int findName(const char* name, const char* const* names, int count) {
+    for (int i = 0; i < count; i++) {
+        if (strcmp(name, names[i]) == 0) return i;
+    }
+    return -1;
+}
+
+bool parseLaunchOptions(int argc, char* argv[], LaunchOptions* options) {
+    TraceOptions* trace = &options->trace;
+    trace->mode = TRACE_OFF;
+    trace->path = NULL;
+    trace->seed = TRACE_DEFAULT_SEED;
+    trace->waves = TRACE_DEFAULT_WAVES;
+    trace->tolerance = 0.0f;
+    
+    ScenarioOptions* scenario = &options->scenario;
+    scenario->type = SCENARIO_NONE;
+    scenario->count = 0;
+    scenario->asteroidSize = 0;
+    scenario->frames = SCENARIO_DEFAULT_FRAMES;
+    scenario->seed = SCENARIO_DEFAULT_SEED;
+    
+    BatchOptions* batch = &options->batch;
+    batch->count = 0;
+    batch->ticks = BATCH_DEFAULT_TICKS;
+    batch->threads = 0;
+    batch->seed = BATCH_DEFAULT_SEED;
+    
+    options->world = WORLD_NORMAL;
+    
+    // Every option takes exactly one value
+    for (int i = 1; i < argc; i += 2) {
+        const char* option = argv[i];
+        const char* value = i + 1 < argc ? argv[i + 1] : NULL;
+        if (value == NULL) {
+            printf("Error: %s needs a value\n", option);
+            printUsage(argv[0]);
+            return false;
+        }
+        
+        if (strcmp(option, "--record-trace") == 0) {
+            trace->mode = TRACE_RECORD;
+            trace->path = value;
+        } else if (strcmp(option, "--verify-trace") == 0) {
+            trace->mode = TRACE_VERIFY;
+            trace->path = value;
+        } else if (strcmp(option, "--seed") == 0) {
+            trace->seed = (unsigned int)strtoul(value, NULL, 10);
+            scenario->seed = trace->seed;
+            batch->seed = trace->seed;
+        } else if (strcmp(option, "--waves") == 0) {
+            trace->waves = atoi(value);
+        } else if (strcmp(option, "--tolerance") == 0) {
+            trace->tolerance = (float)atof(value);
+        } else if (strcmp(option, "--scenario") == 0) {
+            int type = findName(value, scenarioNames, SCENARIO_COUNT);
+            if (type <= SCENARIO_NONE) {
+                printf("Error: Unknown scenario %s\n", value);
+                printUsage(argv[0]);
+                return false;
+            }
+            scenario->type = (ScenarioType)type;
+        } else if (strcmp(option, "--count") == 0) {
+            scenario->count = atoi(value);
+        } else if (strcmp(option, "--frames") == 0) {
+            scenario->frames = atoi(value);
+        } else if (strcmp(option, "--size") == 0) {
+            scenario->asteroidSize = findName(value, asteroidSizeNames, 4);
+        } else if (strcmp(option, "--batch") == 0) {
+            batch->count = atoi(value);
+            if (batch->count < 1) {
+                printf("Error: --batch needs at least one instance\n");
+                printUsage(argv[0]);
+                return false;
+            }
+        } else if (strcmp(option, "--ticks") == 0) {
+            batch->ticks = atoi(value);
+        } else if (strcmp(option, "--threads") == 0) {
+            batch->threads = atoi(value);
+        } else if (strcmp(option, "--world") == 0) {
+            int size = findName(value, worldSizeNames, 2);
+            if (size < 0) {
+                printf("Error: Unknown world size %s\n", value);
+                printUsage(argv[0]);
+                return false;
+            }
+            options->world = (WorldSize)size;
+        } else {
+            printf("Error: Unknown option %s\n", option);
+            printUsage(argv[0]);
+            return false;
+        }
+    }
+    
+    if (trace->waves < 1 || trace->tolerance < 0.0f || scenario->frames < 1 || scenario->count < 0 ||
+        scenario->asteroidSize < 0 || batch->ticks < 1 || batch->threads < 0 || batch->threads > BATCH_MAX_THREADS) {
+        printf("Error: Invalid option value\n");
+        printUsage(argv[0]);
+        return false;
+    }
+    if (trace->mode != TRACE_OFF && scenario->type != SCENARIO_NONE) {
+        printf("Error: Traces and scenarios can't run together\n");
+        printUsage(argv[0]);
+        return false;
+    }
+    if (batch->count > 0 && (trace->mode != TRACE_OFF || scenario->type != SCENARIO_NONE)) {
+        printf("Error: Batch runs can't be combined with traces or scenarios\n");
+        printUsage(argv[0]);
+        return false;
+    }
+    if (trace->mode != TRACE_OFF && options->world != WORLD_NORMAL) {
+        printf("Error: Traces always run on the normal world\n");
+        printUsage(argv[0]);
+        return false;
+    }
+    batch->world = options->world;
+    return true;
+}
+
+const char* getScenarioName(ScenarioType type) {
+    if (type < 0 || type >= SCENARIO_COUNT) return "unknown";
+    return scenarioNames[type];
+}
+
+const char* getAsteroidSizeName(int size) {
+    if (size < 0 || size > 3) return "unknown";
+    return asteroidSizeNames[size];
+}
\ No newline at end of file
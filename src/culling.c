@@ -0,0 +1,79 @@
+#include "raylib.h"
+#include <stdbool.h>
+#include <math.h>
+
+// Custom headers
+#include "typedefs.h"
+#include "config.h"
+#include "culling.h"
+
+// Counters for the current frame, reset by resetCullStats()
+static CullStats cullStats = {0};
+
+// Get the world-space rectangle visible through the camera
+Rectangle getCameraView(Camera2D camera) {
+    // Project all four screen corners so zoom and rotation are handled too
+    Vector2 corners[4] = {
+        GetScreenToWorld2D((Vector2){ 0, 0 }, camera),
+        GetScreenToWorld2D((Vector2){ WINDOW_WIDTH, 0 }, camera),
+        GetScreenToWorld2D((Vector2){ 0, WINDOW_HEIGHT }, camera),
+        GetScreenToWorld2D((Vector2){ WINDOW_WIDTH, WINDOW_HEIGHT }, camera)
+    };
+    
+    float minX = corners[0].x, maxX = corners[0].x;
+    float minY = corners[0].y, maxY = corners[0].y;
+    for (int i = 1; i < 4; i++) {
+        minX = fminf(minX, corners[i].x);
+        maxX = fmaxf(maxX, corners[i].x);
+        minY = fminf(minY, corners[i].y);
+        maxY = fmaxf(maxY, corners[i].y);
+    }
+    
+    return (Rectangle){ minX, minY, maxX - minX, maxY - minY };
+}
+
+// Check if a circle overlaps the view (radius is used as the margin)
+bool isCircleInView(Rectangle view, float x, float y, float radius) {
+    return x + radius >= view.x &&
+           x - radius <= view.x + view.width &&
+           y + radius >= view.y &&
+           y - radius <= view.y + view.height;
+}
+
+// Check if a line segment's bounding box overlaps the view
+bool isSegmentInView(Rectangle view, Vector2 start, Vector2 end) {
+    return fmaxf(start.x, end.x) >= view.x &&
+           fminf(start.x, end.x) <= view.x + view.width &&
+           fmaxf(start.y, end.y) >= view.y &&
+           fminf(start.y, end.y) <= view.y + view.height;
+}
+
+// Test a circle against the view and record the result for the debug overlay
+bool cullCircle(Rectangle view, CullCategory category, float x, float y, float radius) {
+    bool visible = isCircleInView(view, x, y, radius);
+    if (visible) {
+        cullStats.drawn[category]++;
+    } else {
+        cullStats.culled[category]++;
+    }
+    return visible;
+}
+
+// Test a line segment against the view and record the result for the debug overlay
+bool cullSegment(Rectangle view, CullCategory category, Vector2 start, Vector2 end) {
+    bool visible = isSegmentInView(view, start, end);
+    if (visible) {
+        cullStats.drawn[category]++;
+    } else {
+        cullStats.culled[category]++;
+    }
+    return visible;
+}
+
+void resetCullStats(void) {
+    cullStats = (CullStats){0};
+}
+
+CullStats getCullStats(void) {
+    return cullStats;
+}
@@ -10,53 +10,71 @@
 // custom headers
 #include "typedefs.h"
 #include "config.h"
+#include "enemies.h"
+#include "audio.h"
 #include "asteroids.h"
 #include "collisions.h"
 #include "initialize.h"
 #include "particles.h"
-#include "powerups.h"
 #include "resources.h"
+#include "governor.h"
+#include "telemetry.h"
+#include "profiler.h"
+#include "flowfield.h"
+#include "world.h"
+#include "random.h"
+#include "timerwheel.h"
+#include "lifecycle.h"
 
 // Forward declarations for new helper functions
-void updateEnemySpawner(GameState* state, float deltaTime);
 float calculateDistanceSquared(float x1, float y1, float x2, float y2);
 float calculateAngleToTarget(float srcX, float srcY, float targetX, float targetY);
-Vector2 calculateAsteroidAvoidance(GameState* state, Enemy* enemy);
-int collectScoutData(GameState* state, Vector2* scoutPositions, int* scoutIndices, int* groupDesires);
-void updateTankBehavior(GameState* state, Enemy* enemy, float deltaTime, float distanceToPlayer, float angleToPlayer, Vector2 avoidVector);
-void updateScoutBehavior(GameState* state, Enemy* enemy, int enemyIndex, float deltaTime, float distanceToPlayer, float angleToPlayer, Vector2 avoidVector, Vector2* scoutPositions, int* scoutIndices, int* groupDesires, int activeScouts);
+void updateTankBehavior(GameState* state, Enemy* enemy, float distanceToPlayer, Vector2 avoidVector);
 void updateEnemyPosition(GameState* state, Enemy* enemy);
 bool handleAsteroidCollisions(GameState* state, Enemy* enemy, int enemyIndex);
 void handleBulletCollisions(GameState* state, Enemy* enemy, int enemyIndex);
-void updateEnemyBullets(GameState* state, float deltaTime);
-void createEnemyExplosion(GameState* state, float x, float y, int particleCount);
+int getEnemyDecisionInterval(float distanceSquared);
+
+// Wandering enemies pick a new direction every few seconds; tanks less often than scouts
+static void scheduleEnemyHeading(GameState* state, int i) {
+    Enemy* enemy = &state->enemies[i];
+    int seconds = enemy->type == ENEMY_TANK ? getGameRandomValue(state, 3, 6) : getGameRandomValue(state, 1, 2);
+    enemy->headingTick = scheduleGameTimer(state, (float)seconds, TIMER_ENEMY_HEADING, i);
+}
+
+// Fresh enemy of the given type in slot i; the caller places it
+static void initEnemy(GameState* state, int i, EnemyType type) {
+    // Initialize enemy properties
+    state->enemies[i].type = type;
+    spawnEntity(state, ENTITY_ENEMY, i);
+    state->enemies[i].base.angle = 0.0f;
+    state->enemies[i].base.dx = 0.0f;
+    state->enemies[i].base.dy = 0.0f;
+    state->enemies[i].fireReadyTick = state->simTick;
+    state->enemies[i].isBursting = false;
+    state->enemies[i].burstCount = 0;
+    state->enemies[i].burstReadyTick = state->simTick;
+    state->enemies[i].moveAngle = getGameRandomValue(state, 0, 359) * PI / 180.0f;
+    scheduleEnemyHeading(state, i);
+    
+    // Set health and radius based on type
+    if (type == ENEMY_TANK) {
+        state->enemies[i].base.radius = TANK_ENEMY_RADIUS;
+        state->enemies[i].health = TANK_ENEMY_HEALTH;
+        state->enemies[i].texture = loadTextureOnce(TANK_TEXTURE_PATH);
+    } else {
+        state->enemies[i].base.radius = SCOUT_ENEMY_RADIUS;
+        state->enemies[i].health = SCOUT_ENEMY_HEALTH;
+        state->enemies[i].texture = loadTextureOnce(SCOUT_TEXTURE_PATH);
+    }
+}
 
 void spawnEnemy(GameState* state, EnemyType type) {
+    Rectangle area = getSpawnArea(state);
+    
     for (int i = 0; i < MAX_ENEMIES; i++) {
         if (!state->enemies[i].base.active) {
-            // Initialize enemy properties
-            state->enemies[i].base.active = true;
-            state->enemies[i].type = type;
-            state->enemies[i].base.angle = 0.0f;
-            state->enemies[i].base.dx = 0.0f;
-            state->enemies[i].base.dy = 0.0f;
-            state->enemies[i].fireTimer = 0.0f;
-            state->enemies[i].isBursting = false;
-            state->enemies[i].burstCount = 0;
-            state->enemies[i].burstTimer = 0.0f;
-            state->enemies[i].moveTimer = 0.0f;
-            state->enemies[i].moveAngle = GetRandomValue(0, 359) * PI / 180.0f;
-            
-            // Set health and radius based on type
-            if (type == ENEMY_TANK) {
-                state->enemies[i].base.radius = TANK_ENEMY_RADIUS;
-                state->enemies[i].health = TANK_ENEMY_HEALTH;
-                state->enemies[i].texture = loadTextureOnce(TANK_TEXTURE_PATH);
-            } else {
-                state->enemies[i].base.radius = SCOUT_ENEMY_RADIUS;
-                state->enemies[i].health = SCOUT_ENEMY_HEALTH;
-                state->enemies[i].texture = loadTextureOnce(SCOUT_TEXTURE_PATH);
-            }
+            initEnemy(state, i, type);
             
             // Try to find a safe spawn location
             bool validPosition = false;
@@ -68,14 +86,14 @@ void spawnEnemy(GameState* state, EnemyType type) {
                 validPosition = true;
                 
                 // Generate random position
-                state->enemies[i].base.x = GetRandomValue(
-                    state->enemies[i].base.radius, 
-                    MAP_WIDTH - state->enemies[i].base.radius
+                state->enemies[i].base.x = getGameRandomValue(state, 
+                    area.x + state->enemies[i].base.radius, 
+                    area.x + area.width - state->enemies[i].base.radius
                 );
                 
-                state->enemies[i].base.y = GetRandomValue(
-                    state->enemies[i].base.radius, 
-                    MAP_HEIGHT - state->enemies[i].base.radius
+                state->enemies[i].base.y = getGameRandomValue(state, 
+                    area.y + state->enemies[i].base.radius, 
+                    area.y + area.height - state->enemies[i].base.radius
                 );
                 
                 // Check distance from player 
@@ -117,14 +135,27 @@ void spawnEnemy(GameState* state, EnemyType type) {
     }
 }
 
+// Enemy of the given type at a fixed spot; false when the pool is full
+bool spawnEnemyAt(GameState* state, EnemyType type, float x, float y) {
+    for (int i = 0; i < MAX_ENEMIES; i++) {
+        if (!state->enemies[i].base.active) {
+            initEnemy(state, i, type);
+            state->enemies[i].base.x = x;
+            state->enemies[i].base.y = y;
+            return true;
+        }
+    }
+    return false;
+}
+
 void fireEnemyWeapon(GameState* state, Enemy* enemy) {
     for (int i = 0; i < MAX_ENEMY_BULLETS; i++) {
         if (!state->enemyBullets[i].base.active) {
-            state->enemyBullets[i].base.active = true;
+            spawnEntity(state, ENTITY_ENEMY_BULLET, i);
             
             // Mark as enemy bullet
             state->enemyBullets[i].isPlayerBullet = false;
-
+            
             // Start the bullet at the enemy's position
             state->enemyBullets[i].base.x = enemy->base.x;
             state->enemyBullets[i].base.y = enemy->base.y;
@@ -133,13 +164,15 @@ void fireEnemyWeapon(GameState* state, Enemy* enemy) {
             // Set bullet properties based on enemy type
             if (enemy->type == ENEMY_TANK) {
                 state->enemyBullets[i].damage = TANK_ENEMY_BULLET_DAMAGE;
+                state->enemyBullets[i].source = DAMAGE_TANK_GRENADE;
                 state->enemyBullets[i].type = BULLET_GRENADE;
-                state->enemyBullets[i].timer = TANK_GRENADE_TIMER;
+                state->enemyBullets[i].fuseTick = scheduleGameTimer(state, TANK_GRENADE_TIMER, TIMER_GRENADE_FUSE, i);
                 state->enemyBullets[i].hasExploded = false;
             } else {
                 state->enemyBullets[i].damage = SCOUT_ENEMY_BULLET_DAMAGE;
+                state->enemyBullets[i].source = DAMAGE_SCOUT_BULLET;
                 state->enemyBullets[i].type = BULLET_NORMAL;
-                state->enemyBullets[i].timer = 0.0f;
+                state->enemyBullets[i].fuseTick = 0;
                 state->enemyBullets[i].hasExploded = false;
             }
             
@@ -148,7 +181,7 @@ void fireEnemyWeapon(GameState* state, Enemy* enemy) {
             float dy = state->ship.base.y - enemy->base.y;
             
             // Add a bit of inaccuracy for scout enemies
-            float inaccuracy = (enemy->type == ENEMY_SCOUT) ? GetRandomValue(-10, 10) * PI / 180.0f : 0;
+            float inaccuracy = (enemy->type == ENEMY_SCOUT) ? getGameRandomValue(state, -10, 10) * PI / 180.0f : 0;
             float angle = atan2(dx, -dy) + inaccuracy;
             
             // Set bullet velocity (slower for grenades)
@@ -159,9 +192,9 @@ void fireEnemyWeapon(GameState* state, Enemy* enemy) {
             // Play shooting sound effect
             if (state->soundLoaded) {
                 if (enemy->type == ENEMY_TANK) {
-                    PlaySound(state->sounds[SOUND_TANK_SHOOT]);
+                    playGameSound(state, SOUND_TANK_SHOOT);
                 } else {
-                    PlaySound(state->sounds[SOUND_SCOUT_SHOOT]);
+                    playGameSound(state, SOUND_SCOUT_SHOOT);
                 }
             }
             
@@ -174,8 +207,9 @@ void explodeGrenade(GameState* state, int grenadeIndex) {
     Bullet* grenade = &state->enemyBullets[grenadeIndex];
     bool isPlayerGrenade = grenade->isPlayerBullet;
     
-    // Create explosion particles
-    for (int i = 0; i < 15; i++) {
+    // Create explosion particles, fewer when the quality governor is shedding load
+    int particleCount = scaleParticleCount(GRENADE_EXPLOSION_PARTICLES);
+    for (int i = 0; i < particleCount; i++) {
         for (int j = 0; j < MAX_PARTICLES; j++) {
             if (!state->particles[j].active) {
                 state->particles[j].active = true;
@@ -184,16 +218,16 @@ void explodeGrenade(GameState* state, int grenadeIndex) {
                 state->particles[j].position.y = grenade->base.y;
                 
                 // Add randomness to particle position
-                state->particles[j].position.x += GetRandomValue(-5, 5);
-                state->particles[j].position.y += GetRandomValue(-5, 5);
+                state->particles[j].position.x += getGameRandomValue(state, -5, 5);
+                state->particles[j].position.y += getGameRandomValue(state, -5, 5);
                 
                 // Set particle velocity outward from explosion center
-                float particleAngle = GetRandomValue(0, 359) * PI / 180.0f;
-                float particleSpeed = PARTICLE_SPEED * GetRandomValue(80, 150) / 100.0f;
+                float particleAngle = getGameRandomValue(state, 0, 359) * PI / 180.0f;
+                float particleSpeed = PARTICLE_SPEED * getGameRandomValue(state, 80, 150) / 100.0f;
                 state->particles[j].velocity.x = cos(particleAngle) * particleSpeed;
                 state->particles[j].velocity.y = sin(particleAngle) * particleSpeed;
                 
-                state->particles[j].radius = GetRandomValue(2, 5);
+                state->particles[j].radius = getGameRandomValue(state, 2, 5);
                 
                 // Orange explosion color for player grenades, red for enemy
                 if (isPlayerGrenade) {
@@ -227,13 +261,14 @@ void explodeGrenade(GameState* state, int grenadeIndex) {
         // Find an available bullet slot
         for (int i = 0; i < MAX_ENEMY_BULLETS; i++) {
             if (!state->enemyBullets[i].base.active) {
-                state->enemyBullets[i].base.active = true;
+                spawnEntity(state, ENTITY_ENEMY_BULLET, i);
                 state->enemyBullets[i].base.x = grenade->base.x;
                 state->enemyBullets[i].base.y = grenade->base.y;
                 state->enemyBullets[i].base.radius = 3.0f;
                 state->enemyBullets[i].damage = explosionDamage;
+                state->enemyBullets[i].source = DAMAGE_GRENADE_BLAST;
                 state->enemyBullets[i].type = BULLET_NORMAL;
-                state->enemyBullets[i].timer = 0.0f;
+                state->enemyBullets[i].fuseTick = 0;
                 state->enemyBullets[i].hasExploded = false;
                 state->enemyBullets[i].isPlayerBullet = isPlayerGrenade; // Maintain player ownership
                 
@@ -248,18 +283,18 @@ void explodeGrenade(GameState* state, int grenadeIndex) {
     
     // Play explosion sound
     if (state->soundLoaded) {
-        PlaySound(state->sounds[SOUND_ENEMY_EXPLODE]);
+        playGameSound(state, SOUND_ENEMY_EXPLODE);
     }
     
     // Mark grenade as exploded and deactivate it
     grenade->hasExploded = true;
-    grenade->base.active = false;
+    despawnEntity(state, ENTITY_ENEMY_BULLET, grenadeIndex, DESPAWN_EXPIRED);
 }
 
 // Main enemy update function refactored into smaller parts
-void updateEnemies(GameState* state, float deltaTime) {
-    // Handle enemy spawning
-    updateEnemySpawner(state, deltaTime);
+void updateEnemies(GameState* state) {
+    // Shared route toward the ship around the asteroid field
+    updateFlowField(state);
     
     // Collect scout data for group behavior - moved from inside the loop
     Vector2 scoutPositions[MAX_ENEMIES];
@@ -268,36 +303,44 @@ void updateEnemies(GameState* state, float deltaTime) {
     int activeScouts = collectScoutData(state, scoutPositions, scoutIndices, groupDesires);
     
     // Process each enemy
+    int updated = 0;
     for (int i = 0; i < MAX_ENEMIES; i++) {
         if (!state->enemies[i].base.active) continue;
         
         Enemy* enemy = &state->enemies[i];
+        updated++;
         
         // Calculate common values once (optimization)
         float distanceSquared = calculateDistanceSquared(
             enemy->base.x, enemy->base.y, 
             state->ship.base.x, state->ship.base.y
         );
-        float distanceToPlayer = sqrt(distanceSquared); // Only calculate sqrt when needed
-        
-        float angleToPlayer = calculateAngleToTarget(
-            enemy->base.x, enemy->base.y,
-            state->ship.base.x, state->ship.base.y
-        );
-        enemy->base.angle = angleToPlayer; // Set enemy facing direction
-        
-        // Calculate asteroid avoidance once
-        Vector2 avoidVector = calculateAsteroidAvoidance(state, enemy);
         
-        // Update enemy based on type
-        if (enemy->type == ENEMY_TANK) {
-            updateTankBehavior(state, enemy, deltaTime, distanceToPlayer, angleToPlayer, avoidVector);
-        } else {
-            updateScoutBehavior(state, enemy, i, deltaTime, distanceToPlayer, angleToPlayer, 
-                                avoidVector, scoutPositions, scoutIndices, groupDesires, activeScouts);
+        // Enemies out of detection range re-decide every few ticks, staggered by slot so each
+        // tick handles an even share of them; they keep their velocity in between
+        int decisionInterval = getEnemyDecisionInterval(distanceSquared);
+        if ((state->simTick + (unsigned int)i) % decisionInterval == 0) {
+            float distanceToPlayer = sqrt(distanceSquared); // Only calculate sqrt when needed
+            
+            float angleToPlayer = calculateAngleToTarget(
+                enemy->base.x, enemy->base.y,
+                state->ship.base.x, state->ship.base.y
+            );
+            enemy->base.angle = angleToPlayer; // Set enemy facing direction
+            
+            // Calculate asteroid avoidance once
+            Vector2 avoidVector = calculateAsteroidAvoidance(state, enemy);
+            
+            // Update enemy based on type
+            if (enemy->type == ENEMY_TANK) {
+                updateTankBehavior(state, enemy, distanceToPlayer, avoidVector);
+            } else {
+                updateScoutBehavior(state, enemy, i, distanceToPlayer, angleToPlayer, 
+                                    avoidVector, scoutPositions, scoutIndices, groupDesires, activeScouts);
+            }
         }
         
-        // Update position with boundary checking
+        // Update position with boundary checking; movement and collisions run every tick at every distance
         updateEnemyPosition(state, enemy);
         
         // Handle collisions
@@ -307,20 +350,27 @@ void updateEnemies(GameState* state, float deltaTime) {
         
         handleBulletCollisions(state, enemy, i);
     }
+    countSubsystemEntities(updated);
     
     // Update enemy bullets
-    updateEnemyBullets(state, deltaTime);
+    updateEnemyBullets(state);
+}
+
+// Ticks between behaviour updates for an enemy this far (squared) from the ship
+int getEnemyDecisionInterval(float distanceSquared) {
+    if (distanceSquared < ENEMY_DETECTION_RADIUS * ENEMY_DETECTION_RADIUS) return 1;
+    if (distanceSquared < AI_LOD_DISTANT_RADIUS * AI_LOD_DISTANT_RADIUS) return AI_LOD_FAR_INTERVAL;
+    return AI_LOD_DISTANT_INTERVAL;
 }
 
-// Enemy spawning logic
-void updateEnemySpawner(GameState* state, float deltaTime) {
-    if (state->currentWave < SCOUT_START_WAVE || state->inWaveTransition) {
+// Timer wheel event: the spawner adds the wave's next enemy and schedules the one after.
+// Spawns wait out the wave transition; startWave schedules the first of the next wave.
+void spawnWaveEnemy(GameState* state, unsigned int deadline) {
+    if (deadline != state->enemySpawnTick || state->currentWave < SCOUT_START_WAVE || state->inWaveTransition) {
         return;
     }
     
-    state->enemySpawnTimer -= deltaTime;
-    
-    if (state->enemySpawnTimer <= 0 && state->enemiesSpawnedThisWave < state->maxEnemiesThisWave) {
+    if (state->enemiesSpawnedThisWave < state->maxEnemiesThisWave) {
         // Determine which enemy type to spawn
         EnemyType type = ENEMY_SCOUT; // Default to scout
         
@@ -330,7 +380,7 @@ void updateEnemySpawner(GameState* state, float deltaTime) {
             tankChance = (tankChance > 50) ? 50 : tankChance; // Cap at 50%
             
             // Roll for tank/scout
-            if (GetRandomValue(1, 100) <= tankChance) {
+            if (getGameRandomValue(state, 1, 100) <= tankChance) {
                 type = ENEMY_TANK;
             }
         }
@@ -348,7 +398,8 @@ void updateEnemySpawner(GameState* state, float deltaTime) {
         // Reset timer with some randomness
         float baseTime = ENEMY_SPAWN_TIME - (state->currentWave - SCOUT_START_WAVE) * 1.0f;
         baseTime = (baseTime < 3.0f) ? 3.0f : baseTime;
-        state->enemySpawnTimer = baseTime + GetRandomValue(-100, 100) / 100.0f;
+        float spawnTime = baseTime + getGameRandomValue(state, -100, 100) / 100.0f;
+        state->enemySpawnTick = scheduleGameTimer(state, spawnTime, TIMER_ENEMY_SPAWN, -1);
     }
 }
 
@@ -431,16 +482,17 @@ int collectScoutData(GameState* state, Vector2* scoutPositions, int* scoutIndice
 }
 
 // Tank enemy behavior update
-void updateTankBehavior(GameState* state, Enemy* enemy, float deltaTime, float distanceToPlayer, float angleToPlayer, Vector2 avoidVector) {
+void updateTankBehavior(GameState* state, Enemy* enemy, float distanceToPlayer, Vector2 avoidVector) {
     float avoidanceMagnitude = sqrt(avoidVector.x * avoidVector.x + avoidVector.y * avoidVector.y);
     
     // Tank moves directly toward player when in detection range
     if (distanceToPlayer < ENEMY_DETECTION_RADIUS) {
         // Move slowly toward player
         if (distanceToPlayer > TANK_ENEMY_ATTACK_DISTANCE) {
-            // Base movement direction toward player
-            float targetDx = TANK_ENEMY_SPEED * sin(angleToPlayer * PI / 180.0f);
-            float targetDy = -TANK_ENEMY_SPEED * cos(angleToPlayer * PI / 180.0f);
+            // Base movement direction follows the flow field toward the player
+            Vector2 route = getFlowDirection(&state->flowField, enemy->base.x, enemy->base.y);
+            float targetDx = TANK_ENEMY_SPEED * route.x;
+            float targetDy = TANK_ENEMY_SPEED * route.y;
             
             // Apply asteroid avoidance
             if (avoidanceMagnitude > 0) {
@@ -466,18 +518,13 @@ void updateTankBehavior(GameState* state, Enemy* enemy, float deltaTime, float d
         }
         
         // Fire at player when close enough
-        enemy->fireTimer -= deltaTime;
-        if (enemy->fireTimer <= 0 && distanceToPlayer < ENEMY_DETECTION_RADIUS) {
+        if (state->simTick >= enemy->fireReadyTick && distanceToPlayer < ENEMY_DETECTION_RADIUS) {
             fireEnemyWeapon(state, enemy);
-            enemy->fireTimer = TANK_ENEMY_FIRE_RATE;
+            enemy->fireReadyTick = state->simTick + ticksFromSeconds(TANK_ENEMY_FIRE_RATE);
         }
     } else {
-        // Random movement when player not detected, still with asteroid avoidance
-        enemy->moveTimer -= deltaTime;
-        if (enemy->moveTimer <= 0) {
-            enemy->moveAngle = GetRandomValue(0, 359) * PI / 180.0f;
-            enemy->moveTimer = GetRandomValue(3, 6);
-        }
+        // Random movement when player not detected, still with asteroid avoidance;
+        // the heading timer changes direction every few seconds
         
         // Base random movement
         float targetDx = TANK_ENEMY_SPEED * 0.5f * cos(enemy->moveAngle);
@@ -494,14 +541,14 @@ void updateTankBehavior(GameState* state, Enemy* enemy, float deltaTime, float d
         enemy->base.dy = enemy->base.dy * 0.8f + targetDy * 0.2f;
         
         // Emit thrust particles occasionally during random movement
-        if (GetRandomValue(0, 10) == 0) {
+        if (getGameRandomValue(state, 0, 10) == 0) {
             emitEnemyThrustParticles(state, enemy, 1);
         }
     }
 }
 
 // Scout enemy behavior update
-void updateScoutBehavior(GameState* state, Enemy* enemy, int enemyIndex, float deltaTime, float distanceToPlayer, 
+void updateScoutBehavior(GameState* state, Enemy* enemy, int enemyIndex, float distanceToPlayer, 
                         float angleToPlayer, Vector2 avoidVector, Vector2* scoutPositions, int* scoutIndices, 
                         int* groupDesires, int activeScouts) {
     float avoidanceMagnitude = sqrt(avoidVector.x * avoidVector.x + avoidVector.y * avoidVector.y);
@@ -579,9 +626,10 @@ void updateScoutBehavior(GameState* state, Enemy* enemy, int enemyIndex, float d
             
             // Approach distance - use wider margins
             if (distanceToPlayer > SCOUT_ENEMY_ATTACK_DISTANCE * 1.3f) {
-                // Move as group toward player, in formation
-                targetDx = SCOUT_ENEMY_SPEED * sin(angleToPlayer * PI / 180.0f);
-                targetDy = -SCOUT_ENEMY_SPEED * cos(angleToPlayer * PI / 180.0f);
+                // Move as group toward player along the flow field, in formation
+                Vector2 route = getFlowDirection(&state->flowField, enemy->base.x, enemy->base.y);
+                targetDx = SCOUT_ENEMY_SPEED * route.x;
+                targetDy = SCOUT_ENEMY_SPEED * route.y;
                 
                 // Calculate formation position based on index
                 float formationOffset = ((enemyIndex % 3) - 1) * 60.0f;
@@ -687,25 +735,25 @@ void updateScoutBehavior(GameState* state, Enemy* enemy, int enemyIndex, float d
             
             // Coordinate firing pattern within group
             if (!enemy->isBursting) {
-                enemy->fireTimer -= deltaTime;
-                if (enemy->fireTimer <= 0 && distanceToPlayer < ENEMY_DETECTION_RADIUS) {
+                if (state->simTick >= enemy->fireReadyTick && distanceToPlayer < ENEMY_DETECTION_RADIUS) {
                     // Start burst with slight timing offsets for group members
                     enemy->isBursting = true;
                     enemy->burstCount = 0;
-                    enemy->burstTimer = SCOUT_ENEMY_BURST_DELAY * (groupSize % 3) * SCOUT_GROUP_ATTACK_DELAY;
+                    float burstDelay = SCOUT_ENEMY_BURST_DELAY * (groupSize % 3) * SCOUT_GROUP_ATTACK_DELAY;
+                    enemy->burstReadyTick = state->simTick + ticksFromSeconds(burstDelay);
                 }
             } else {
-                enemy->burstTimer -= deltaTime;
-                if (enemy->burstTimer <= 0) {
+                if (state->simTick >= enemy->burstReadyTick) {
                     fireEnemyWeapon(state, enemy);
                     enemy->burstCount++;
-                    enemy->burstTimer = SCOUT_ENEMY_BURST_DELAY;
+                    enemy->burstReadyTick = state->simTick + ticksFromSeconds(SCOUT_ENEMY_BURST_DELAY);
                     
                     // End burst after firing enough shots
                     if (enemy->burstCount >= SCOUT_ENEMY_BURST_COUNT) {
                         enemy->isBursting = false;
                         // Set a cooldown between bursts with variance
-                        enemy->fireTimer = SCOUT_ENEMY_FIRE_RATE * 30.0f + (groupSize % 3) * SCOUT_GROUP_ATTACK_DELAY * 5.0f;
+                        float cooldown = SCOUT_ENEMY_FIRE_RATE * 30.0f + (groupSize % 3) * SCOUT_GROUP_ATTACK_DELAY * 5.0f;
+                        enemy->fireReadyTick = state->simTick + ticksFromSeconds(cooldown);
                     }
                 }
             }
@@ -716,9 +764,10 @@ void updateScoutBehavior(GameState* state, Enemy* enemy, int enemyIndex, float d
             
             // Approach distance - use wider margins to prevent rapid state transitions
             if (distanceToPlayer > SCOUT_ENEMY_ATTACK_DISTANCE * 1.3f) {
-                // Move directly toward player
-                targetDx = SCOUT_ENEMY_SPEED * sin(angleToPlayer * PI / 180.0f);
-                targetDy = -SCOUT_ENEMY_SPEED * cos(angleToPlayer * PI / 180.0f);
+                // Move toward player along the flow field
+                Vector2 route = getFlowDirection(&state->flowField, enemy->base.x, enemy->base.y);
+                targetDx = SCOUT_ENEMY_SPEED * route.x;
+                targetDy = SCOUT_ENEMY_SPEED * route.y;
                 
                 // Add asteroid avoidance
                 if (avoidanceMagnitude > 0) {
@@ -781,37 +830,29 @@ void updateScoutBehavior(GameState* state, Enemy* enemy, int enemyIndex, float d
             
             // Standard burst fire logic for solo scouts
             if (!enemy->isBursting) {
-                enemy->fireTimer -= deltaTime;
-                if (enemy->fireTimer <= 0 && distanceToPlayer < ENEMY_DETECTION_RADIUS) {
+                if (state->simTick >= enemy->fireReadyTick && distanceToPlayer < ENEMY_DETECTION_RADIUS) {
                     enemy->isBursting = true;
                     enemy->burstCount = 0;
-                    enemy->burstTimer = 0;
+                    enemy->burstReadyTick = state->simTick + 1;
                 }
             } else {
-                enemy->burstTimer -= deltaTime;
-                if (enemy->burstTimer <= 0) {
+                if (state->simTick >= enemy->burstReadyTick) {
                     fireEnemyWeapon(state, enemy);
                     enemy->burstCount++;
-                    enemy->burstTimer = SCOUT_ENEMY_BURST_DELAY;
+                    enemy->burstReadyTick = state->simTick + ticksFromSeconds(SCOUT_ENEMY_BURST_DELAY);
                     
                     // End burst after firing enough shots
                     if (enemy->burstCount >= SCOUT_ENEMY_BURST_COUNT) {
                         enemy->isBursting = false;
                         // Set a longer cooldown between bursts (3-5 seconds)
-                        enemy->fireTimer = SCOUT_ENEMY_FIRE_RATE * 30.0f + GetRandomValue(0, 20) / 10.0f;
+                        float cooldown = SCOUT_ENEMY_FIRE_RATE * 30.0f + getGameRandomValue(state, 0, 20) / 10.0f;
+                        enemy->fireReadyTick = state->simTick + ticksFromSeconds(cooldown);
                     }
                 }
             }
         }
     } else {
-        // Random movement when player not detected - make it more interesting
-        enemy->moveTimer -= deltaTime;
-        if (enemy->moveTimer <= 0) {
-            // Change direction more often for more erratic movement
-            enemy->moveAngle = GetRandomValue(0, 359) * PI / 180.0f;
-            // Shorter time between movement changes
-            enemy->moveTimer = GetRandomValue(1, 2);
-        }
+        // Random movement when player not detected; scouts change heading more often than tanks
         
         // Base random movement
         float targetDx = SCOUT_ENEMY_SPEED * 0.7f * cos(enemy->moveAngle);
@@ -834,14 +875,14 @@ void updateEnemyPosition(GameState* state, Enemy* enemy) {
     float newX = enemy->base.x + enemy->base.dx;
     float newY = enemy->base.y + enemy->base.dy;
     
-    if (newX - enemy->base.radius >= 0 && newX + enemy->base.radius <= MAP_WIDTH) {
+    if (newX - enemy->base.radius >= 0 && newX + enemy->base.radius <= state->world.width) {
         enemy->base.x = newX;
     } else {
         enemy->base.dx *= -1;
         enemy->moveAngle = PI - enemy->moveAngle;
     }
     
-    if (newY - enemy->base.radius >= 0 && newY + enemy->base.radius <= MAP_HEIGHT) {
+    if (newY - enemy->base.radius >= 0 && newY + enemy->base.radius <= state->world.height) {
         enemy->base.y = newY;
     } else {
         enemy->base.dy *= -1;
@@ -883,27 +924,16 @@ bool handleAsteroidCollisions(GameState* state, Enemy* enemy, int enemyIndex) {
             
             // Change movement direction after collision
             enemy->moveAngle = atan2(-ny, -nx);
-            enemy->moveTimer = GetRandomValue(1, 3);  // Reset movement timer
+            float headingTime = (float)getGameRandomValue(state, 1, 3);  // Reset movement timer
+            enemy->headingTick = scheduleGameTimer(state, headingTime, TIMER_ENEMY_HEADING, enemyIndex);
             
             // Split asteroid on collision
-            splitAsteroid(state, j);
+            splitAsteroid(state, j, DESPAWN_DESTROYED);
             
             // Check if enemy is destroyed
             if (enemy->health <= 0) {
-                // Enemy destroyed by asteroid
-                enemy->base.active = false;
-                
-                // Generate explosion particles
-                createEnemyExplosion(state, enemy->base.x, enemy->base.y, 20);
-                
-                // Play explosion sound
-                if (state->soundLoaded) {
-                    PlaySound(state->sounds[SOUND_ENEMY_EXPLODE]);
-                }
-                
-                // Give player half the score value when asteroid destroys an enemy
-                state->score += (enemy->type == ENEMY_TANK ? TANK_ENEMY_SCORE : SCOUT_ENEMY_SCORE) / 2;
-                
+                // Enemy destroyed by asteroid; the despawn event explodes it for half the score
+                despawnEntity(state, ENTITY_ENEMY, enemyIndex, DESPAWN_DESTROYED);
                 return true;  // Enemy destroyed
             }
             
@@ -920,36 +950,13 @@ void handleBulletCollisions(GameState* state, Enemy* enemy, int enemyIndex) {
         if (!state->bullets[j].active) continue;
         
         if (checkCollision(&enemy->base, &state->bullets[j])) {
-            state->bullets[j].active = false;
+            despawnEntity(state, ENTITY_BULLET, j, DESPAWN_DESTROYED);
             enemy->health -= 10;  // Each player bullet deals 10 damage
+            recordGameTelemetry(state, TELEMETRY_HIT, state->bulletWeapon[j], 0);
             
             if (enemy->health <= 0) {
-                // Enemy destroyed
-                enemy->base.active = false;
-                
-                // Add score based on enemy type
-                state->score += (enemy->type == ENEMY_TANK) ? TANK_ENEMY_SCORE : SCOUT_ENEMY_SCORE;
-                
-                // Check for powerup drops
-                if (enemy->type == ENEMY_SCOUT) {
-                    // Chance to drop shotgun powerup
-                    if (GetRandomValue(1, 100) <= SHOTGUN_DROP_CHANCE) {
-                        spawnShotgunPowerup(state, enemy->base.x, enemy->base.y);
-                    }
-                } else if (enemy->type == ENEMY_TANK) {
-                    // Chance to drop grenade powerup
-                    if (GetRandomValue(1, 100) <= GRENADE_DROP_CHANCE) {
-                        spawnGrenadePowerup(state, enemy->base.x, enemy->base.y);
-                    }
-                }
-                
-                // Play explosion sound
-                if (state->soundLoaded) {
-                    PlaySound(state->sounds[SOUND_ENEMY_EXPLODE]);
-                }
-                
-                // Generate explosion particles
-                createEnemyExplosion(state, enemy->base.x, enemy->base.y, 20);
+                // Enemy destroyed; the despawn event scores it, rolls its drop and explodes it
+                despawnEntity(state, ENTITY_ENEMY, enemyIndex, DESPAWN_SHOT);
             }
             
             break; // Only handle one collision per frame
@@ -959,6 +966,7 @@ void handleBulletCollisions(GameState* state, Enemy* enemy, int enemyIndex) {
 
 // Create enemy explosion particles
 void createEnemyExplosion(GameState* state, float x, float y, int particleCount) {
+    particleCount = scaleParticleCount(particleCount);
     for (int k = 0; k < particleCount; k++) {
         for (int p = 0; p < MAX_PARTICLES; p++) {
             if (!state->particles[p].active) {
@@ -967,18 +975,18 @@ void createEnemyExplosion(GameState* state, float x, float y, int particleCount)
                 state->particles[p].position.x = x;
                 state->particles[p].position.y = y;
                 
-                float particleAngle = GetRandomValue(0, 359) * PI / 180.0f;
-                float particleSpeed = PARTICLE_SPEED * GetRandomValue(50, 150) / 100.0f;
+                float particleAngle = getGameRandomValue(state, 0, 359) * PI / 180.0f;
+                float particleSpeed = PARTICLE_SPEED * getGameRandomValue(state, 50, 150) / 100.0f;
                 state->particles[p].velocity.x = cos(particleAngle) * particleSpeed;
                 state->particles[p].velocity.y = sin(particleAngle) * particleSpeed;
                 
-                state->particles[p].radius = GetRandomValue(2, 6);
+                state->particles[p].radius = getGameRandomValue(state, 2, 6);
                 
                 // Enemy explosion colors - reddish
                 state->particles[p].color = (Color){ 
-                    GetRandomValue(200, 255), 
-                    GetRandomValue(50, 100),
-                    GetRandomValue(0, 50),
+                    getGameRandomValue(state, 200, 255), 
+                    getGameRandomValue(state, 50, 100),
+                    getGameRandomValue(state, 0, 50),
                     255
                 };
                 
@@ -988,30 +996,40 @@ void createEnemyExplosion(GameState* state, float x, float y, int particleCount)
     }
 }
 
+// Timer wheel event: the grenade in this slot burns down, unless it already went off on impact
+void burnGrenadeFuse(GameState* state, int grenadeIndex, unsigned int deadline) {
+    Bullet* grenade = &state->enemyBullets[grenadeIndex];
+    if (!grenade->base.active || grenade->type != BULLET_GRENADE || grenade->hasExploded || grenade->fuseTick != deadline) {
+        return;
+    }
+    explodeGrenade(state, grenadeIndex);
+}
+
+// Timer wheel event: a new wander direction for the enemy in slot i, if it is still the one
+// that scheduled it
+void changeEnemyHeading(GameState* state, int i, unsigned int deadline) {
+    Enemy* enemy = &state->enemies[i];
+    if (!enemy->base.active || enemy->headingTick != deadline) return;
+    
+    enemy->moveAngle = getGameRandomValue(state, 0, 359) * PI / 180.0f;
+    scheduleEnemyHeading(state, i);
+}
+
 // Update enemy bullets with optimized collision detection
-void updateEnemyBullets(GameState* state, float deltaTime) {
+void updateEnemyBullets(GameState* state) {
     for (int i = 0; i < MAX_ENEMY_BULLETS; i++) {
         if (!state->enemyBullets[i].base.active) continue;
         
         Bullet* bullet = &state->enemyBullets[i];
         
-        // Update grenade timer
-        if (bullet->type == BULLET_GRENADE && !bullet->hasExploded) {
-            bullet->timer -= deltaTime;
-            if (bullet->timer <= 0) {
-                explodeGrenade(state, i);
-                continue; // Skip normal bullet update
-            }
-        }
-        
         // Update position
         bullet->base.x += bullet->base.dx;
         bullet->base.y += bullet->base.dy;
         
         // Check if bullet is out of bounds
-        if (bullet->base.x < 0 || bullet->base.x > MAP_WIDTH || 
-            bullet->base.y < 0 || bullet->base.y > MAP_HEIGHT) {
-            bullet->base.active = false;
+        if (bullet->base.x < 0 || bullet->base.x > state->world.width || 
+            bullet->base.y < 0 || bullet->base.y > state->world.height) {
+            despawnEntity(state, ENTITY_ENEMY_BULLET, i, DESPAWN_EXPIRED);
             continue;
         }
         
@@ -1025,14 +1043,12 @@ void updateEnemyBullets(GameState* state, float deltaTime) {
                 if (bullet->type == BULLET_GRENADE && !bullet->hasExploded) {
                     explodeGrenade(state, i);
                 } else {
-                    bullet->base.active = false;
+                    despawnEntity(state, ENTITY_ENEMY_BULLET, i, DESPAWN_DESTROYED);
                 }
-                splitAsteroid(state, j);
-                
-                // Play asteroid hit sound
-                if (state->soundLoaded) {
-                    PlaySound(state->sounds[SOUND_ASTEROID_HIT]);
+                if (bullet->isPlayerBullet) {
+                    recordGameTelemetry(state, TELEMETRY_HIT, WEAPON_GRENADE, 0);
                 }
+                splitAsteroid(state, j, bullet->isPlayerBullet ? DESPAWN_SHOT : DESPAWN_DESTROYED);
                 
                 asteroidHit = true;
                 break;
@@ -1050,41 +1066,19 @@ void updateEnemyBullets(GameState* state, float deltaTime) {
                 if (checkCollision(&bullet->base, &state->enemies[j].base)) {
                     // Deactivate bullet unless it's a grenade that needs to explode
                     if (bullet->type != BULLET_GRENADE || bullet->hasExploded) {
-                        bullet->base.active = false;
+                        despawnEntity(state, ENTITY_ENEMY_BULLET, i, DESPAWN_DESTROYED);
                     } else if (bullet->type == BULLET_GRENADE && !bullet->hasExploded) {
                         explodeGrenade(state, i);
                     }
                     
                     // Apply damage to enemy
                     state->enemies[j].health -= bullet->damage;
+                    recordGameTelemetry(state, TELEMETRY_HIT, WEAPON_GRENADE, 0);
                     
                     // Check if enemy is destroyed
                     if (state->enemies[j].health <= 0) {
-                        // Enemy destroyed
-                        state->enemies[j].base.active = false;
-                        
-                        // Add score based on enemy type
-                        state->score += (state->enemies[j].type == ENEMY_TANK) ? 
-                                        TANK_ENEMY_SCORE : SCOUT_ENEMY_SCORE;
-                        
-                        // Check for powerup drops
-                        if (state->enemies[j].type == ENEMY_SCOUT) {
-                            if (GetRandomValue(1, 100) <= SHOTGUN_DROP_CHANCE) {
-                                spawnShotgunPowerup(state, state->enemies[j].base.x, state->enemies[j].base.y);
-                            }
-                        } else if (state->enemies[j].type == ENEMY_TANK) {
-                            if (GetRandomValue(1, 100) <= GRENADE_DROP_CHANCE) {
-                                spawnGrenadePowerup(state, state->enemies[j].base.x, state->enemies[j].base.y);
-                            }
-                        }
-                        
-                        // Play explosion sound
-                        if (state->soundLoaded) {
-                            PlaySound(state->sounds[SOUND_ENEMY_EXPLODE]);
-                        }
-                        
-                        // Generate explosion particles
-                        createEnemyExplosion(state, state->enemies[j].base.x, state->enemies[j].base.y, 20);
+                        // Enemy destroyed; the despawn event scores it, rolls its drop and explodes it
+                        despawnEntity(state, ENTITY_ENEMY, j, DESPAWN_SHOT);
                     }
                     
                     enemyHit = true;
@@ -1100,12 +1094,13 @@ void updateEnemyBullets(GameState* state, float deltaTime) {
             if (bullet->type == BULLET_GRENADE && !bullet->hasExploded) {
                 explodeGrenade(state, i);
             } else {
-                bullet->base.active = false;
+                despawnEntity(state, ENTITY_ENEMY_BULLET, i, DESPAWN_DESTROYED);
             }
             
             // Only apply damage if player is not invulnerable
             if (!state->isInvulnerable) {
                 state->health -= bullet->damage;
+                recordGameTelemetry(state, TELEMETRY_DAMAGE, bullet->source, bullet->damage);
                 
                 if (state->health <= 0) {
                     state->lives--;
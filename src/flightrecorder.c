@@ -0,0 +1,168 @@
+#include <stdbool.h>
+#include <stdio.h>
+#include <stdlib.h>
+#include <string.h>
+#include <time.h>
+
+// Custom headers
+#include "typedefs.h"
+#include "config.h"
+#include "flightrecorder.h"
+#include "telemetry.h"
+#include "profiler.h"
+#include "iothread.h"
+#include "platform.h"
+#include "memtrack.h"
+
+typedef struct {
+    FlightFrame frames[FLIGHT_RECORDER_FRAMES];
+    int next;                  // Slot the next frame goes into
+    int count;
+    unsigned int frame;
+    double lastFrameEnd;
+    int assetLoads;            // Counted into the frame in progress
+    int soundsPlayed;
+    bool lastGameplay;
+    int hitchIndex;            // Slot of the hitch waiting for its trailing frames, -1 if none
+    int postFrames;            // Frames recorded since that hitch
+    int dumps;
+    char sessionStamp[32];
+} FlightRecorder;
+
+static FlightRecorder recorder = { .hitchIndex = -1 };
+
+typedef struct {
+    char path[96];
+    float budget;
+    int hitch;                 // Position of the hitch within frames
+    int count;
+    FlightFrame frames[];      // Oldest first
+} HitchDumpJob;
+
+static void runHitchDump(void* data) {
+    HitchDumpJob* job = (HitchDumpJob*)data;
+    
+    FILE* file = fopen(job->path, "w");
+    if (file == NULL) {
+        printf("Warning: Could not create hitch dump %s\n", job->path);
+        trackedFree(job);
+        return;
+    }
+    
+    const FlightFrame* hitch = &job->frames[job->hitch];
+    fprintf(file, "# hitch frame %u: %.2f ms against a %.2f ms budget, wave %d\n",
+            hitch->frame, hitch->frameTime * 1000.0f, job->budget * 1000.0f, hitch->wave);
+    
+    fprintf(file, "frame,offset,gameplay,wave,frame_ms,hitch");
+    for (int i = 0; i < SUBSYSTEM_COUNT; i++) fprintf(file, ",%s_ms", getSubsystemName((SubsystemId)i));
+    for (int i = 0; i < TELEMETRY_POOL_COUNT; i++) fprintf(file, ",%s", getTelemetryPoolName((TelemetryPool)i));
+    fprintf(file, ",asset_loads,sounds,allocations\n");
+    
+    for (int f = 0; f < job->count; f++) {
+        const FlightFrame* frame = &job->frames[f];
+        fprintf(file, "%u,%d,%d,%d,%.3f,%d", frame->frame, f - job->hitch, frame->gameplay ? 1 : 0,
+                frame->wave, frame->frameTime * 1000.0f, frame->frameTime > job->budget ? 1 : 0);
+        for (int i = 0; i < SUBSYSTEM_COUNT; i++) fprintf(file, ",%.3f", frame->subsystemTime[i] * 1000.0f);
+        for (int i = 0; i < TELEMETRY_POOL_COUNT; i++) fprintf(file, ",%d", frame->poolCounts[i]);
+        fprintf(file, ",%d,%d,%d\n", frame->assetLoads, frame->soundsPlayed, frame->allocations);
+    }
+    
+    fclose(file);
+    trackedFree(job);
+}
+
+// Copy the window out of the ring and hand it to the I/O thread
+static void queueHitchDump(void) {
+    float budget = HITCH_BUDGET_FACTOR / GAME_FRAME_RATE;
+    int oldest = (recorder.next - recorder.count + FLIGHT_RECORDER_FRAMES) % FLIGHT_RECORDER_FRAMES;
+    const FlightFrame* hitch = &recorder.frames[recorder.hitchIndex];
+    
+    HitchDumpJob* job = (HitchDumpJob*)trackedMalloc(sizeof(HitchDumpJob) + sizeof(FlightFrame) * recorder.count);
+    if (job == NULL) {
+        printf("Error: Failed to allocate hitch dump\n");
+        return;
+    }
+    snprintf(job->path, sizeof(job->path), "%s%s_%u.csv", HITCH_FILE_PREFIX, recorder.sessionStamp, hitch->frame);
+    job->budget = budget;
+    job->hitch = (recorder.hitchIndex - oldest + FLIGHT_RECORDER_FRAMES) % FLIGHT_RECORDER_FRAMES;
+    job->count = recorder.count;
+    for (int i = 0; i < recorder.count; i++) {
+        job->frames[i] = recorder.frames[(oldest + i) % FLIGHT_RECORDER_FRAMES];
+    }
+    
+    printf("Hitch: %.2f ms frame during wave %d, writing %s\n", hitch->frameTime * 1000.0f, hitch->wave, job->path);
+    queueIoJob(runHitchDump, NULL, job);
+    recorder.dumps++;
+}
+
+// Dumps from one session share its start time in their names
+void initFlightRecorder(void) {
+    time_t now = time(NULL);
+    strftime(recorder.sessionStamp, sizeof(recorder.sessionStamp), "%Y%m%d_%H%M%S", localtime(&now));
+    recorder.lastFrameEnd = getMonotonicTime();
+}
+
+// Close out this main loop iteration; snapshot is the one drawn this frame, or NULL outside gameplay.
+// Returns the finished frame, valid until the next call.
+const FlightFrame* endFlightFrame(GameScreenState screenState, const RenderSnapshot* snapshot) {
+    double now = getMonotonicTime();
+    FlightFrame* frame = &recorder.frames[recorder.next];
+    memset(frame, 0, sizeof(*frame));
+    
+    frame->frame = recorder.frame++;
+    frame->frameTime = (float)(now - recorder.lastFrameEnd);
+    frame->gameplay = screenState == GAME_STATE;
+    collectSubsystemTimes(frame->subsystemTime);
+    frame->assetLoads = recorder.assetLoads;
+    frame->soundsPlayed = recorder.soundsPlayed;
+    frame->allocations = getMemoryStats().frameAllocations;
+    recorder.lastFrameEnd = now;
+    recorder.assetLoads = 0;
+    recorder.soundsPlayed = 0;
+    
+    if (snapshot != NULL) {
+        frame->wave = snapshot->currentWave;
+        frame->poolCounts[TELEMETRY_POOL_BULLETS] = snapshot->entities.live[ENTITY_BULLET];
+        frame->poolCounts[TELEMETRY_POOL_ASTEROIDS] = snapshot->entities.live[ENTITY_ASTEROID];
+        frame->poolCounts[TELEMETRY_POOL_ENEMIES] = snapshot->entities.live[ENTITY_ENEMY];
+        frame->poolCounts[TELEMETRY_POOL_ENEMY_BULLETS] = snapshot->entities.live[ENTITY_ENEMY_BULLET];
+        frame->poolCounts[TELEMETRY_POOL_POWERUPS] = snapshot->entities.live[ENTITY_POWERUP];
+        for (int i = 0; i < MAX_PARTICLES; i++) frame->poolCounts[TELEMETRY_POOL_PARTICLES] += snapshot->particles[i].active;
+    }
+    
+    int index = recorder.next;
+    recorder.next = (recorder.next + 1) % FLIGHT_RECORDER_FRAMES;
+    if (recorder.count < FLIGHT_RECORDER_FRAMES) recorder.count++;
+    
+    // Screen changes stall on purpose, so only frames between two gameplay frames count
+    bool gameplayFrame = frame->gameplay && recorder.lastGameplay;
+    recorder.lastGameplay = frame->gameplay;
+    
+    if (recorder.hitchIndex >= 0) {
+        if (++recorder.postFrames >= FLIGHT_RECORDER_POST_FRAMES) {
+            queueHitchDump();
+            recorder.hitchIndex = -1;
+        }
+    } else if (gameplayFrame && recorder.dumps < MAX_HITCH_DUMPS &&
+               frame->frameTime > HITCH_BUDGET_FACTOR / GAME_FRAME_RATE) {
+        recorder.hitchIndex = index;
+        recorder.postFrames = 0;
+    }
+    return frame;
+}
+
+// Write out a hitch still waiting for its trailing frames; call before the I/O thread stops
+void shutdownFlightRecorder(void) {
+    if (recorder.hitchIndex < 0) return;
+    
+    queueHitchDump();
+    recorder.hitchIndex = -1;
+}
+
+void noteAssetLoad(void) {
+    recorder.assetLoads++;
+}
+
+void noteSoundPlayed(void) {
+    recorder.soundsPlayed++;
+}
\ No newline at end of file
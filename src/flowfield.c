@@ -0,0 +1,232 @@
+#include "raylib.h"
+#include <stdbool.h>
+#include <stdlib.h>
+#include <string.h>
+#include <limits.h>
+#include <math.h>
+
+// Custom headers
+#include "typedefs.h"
+#include "config.h"
+#include "flowfield.h"
+
+#define FLOW_STRAIGHT_STEP 10
+#define FLOW_DIAGONAL_STEP 14
+
+static const int neighbourColumns[8] = { 1, -1, 0, 0, 1, 1, -1, -1 };
+static const int neighbourRows[8] = { 0, 0, 1, -1, 1, -1, 1, -1 };
+
+// Open cells ordered by cost; position tracks where each cell sits so costs can drop in place
+typedef struct {
+    int cells[FLOW_FIELD_CELLS];
+    int position[FLOW_FIELD_CELLS];   // -1 when the cell is not in the heap
+    int count;
+} FlowHeap;
+
+static int getFlowCell(const FlowField* field, float x, float y) {
+    int column = (int)((x - field->origin.x) / FLOW_FIELD_CELL_SIZE);
+    int row = (int)((y - field->origin.y) / FLOW_FIELD_CELL_SIZE);
+    if (column < 0) column = 0;
+    if (column >= FLOW_FIELD_COLUMNS) column = FLOW_FIELD_COLUMNS - 1;
+    if (row < 0) row = 0;
+    if (row >= FLOW_FIELD_ROWS) row = FLOW_FIELD_ROWS - 1;
+    return row * FLOW_FIELD_COLUMNS + column;
+}
+
+static void swapHeapEntries(FlowHeap* heap, int a, int b) {
+    int cell = heap->cells[a];
+    heap->cells[a] = heap->cells[b];
+    heap->cells[b] = cell;
+    heap->position[heap->cells[a]] = a;
+    heap->position[heap->cells[b]] = b;
+}
+
+static void siftUp(FlowHeap* heap, const int* cost, int index) {
+    while (index > 0) {
+        int parent = (index - 1) / 2;
+        if (cost[heap->cells[parent]] <= cost[heap->cells[index]]) break;
+        swapHeapEntries(heap, parent, index);
+        index = parent;
+    }
+}
+
+static void siftDown(FlowHeap* heap, const int* cost, int index) {
+    for (;;) {
+        int smallest = index;
+        int left = index * 2 + 1;
+        int right = left + 1;
+        if (left < heap->count && cost[heap->cells[left]] < cost[heap->cells[smallest]]) smallest = left;
+        if (right < heap->count && cost[heap->cells[right]] < cost[heap->cells[smallest]]) smallest = right;
+        if (smallest == index) break;
+        swapHeapEntries(heap, smallest, index);
+        index = smallest;
+    }
+}
+
+static int popCheapestCell(FlowHeap* heap, const int* cost) {
+    int cell = heap->cells[0];
+    heap->position[cell] = -1;
+    heap->count--;
+    if (heap->count > 0) {
+        heap->cells[0] = heap->cells[heap->count];
+        heap->position[heap->cells[0]] = 0;
+        siftDown(heap, cost, 0);
+    }
+    return cell;
+}
+
+// Flag every cell that an asteroid, grown by the clearance margin, overlaps
+static void markAsteroidCells(FlowField* field, const GameState* state) {
+    memset(field->covered, 0, sizeof(field->covered));
+    
+    for (int i = 0; i < MAX_ASTEROIDS; i++) {
+        const GameObject* asteroid = &state->asteroids[i].base;
+        if (!asteroid->active) continue;
+        
+        float reach = asteroid->radius + FLOW_FIELD_CLEARANCE;
+        int firstCell = getFlowCell(field, asteroid->x - reach, asteroid->y - reach);
+        int lastCell = getFlowCell(field, asteroid->x + reach, asteroid->y + reach);
+        for (int row = firstCell / FLOW_FIELD_COLUMNS; row <= lastCell / FLOW_FIELD_COLUMNS; row++) {
+            for (int column = firstCell % FLOW_FIELD_COLUMNS; column <= lastCell % FLOW_FIELD_COLUMNS; column++) {
+                // Closest point of the cell to the asteroid's centre
+                float cellX = field->origin.x + column * FLOW_FIELD_CELL_SIZE;
+                float cellY = field->origin.y + row * FLOW_FIELD_CELL_SIZE;
+                float nearestX = fminf(fmaxf(asteroid->x, cellX), cellX + FLOW_FIELD_CELL_SIZE);
+                float nearestY = fminf(fmaxf(asteroid->y, cellY), cellY + FLOW_FIELD_CELL_SIZE);
+                float dx = nearestX - asteroid->x;
+                float dy = nearestY - asteroid->y;
+                if (dx * dx + dy * dy < reach * reach) {
+                    field->covered[row * FLOW_FIELD_COLUMNS + column] = 1;
+                }
+            }
+        }
+    }
+}
+
+// Dijkstra from the ship's cell; asteroid cells are expensive rather than walls so nothing is cut off
+static void computeFlowCosts(FlowField* field) {
+    FlowHeap heap;
+    heap.count = 0;
+    for (int cell = 0; cell < FLOW_FIELD_CELLS; cell++) {
+        field->cost[cell] = INT_MAX;
+        heap.position[cell] = -1;
+    }
+    
+    field->cost[field->targetCell] = 0;
+    heap.cells[heap.count] = field->targetCell;
+    heap.position[field->targetCell] = heap.count++;
+    
+    while (heap.count > 0) {
+        int cell = popCheapestCell(&heap, field->cost);
+        int column = cell % FLOW_FIELD_COLUMNS;
+        int row = cell / FLOW_FIELD_COLUMNS;
+        
+        for (int n = 0; n < 8; n++) {
+            int nextColumn = column + neighbourColumns[n];
+            int nextRow = row + neighbourRows[n];
+            if (nextColumn < 0 || nextColumn >= FLOW_FIELD_COLUMNS || nextRow < 0 || nextRow >= FLOW_FIELD_ROWS) continue;
+            
+            // Costs run from the ship outwards, so the step is priced by the cell an enemy would leave
+            int next = nextRow * FLOW_FIELD_COLUMNS + nextColumn;
+            int step = n < 4 ? FLOW_STRAIGHT_STEP : FLOW_DIAGONAL_STEP;
+            if (field->covered[next]) step *= FLOW_FIELD_ASTEROID_COST;
+            
+            int cost = field->cost[cell] + step;
+            if (cost >= field->cost[next]) continue;
+            
+            field->cost[next] = cost;
+            if (heap.position[next] < 0) {
+                heap.cells[heap.count] = next;
+                heap.position[next] = heap.count++;
+            }
+            siftUp(&heap, field->cost, heap.position[next]);
+        }
+    }
+}
+
+// Point each cell at its cheapest neighbour
+static void computeFlowDirections(FlowField* field) {
+    const float diagonal = 0.70710678f;
+    
+    for (int cell = 0; cell < FLOW_FIELD_CELLS; cell++) {
+        int column = cell % FLOW_FIELD_COLUMNS;
+        int row = cell / FLOW_FIELD_COLUMNS;
+        int best = -1;
+        int bestCost = field->cost[cell];
+        
+        for (int n = 0; n < 8; n++) {
+            int nextColumn = column + neighbourColumns[n];
+            int nextRow = row + neighbourRows[n];
+            if (nextColumn < 0 || nextColumn >= FLOW_FIELD_COLUMNS || nextRow < 0 || nextRow >= FLOW_FIELD_ROWS) continue;
+            
+            int cost = field->cost[nextRow * FLOW_FIELD_COLUMNS + nextColumn];
+            if (cost < bestCost) {
+                bestCost = cost;
+                best = n;
+            }
+        }
+        
+        if (best < 0) {
+            field->direction[cell] = (Vector2){ 0.0f, 0.0f };
+        } else {
+            float scale = best < 4 ? 1.0f : diagonal;
+            field->direction[cell] = (Vector2){ neighbourColumns[best] * scale, neighbourRows[best] * scale };
+        }
+    }
+}
+
+// Rebuild the field every few ticks, or as soon as the ship crosses into another cell
+void updateFlowField(GameState* state) {
+    FlowField* field = &state->flowField;
+    
+    bool anyEnemies = false;
+    for (int i = 0; i < MAX_ENEMIES && !anyEnemies; i++) {
+        anyEnemies = state->enemies[i].base.active;
+    }
+    if (!anyEnemies) return;
+    
+    // The exact position is kept fresh for enemies close enough to head straight for the ship
+    field->target = (Vector2){ state->ship.base.x, state->ship.base.y };
+    int shipCell = getFlowCell(field, state->ship.base.x, state->ship.base.y);
+    bool stale = !field->valid || shipCell != field->targetCell ||
+                 state->simTick - field->builtTick >= FLOW_FIELD_INTERVAL;
+    if (!stale) return;
+    
+    // A world larger than the grid gets a window centred on the ship, snapped to whole cells
+    float extentX = FLOW_FIELD_COLUMNS * FLOW_FIELD_CELL_SIZE;
+    float extentY = FLOW_FIELD_ROWS * FLOW_FIELD_CELL_SIZE;
+    float originX = floorf((state->ship.base.x - extentX / 2) / FLOW_FIELD_CELL_SIZE) * FLOW_FIELD_CELL_SIZE;
+    float originY = floorf((state->ship.base.y - extentY / 2) / FLOW_FIELD_CELL_SIZE) * FLOW_FIELD_CELL_SIZE;
+    field->origin.x = fmaxf(0.0f, fminf(originX, state->world.width - extentX));
+    field->origin.y = fmaxf(0.0f, fminf(originY, state->world.height - extentY));
+    
+    field->targetCell = getFlowCell(field, state->ship.base.x, state->ship.base.y);
+    field->builtTick = state->simTick;
+    markAsteroidCells(field, state);
+    computeFlowCosts(field);
+    computeFlowDirections(field);
+    field->valid = true;
+}
+
+// Unit heading toward the ship for something at (x, y)
+Vector2 getFlowDirection(const FlowField* field, float x, float y) {
+    int cell = getFlowCell(field, x, y);
+    int column = cell % FLOW_FIELD_COLUMNS;
+    int row = cell / FLOW_FIELD_COLUMNS;
+    int targetColumn = field->targetCell % FLOW_FIELD_COLUMNS;
+    int targetRow = field->targetCell / FLOW_FIELD_COLUMNS;
+    
+    // Next to the ship the grid is too coarse to help, and off the grid it has nothing to say;
+    // head straight for it
+    bool offGrid = x < field->origin.x || y < field->origin.y ||
+                   x >= field->origin.x + FLOW_FIELD_COLUMNS * FLOW_FIELD_CELL_SIZE ||
+                   y >= field->origin.y + FLOW_FIELD_ROWS * FLOW_FIELD_CELL_SIZE;
+    if (!field->valid || offGrid || (abs(column - targetColumn) <= 1 && abs(row - targetRow) <= 1)) {
+        float dx = field->target.x - x;
+        float dy = field->target.y - y;
+        float length = sqrtf(dx * dx + dy * dy);
+        if (length < 0.001f) return (Vector2){ 0.0f, 0.0f };
+        return (Vector2){ dx / length, dy / length };
+    }
+    return field->direction[cell];
+}
\ No newline at end of file
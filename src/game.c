@@ -10,6 +10,7 @@
 // Custom headers
 #include "typedefs.h"
 #include "config.h"
+#include "audio.h"
 #include "collisions.h"
 #include "particles.h"
 #include "enemies.h"
@@ -18,48 +19,97 @@
 #include "powerups.h"
 #include "initialize.h"
 #include "resources.h"
+#include "telemetry.h"
+#include "profiler.h"
+#include "world.h"
+#include "timerwheel.h"
+#include "lifecycle.h"
 
-void updateGame(GameState* state, float deltaTime) {
-    // Update fire timers
-    if (state->fireTimer > 0) {
-        state->fireTimer -= deltaTime;
-    }
-    
-    if (state->shotgunFireTimer > 0) {
-        state->shotgunFireTimer -= deltaTime;
-    }
-    
-    if (state->grenadeFireTimer > 0) {
-        state->grenadeFireTimer -= deltaTime;
-    }
+// The wave is cleared: show the message and start the next one after a pause
+void beginWaveTransition(GameState* state) {
+    state->inWaveTransition = true;
+    state->nextWaveTick = scheduleGameTimer(state, WAVE_DELAY, TIMER_WAVE_START, -1);
+    endWaveTelemetry(state);
+    
+    // Display wave complete message
+    sprintf(state->waveMessage, "WAVE %d COMPLETE", state->currentWave);
+    state->waveMessageEndTick = state->nextWaveTick;
+}
+
+static void finishReload(GameState* state) {
+    state->isReloading = false;
+    state->normalAmmo = MAX_AMMO;
     
-    // Update wave message timer if active
-    if (state->waveMessageTimer > 0) {
-        state->waveMessageTimer -= deltaTime;
+    // Play reload finish sound
+    if (state->soundLoaded) {
+        playGameSound(state, SOUND_RELOAD_FINISH);
     }
-    
-    // Handle wave transitions
-    if (state->inWaveTransition) {
-        state->waveDelayTimer -= deltaTime;
-        if (state->waveDelayTimer <= 0) {
-            state->currentWave++; // Increment wave count
-            startWave(state); // Start the new wave
-            return; // Skip the rest of the update during wave transition
+}
+
+// Ship blinks while invulnerable, then turns solid again
+static void blinkShip(GameState* state) {
+    state->shipVisible = !state->shipVisible;
+    state->blinkTick = scheduleGameTimer(state, BLINK_FREQUENCY, TIMER_BLINK, -1);
+}
+
+static void endInvulnerability(GameState* state) {
+    state->isInvulnerable = false;
+    state->shipVisible = true; // Make sure ship is visible when invulnerability ends
+}
+
+// Fire everything due this tick. Each event first checks that its owner still expects this
+// deadline; timers superseded by a newer one, or whose entity is gone, do nothing.
+static void runGameTimers(GameState* state) {
+    GameTimer timer;
+    while (popExpiredTimer(&state->timers, state->simTick, &timer)) {
+        switch (timer.event) {
+            case TIMER_WAVE_START:
+                if (state->inWaveTransition && timer.deadline == state->nextWaveTick) {
+                    state->currentWave++;
+                    startWave(state);
+                }
+                break;
+            case TIMER_RELOAD:
+                if (state->isReloading && timer.deadline == state->reloadDoneTick) finishReload(state);
+                break;
+            case TIMER_INVULNERABILITY:
+                if (state->isInvulnerable && timer.deadline == state->invulnerabilityEndTick) endInvulnerability(state);
+                break;
+            case TIMER_BLINK:
+                if (state->isInvulnerable && timer.deadline == state->blinkTick) blinkShip(state);
+                break;
+            case TIMER_ENEMY_SPAWN:
+                spawnWaveEnemy(state, timer.deadline);
+                break;
+            case TIMER_POWERUP_EXPIRY:
+                expirePowerup(state, timer.owner, timer.deadline);
+                break;
+            case TIMER_GRENADE_FUSE:
+                burnGrenadeFuse(state, timer.owner, timer.deadline);
+                break;
+            case TIMER_ENEMY_HEADING:
+                changeEnemyHeading(state, timer.owner, timer.deadline);
+                break;
         }
     }
+}
+
+void updateGame(GameState* state, float deltaTime) {
+    // Wave starts, reloads, spawns, fuses and the rest of the gameplay timers
+    runGameTimers(state);
     
     // Update ship
     float newX = state->ship.base.x + state->ship.base.dx;
     float newY = state->ship.base.y + state->ship.base.dy;
     
     // Block ship at boundaries instead of teleporting
-    if (newX - state->ship.base.radius >= 0 && newX + state->ship.base.radius <= MAP_WIDTH) {
+    if (newX - state->ship.base.radius >= 0 && newX + state->ship.base.radius <= state->world.width) {
         state->ship.base.x = newX;
     } else {
         state->ship.base.dx *= -0.5f; // Bounce with reduced speed
     }
     
-    if (newY - state->ship.base.radius >= 0 && newY + state->ship.base.radius <= MAP_HEIGHT) {
+    if (newY - state->ship.base.radius >= 0 && newY + state->ship.base.radius <= state->world.height) {
         state->ship.base.y = newY;
     } else {
         state->ship.base.dy *= -0.5f; // Bounce with reduced speed
@@ -72,48 +122,39 @@ void updateGame(GameState* state, float deltaTime) {
     // Update camera to follow the ship
     state->camera.target = (Vector2){ state->ship.base.x, state->ship.base.y };
     
-    // Handle reloading (only for normal weapon)
-    if (state->isReloading) {
-        // Cancel reload if weapon changed away from normal
-        if (state->currentWeapon != WEAPON_NORMAL) {
-            state->isReloading = false;
-            state->reloadTimer = 0.0f;
-        } else {
-            state->reloadTimer -= deltaTime;
-            if (state->reloadTimer <= 0) {
-                state->isReloading = false;
-                state->normalAmmo = MAX_AMMO;
-                
-                // Play reload finish sound
-                if (state->soundLoaded) {
-                    PlaySound(state->sounds[SOUND_RELOAD_FINISH]);
-                }
-            }
-        }
+    // Wake the sectors the ship is heading into and put the ones behind it to sleep
+    updateWorld(state);
+    
+    // Cancel reload if weapon changed away from normal (only the normal weapon reloads)
+    if (state->isReloading && state->currentWeapon != WEAPON_NORMAL) {
+        state->isReloading = false;
     }
     
+    // Movement and collisions of bullets and asteroids
+    beginSubsystem(SUBSYSTEM_COLLISIONS);
+    int collisionEntities = 0;
+    
     // Update bullets
     for (int i = 0; i < MAX_BULLETS; i++) {
         if (state->bullets[i].active) {
+            collisionEntities++;
+            
             state->bullets[i].x += state->bullets[i].dx;
             state->bullets[i].y += state->bullets[i].dy;
             
             // Check if bullet is out of bounds
-            if (state->bullets[i].x < 0 || state->bullets[i].x > MAP_WIDTH || 
-                state->bullets[i].y < 0 || state->bullets[i].y > MAP_HEIGHT) {
-                state->bullets[i].active = false;
+            if (state->bullets[i].x < 0 || state->bullets[i].x > state->world.width || 
+                state->bullets[i].y < 0 || state->bullets[i].y > state->world.height) {
+                despawnEntity(state, ENTITY_BULLET, i, DESPAWN_EXPIRED);
                 continue;
             }
             
             // Check for collision with asteroids
             for (int j = 0; j < MAX_ASTEROIDS; j++) {
                 if (state->asteroids[j].base.active && checkCollision((GameObject*)&state->bullets[i], &state->asteroids[j].base)) {
-                    state->bullets[i].active = false;
-                    splitAsteroid(state, j);
-                    
-                    // Update score based on asteroid size
-                    state->score += (4 - state->asteroids[j].size) * 100;
-                    
+                    despawnEntity(state, ENTITY_BULLET, i, DESPAWN_DESTROYED);
+                    recordGameTelemetry(state, TELEMETRY_HIT, state->bulletWeapon[i], 0);
+                    splitAsteroid(state, j, DESPAWN_SHOT);
                     break;
                 }
             }
@@ -123,6 +164,8 @@ void updateGame(GameState* state, float deltaTime) {
     // Update asteroids
     for (int i = 0; i < MAX_ASTEROIDS; i++) {
         if (state->asteroids[i].base.active) {
+            collisionEntities++;
+            
             // Update position
             state->asteroids[i].base.x += state->asteroids[i].base.dx;
             state->asteroids[i].base.y += state->asteroids[i].base.dy;
@@ -132,8 +175,8 @@ void updateGame(GameState* state, float deltaTime) {
                 state->asteroids[i].base.x = state->asteroids[i].base.radius;
                 state->asteroids[i].base.dx *= -1;
             }
-            else if (state->asteroids[i].base.x + state->asteroids[i].base.radius > MAP_WIDTH) {
-                state->asteroids[i].base.x = MAP_WIDTH - state->asteroids[i].base.radius;
+            else if (state->asteroids[i].base.x + state->asteroids[i].base.radius > state->world.width) {
+                state->asteroids[i].base.x = state->world.width - state->asteroids[i].base.radius;
                 state->asteroids[i].base.dx *= -1;
             }
             
@@ -141,8 +184,8 @@ void updateGame(GameState* state, float deltaTime) {
                 state->asteroids[i].base.y = state->asteroids[i].base.radius;
                 state->asteroids[i].base.dy *= -1;
             }
-            else if (state->asteroids[i].base.y + state->asteroids[i].base.radius > MAP_HEIGHT) {
-                state->asteroids[i].base.y = MAP_HEIGHT - state->asteroids[i].base.radius;
+            else if (state->asteroids[i].base.y + state->asteroids[i].base.radius > state->world.height) {
+                state->asteroids[i].base.y = state->world.height - state->asteroids[i].base.radius;
                 state->asteroids[i].base.dy *= -1;
             }
             
@@ -157,6 +200,7 @@ void updateGame(GameState* state, float deltaTime) {
                 }
                 
                 state->health -= damage;
+                recordGameTelemetry(state, TELEMETRY_DAMAGE, DAMAGE_ASTEROID, damage);
                 
                 if (state->health <= 0) {
                     state->lives--;
@@ -169,135 +213,35 @@ void updateGame(GameState* state, float deltaTime) {
                 }
                 
                 // Destroy the asteroid that hit the ship
-                splitAsteroid(state, i);
+                splitAsteroid(state, i, DESPAWN_DESTROYED);
                 break;
             }
         }
     }
     
-    // Add collision detection between asteroids
-    for (int i = 0; i < MAX_ASTEROIDS; i++) {
-        if (state->asteroids[i].base.active) {
-            for (int j = i + 1; j < MAX_ASTEROIDS; j++) {
-                if (state->asteroids[j].base.active && 
-                    checkCollision(&state->asteroids[i].base, &state->asteroids[j].base)) {
-                    
-                    // Calculate collision response
-                    float dx = state->asteroids[j].base.x - state->asteroids[i].base.x;
-                    float dy = state->asteroids[j].base.y - state->asteroids[i].base.y;
-                    float distance = sqrt(dx * dx + dy * dy);
-                    
-                    // Avoid division by zero
-                    if (distance == 0) distance = 0.01f;
-                    
-                    // Normalize direction
-                    float nx = dx / distance;
-                    float ny = dy / distance;
-                    
-                    // Calculate relative velocity
-                    float dvx = state->asteroids[j].base.dx - state->asteroids[i].base.dx;
-                    float dvy = state->asteroids[j].base.dy - state->asteroids[i].base.dy;
-                    
-                    // Calculate velocity along the normal direction
-                    float velocityAlongNormal = dvx * nx + dvy * ny;
-                    
-                    // Don't resolve if velocities are separating
-                    if (velocityAlongNormal > 0) continue;
-                    
-                    // Calculate restitution (bounciness)
-                    float restitution = 0.8f;
-                    
-                    // Calculate impulse scalar
-                    float impulse = -(1 + restitution) * velocityAlongNormal;
-                    
-                    // Calculate mass ratio based on size
-                    float totalMass = state->asteroids[i].size + state->asteroids[j].size;
-                    float massRatio1 = state->asteroids[j].size / totalMass;
-                    float massRatio2 = state->asteroids[i].size / totalMass;
-                    
-                    // Apply impulse
-                    float impulsex = impulse * nx;
-                    float impulsey = impulse * ny;
-                    
-                    state->asteroids[i].base.dx -= impulsex * massRatio1;
-                    state->asteroids[i].base.dy -= impulsey * massRatio1;
-                    state->asteroids[j].base.dx += impulsex * massRatio2;
-                    state->asteroids[j].base.dy += impulsey * massRatio2;
-                    
-                    // Prevent asteroids from getting stuck together by separating them
-                    float overlap = state->asteroids[i].base.radius + state->asteroids[j].base.radius - distance;
-                    if (overlap > 0) {
-                        // Move asteroids apart based on their size/mass
-                        state->asteroids[i].base.x -= nx * overlap * massRatio1 * 0.5f;
-                        state->asteroids[i].base.y -= ny * overlap * massRatio1 * 0.5f;
-                        state->asteroids[j].base.x += nx * overlap * massRatio2 * 0.5f;
-                        state->asteroids[j].base.y += ny * overlap * massRatio2 * 0.5f;
-                    }
-                }
-            }
-        }
-    }
-    
-    // Check if all asteroids are destroyed
-    bool allAsteroidsDestroyed = true;
-    state->asteroidsRemaining = 0;
-    for (int i = 0; i < MAX_ASTEROIDS; i++) {
-        if (state->asteroids[i].base.active) {
-            allAsteroidsDestroyed = false;
-            state->asteroidsRemaining++;
-        }
-    }
+    // Bounce asteroids off each other
+    resolveAsteroidCollisions(state);
     
-    // Check enemies too (all must be destroyed to complete wave)
-    bool allEnemiesDestroyed = true;
-    for (int i = 0; i < MAX_ENEMIES; i++) {
-        if (state->enemies[i].base.active) {
-            allEnemiesDestroyed = false;
-        }
-    }
+    countSubsystemEntities(collisionEntities);
+    endSubsystem();
     
-    // If all asteroids are destroyed and either:
-    // 1. We're in a wave before enemies spawn, OR
-    // 2. We've spawned all enemies for this wave AND all enemies are destroyed
-    bool waveComplete = allAsteroidsDestroyed &&
-                       ((state->currentWave < SCOUT_START_WAVE) ||
-                        (state->EnemySpawnComplete && allEnemiesDestroyed));
-                        
-    // If wave is complete, transition to next wave
-    if (waveComplete && !state->inWaveTransition) {
-        state->inWaveTransition = true;
-        state->waveDelayTimer = WAVE_DELAY;
-        
-        // Display wave complete message
-        sprintf(state->waveMessage, "WAVE %d COMPLETE", state->currentWave);
-        state->waveMessageTimer = WAVE_DELAY;
+    // If wave is complete, transition to next wave; the live counts make this a constant-time check
+    if (isWaveCleared(state) && !state->inWaveTransition && !state->waveLocked) {
+        beginWaveTransition(state);
     }
     
     // Update particles
+    beginSubsystem(SUBSYSTEM_PARTICLES);
     updateParticles(state, deltaTime);
+    endSubsystem();
     
     // Update enemies
-    updateEnemies(state, deltaTime);
+    beginSubsystem(SUBSYSTEM_ENEMIES);
+    updateEnemies(state);
+    endSubsystem();
     
     // Update powerups
+    beginSubsystem(SUBSYSTEM_POWERUPS);
     updatePowerups(state, deltaTime);
-    
-    // Update invulnerability timer and blinking effect
-    if (state->isInvulnerable) {
-        // Decrease invulnerability timer
-        state->invulnerabilityTimer -= deltaTime;
-        
-        // Handle blinking effect
-        state->blinkTimer -= deltaTime;
-        if (state->blinkTimer <= 0.0f) {
-            state->shipVisible = !state->shipVisible; // Toggle visibility
-            state->blinkTimer = BLINK_FREQUENCY;
-        }
-        
-        // End invulnerability when timer expires
-        if (state->invulnerabilityTimer <= 0.0f) {
-            state->isInvulnerable = false;
-            state->shipVisible = true; // Make sure ship is visible when invulnerability ends
-        }
-    }
+    endSubsystem();
 }
\ No newline at end of file
@@ -0,0 +1,148 @@
+#include "raylib.h"
+#include <stdbool.h>
+
+// Custom headers
+#include "typedefs.h"
+#include "config.h"
+#include "governor.h"
+#include "background.h"
+#include "viewport.h"
+#include "platform.h"
+
+// What each quality level allows
+typedef struct {
+    float particleScale;
+    float renderScaleCap;
+    bool parallax;
+    bool detail;
+} QualitySettings;
+
+static const QualitySettings qualitySettings[QUALITY_LEVEL_COUNT] = {
+    { 1.0f,  1.0f,  true,  true  },   // QUALITY_HIGH
+    { 0.5f,  0.75f, false, false },   // QUALITY_MEDIUM
+    { 0.25f, 0.5f,  false, false },   // QUALITY_LOW
+};
+
+static const char* qualityNames[QUALITY_LEVEL_COUNT] = { "HIGH", "MEDIUM", "LOW" };
+
+// Rolling frame-time window plus the currently applied level
+typedef struct {
+    float frameTimes[GOVERNOR_SAMPLE_COUNT];
+    float workTimes[GOVERNOR_SAMPLE_COUNT];
+    float frameTimeSum;
+    float workTimeSum;
+    int sampleIndex;
+    int sampleCount;
+    double workStart;
+    float lastWorkTime;
+    float holdTimer;
+    QualityLevel level;
+    volatile int particleLevel;  // Copy of level read by the simulation thread
+    int changes;
+    bool locked;                 // Level pinned by lockQualityLevel
+} Governor;
+
+static Governor governor = {0};
+
+static void setQualityLevel(QualityLevel level) {
+    governor.level = level;
+    atomicStore(&governor.particleLevel, level);
+    setBackgroundParallax(qualitySettings[level].parallax);
+    setRenderScaleCap(qualitySettings[level].renderScaleCap);
+    governor.changes++;
+    governor.holdTimer = GOVERNOR_HOLD_TIME;
+    
+    // Start a fresh window so the new level is judged on its own frames
+    governor.frameTimeSum = 0;
+    governor.workTimeSum = 0;
+    governor.sampleIndex = 0;
+    governor.sampleCount = 0;
+}
+
+// Mark the start of the frame's update and render work
+void beginGovernorFrame(void) {
+    governor.workStart = GetTime();
+}
+
+// Called right before the frame is presented, so waiting for the target FPS isn't counted
+void markGovernorWorkDone(void) {
+    governor.lastWorkTime = (float)(GetTime() - governor.workStart);
+}
+
+// Feed one gameplay frame into the rolling average and adjust quality if needed
+void updateGovernor(float frameTime) {
+    int slot = governor.sampleIndex;
+    if (governor.sampleCount == GOVERNOR_SAMPLE_COUNT) {
+        governor.frameTimeSum -= governor.frameTimes[slot];
+        governor.workTimeSum -= governor.workTimes[slot];
+    } else {
+        governor.sampleCount++;
+    }
+    governor.frameTimes[slot] = frameTime;
+    governor.workTimes[slot] = governor.lastWorkTime;
+    governor.frameTimeSum += frameTime;
+    governor.workTimeSum += governor.lastWorkTime;
+    governor.sampleIndex = (slot + 1) % GOVERNOR_SAMPLE_COUNT;
+    
+    if (governor.locked) return;
+    
+    if (governor.holdTimer > 0) {
+        governor.holdTimer -= frameTime;
+        return;
+    }
+    
+    // Wait for a full window before judging
+    if (governor.sampleCount < GOVERNOR_SAMPLE_COUNT) return;
+    
+    float budget = 1.0f / GAME_FRAME_RATE;
+    float averageFrameTime = governor.frameTimeSum / governor.sampleCount;
+    float averageWorkTime = governor.workTimeSum / governor.sampleCount;
+    
+    // Missing the frame rate because of our own work: shed cosmetic load. Frames that are only
+    // long because the display refreshes slower than the target rate leave the level alone.
+    if (averageFrameTime > budget * GOVERNOR_DEGRADE_RATIO && averageWorkTime > budget * GOVERNOR_BUSY_RATIO &&
+        governor.level < QUALITY_LOW) {
+        setQualityLevel(governor.level + 1);
+    }
+    // Plenty of headroom: bring quality back
+    else if (averageWorkTime < budget * GOVERNOR_RESTORE_RATIO && governor.level > QUALITY_HIGH) {
+        setQualityLevel(governor.level - 1);
+    }
+}
+
+// Pin the quality level so benchmark runs don't change what they draw halfway through
+void lockQualityLevel(QualityLevel level) {
+    if (level != governor.level) setQualityLevel(level);
+    governor.locked = true;
+}
+
+// Scale a particle emission count by the current quality level, keeping at least one
+int scaleParticleCount(int count) {
+    if (count <= 0) return 0;
+    
+    int level = atomicLoad(&governor.particleLevel);
+    int scaled = (int)(count * qualitySettings[level].particleScale + 0.5f);
+    return scaled < 1 ? 1 : scaled;
+}
+
+// Whether expensive decorative and debug layers should be drawn
+bool governorAllowsDetail(void) {
+    return qualitySettings[governor.level].detail;
+}
+
+GovernorStats getGovernorStats(void) {
+    GovernorStats stats = {0};
+    stats.level = governor.level;
+    if (governor.sampleCount > 0) {
+        stats.averageFrameTime = governor.frameTimeSum / governor.sampleCount;
+        stats.averageWorkTime = governor.workTimeSum / governor.sampleCount;
+    }
+    stats.particleScale = qualitySettings[governor.level].particleScale;
+    stats.renderScaleCap = qualitySettings[governor.level].renderScaleCap;
+    stats.changes = governor.changes;
+    return stats;
+}
+
+const char* getQualityName(QualityLevel level) {
+    return qualityNames[level];
+}
\ No newline at end of file
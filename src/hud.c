@@ -0,0 +1,344 @@
+#include "raylib.h"
+#include <stdbool.h>
+#include <stdio.h>
+#include <string.h>
+
+// Custom headers
+#include "typedefs.h"
+#include "config.h"
+#include "hud.h"
+#include "layers.h"
+
+// Everything the cached HUD layer depends on; any change triggers a re-render
+typedef struct {
+    int score;
+    int lives;
+    int health;
+    WeaponType weapon;
+    int normalAmmo;
+    int shotgunAmmo;
+    int grenadeAmmo;
+    bool isReloading;
+    int reloadTenths;
+    int currentWave;
+    int asteroidsRemaining;
+    int enemiesRemaining;
+    int maxEnemiesThisWave;
+} HudKey;
+
+// Retained HUD layers plus the keys they were last rendered with
+typedef struct {
+    RenderTexture2D layer;
+    RenderTexture2D waveMessageLayer;
+    HudKey key;
+    char waveMessage[64];
+    int waveMessageWidth;
+    bool dirty;
+    bool loaded;
+} Hud;
+
+static Hud hud = {0};
+static HudStats hudStats = {0};
+
+// Count enemies still to be fought this wave (active + not yet spawned)
+static int countEnemiesRemaining(const RenderSnapshot* state) {
+    int enemiesRemaining = 0;
+    for (int i = 0; i < MAX_ENEMIES; i++) {
+        if (state->enemies[i].base.active) {
+            enemiesRemaining++;
+        }
+    }
+    
+    // Calculate enemies that haven't been spawned yet
+    int enemiesNotYetSpawned = 0;
+    if (state->maxEnemiesThisWave > state->enemiesSpawnedThisWave) {
+        enemiesNotYetSpawned = state->maxEnemiesThisWave - state->enemiesSpawnedThisWave;
+    }
+    
+    return enemiesRemaining + enemiesNotYetSpawned;
+}
+
+static HudKey buildHudKey(const RenderSnapshot* state) {
+    HudKey key;
+    memset(&key, 0, sizeof(key)); // Zero padding so keys can be compared with memcmp
+    key.score = state->score;
+    key.lives = state->lives;
+    key.health = state->health;
+    key.weapon = state->currentWeapon;
+    key.normalAmmo = state->normalAmmo;
+    key.shotgunAmmo = state->shotgunAmmo;
+    key.grenadeAmmo = state->grenadeAmmo;
+    key.isReloading = state->isReloading;
+    // The reload text only shows tenths of a second, so finer changes don't matter
+    key.reloadTenths = state->isReloading ? (int)(state->reloadTimer * 10.0f) : 0;
+    key.currentWave = state->currentWave;
+    key.asteroidsRemaining = state->asteroidsRemaining;
+    if (state->currentWave >= SCOUT_START_WAVE) {
+        key.enemiesRemaining = countEnemiesRemaining(state);
+        key.maxEnemiesThisWave = state->maxEnemiesThisWave;
+    }
+    return key;
+}
+
+// Draw the static HUD elements into the cached layer
+static void renderHudLayer(const RenderSnapshot* state) {
+    beginCachedLayer(hud.layer);
+    
+    // Draw score and lives
+    DrawText(TextFormat("Score: %d", state->score), 10, 10, 20, WHITE);
+
+    if (state->lives > 1) {
+        DrawText(TextFormat("Lives: %d", state->lives), 10, 40, 20, WHITE);
+    } else {
+        DrawText(TextFormat("Lives: %d", state->lives), 10, 40, 20, RED);
+    }
+    
+    // Draw health bar
+    int barWidth = 200;
+    int barHeight = 20;
+    int barX = WINDOW_WIDTH - barWidth - 20;
+    int barY = 8;
+    
+    // Background of health bar
+    DrawRectangle(barX, barY, barWidth, barHeight, GRAY);
+    
+    // Calculate health percentage
+    float healthPercent = (float)state->health / MAX_HEALTH;
+    int currentHealthWidth = (int)(barWidth * healthPercent);
+    
+    // Pick color based on health level
+    Color healthColor;
+    if (healthPercent > 0.7f) healthColor = GREEN;
+    else if (healthPercent > 0.3f) healthColor = YELLOW;
+    else healthColor = RED;
+    
+    // Draw the filled part of the health bar
+    DrawRectangle(barX, barY, currentHealthWidth, barHeight, healthColor);
+    
+    // Draw border around health bar
+    DrawRectangleLines(barX, barY, barWidth, barHeight, WHITE);
+    
+    // Draw health text
+    DrawText(TextFormat("Health: %d/%d", state->health, MAX_HEALTH), barX, barY + barHeight + 5, 15, WHITE);
+    
+    // Draw ammo counter
+    int ammoY = 70; // Position below lives
+    
+    // Get current weapon ammo info
+    int currentAmmo, maxAmmo;
+    const char* weaponName;
+    
+    if (state->currentWeapon == WEAPON_SHOTGUN) {
+        currentAmmo = state->shotgunAmmo;
+        maxAmmo = SHOTGUN_MAX_AMMO;
+        weaponName = "SHOTGUN";
+    } else if (state->currentWeapon == WEAPON_GRENADE) {
+        currentAmmo = state->grenadeAmmo;
+        maxAmmo = GRENADE_MAX_AMMO;
+        weaponName = "GRENADE";
+    } else {
+        currentAmmo = state->normalAmmo;
+        maxAmmo = MAX_AMMO;
+        weaponName = "RIFLE";
+    }
+    
+    if (state->isReloading && state->currentWeapon == WEAPON_NORMAL) {
+        // Draw reload timer text
+        DrawText(TextFormat("RELOADING: %.1f", state->reloadTimer), 10, ammoY, 20, RED);
+        
+        // Draw reload progress bar - positioned directly below the text
+        int reloadBarWidth = 150;
+        int reloadBarHeight = 15;
+        int reloadBarX = 10; // Align with text
+        int reloadBarY = ammoY + 25; // Position below text with some spacing
+        
+        // Background of reload bar
+        DrawRectangle(reloadBarX, reloadBarY, reloadBarWidth, reloadBarHeight, GRAY);
+        
+        // The filled part and border are drawn live in drawHud so the bar animates smoothly
+    } else {
+        // Draw ammo count with weapon type
+        Color ammoColor = currentAmmo > (maxAmmo / 4) ? WHITE : RED;
+        DrawText(TextFormat("%s: %d/%d", weaponName, currentAmmo, maxAmmo), 10, ammoY, 20, ammoColor);
+        
+        // Draw ammo indicators as small rectangles - positioned below the text
+        int ammoRectSize = 5;
+        int ammoRectSpacing = 3;
+        int ammoStartX = 10; // Align with text
+        int ammoIndicatorY = ammoY + 30; // Position below text with some spacing
+        
+        // Draw ammo indicators
+        for (int i = 0; i < maxAmmo; i++) {
+            Color rectColor;
+            if (i < currentAmmo) {
+                if (state->currentWeapon == WEAPON_SHOTGUN) {
+                    rectColor = GREEN;
+                } else if (state->currentWeapon == WEAPON_GRENADE) {
+                    rectColor = ORANGE;
+                } else {
+                    rectColor = YELLOW;
+                }
+            } else {
+                rectColor = DARKGRAY;
+            }
+            
+            DrawRectangle(
+                ammoStartX + (i * (ammoRectSize + ammoRectSpacing)), 
+                ammoIndicatorY, 
+                ammoRectSize, 
+                ammoRectSize, 
+                rectColor
+            );
+        }
+    }
+    
+    // Draw weapon indicator
+    int weaponIndicatorY = ammoY + 50;
+    const char* weaponText;
+    Color weaponColor;
+    
+    if (state->currentWeapon == WEAPON_SHOTGUN) {
+        weaponText = "WEAPON: SHOTGUN";
+        weaponColor = GREEN;
+    } else if (state->currentWeapon == WEAPON_GRENADE) {
+        weaponText = "WEAPON: GRENADE";
+        weaponColor = ORANGE;
+    } else {
+        weaponText = "WEAPON: RIFLE";
+        weaponColor = WHITE;
+    }
+    
+    DrawText(weaponText, 10, weaponIndicatorY, 18, weaponColor);
+
+    // Draw wave counter in bottom right
+    DrawText(TextFormat("Wave: %d", state->currentWave), 
+             WINDOW_WIDTH - MeasureText(TextFormat("Wave: %d", state->currentWave), 20) - 10,
+             WINDOW_HEIGHT - 30,
+             20, WHITE);
+             
+
+    DrawText(TextFormat("Asteroids: %d", state->asteroidsRemaining),
+            WINDOW_WIDTH - MeasureText(TextFormat("Asteroids: %d", state->asteroidsRemaining), 20) - 10,
+            WINDOW_HEIGHT - 60,
+            20, WHITE);
+    
+    // Draw enemies counter (only if we're in a wave that has enemies)
+    if (state->currentWave >= SCOUT_START_WAVE) {
+        // Total remaining = currently active + not yet spawned
+        int totalEnemiesRemaining = hud.key.enemiesRemaining;
+        
+        DrawText(TextFormat("Enemies: %d/%d", totalEnemiesRemaining, state->maxEnemiesThisWave),
+                WINDOW_WIDTH - MeasureText(TextFormat("Enemies: %d/%d", totalEnemiesRemaining, state->maxEnemiesThisWave), 20) - 10,
+                WINDOW_HEIGHT - 90,
+                20, WHITE);
+    }
+    
+    endCachedLayer();
+    hudStats.renders++;
+}
+
+// Draw the wave message at full opacity; drawHud fades it with a tint
+static void renderWaveMessageLayer(const RenderSnapshot* state) {
+    int fontSize = 40;
+    hud.waveMessageWidth = MeasureText(state->waveMessage, fontSize);
+    
+    beginCachedLayer(hud.waveMessageLayer);
+    
+    // Draw with semi-transparent background for better visibility
+    DrawRectangle(WINDOW_WIDTH/2 - hud.waveMessageWidth/2 - 10,
+                  WINDOW_HEIGHT/2 - fontSize/2 - 10,
+                  hud.waveMessageWidth + 20, fontSize + 20,
+                  (Color){0, 0, 0, 127});
+                
+    DrawText(state->waveMessage,
+            WINDOW_WIDTH/2 - hud.waveMessageWidth/2,
+            WINDOW_HEIGHT/2 - fontSize/2,
+            fontSize,
+            WHITE);
+    
+    endCachedLayer();
+    
+    strncpy(hud.waveMessage, state->waveMessage, sizeof(hud.waveMessage) - 1);
+    hud.waveMessage[sizeof(hud.waveMessage) - 1] = '\0';
+    hudStats.waveMessageRenders++;
+}
+
+void initHud(void) {
+    if (hud.loaded) return;
+    
+    hud.layer = LoadRenderTexture(WINDOW_WIDTH, WINDOW_HEIGHT);
+    hud.waveMessageLayer = LoadRenderTexture(WINDOW_WIDTH, WINDOW_HEIGHT);
+    hud.waveMessage[0] = '\0';
+    hud.dirty = true;
+    hud.loaded = true;
+}
+
+void invalidateHud(void) {
+    hud.dirty = true;
+    hud.waveMessage[0] = '\0';
+}
+
+// Must be called outside BeginTextureMode, before the frame starts drawing
+void updateHud(const RenderSnapshot* state) {
+    if (!hud.loaded) return;
+    
+    HudKey key = buildHudKey(state);
+    if (hud.dirty || memcmp(&key, &hud.key, sizeof(key)) != 0) {
+        hud.key = key;
+        renderHudLayer(state);
+        hud.dirty = false;
+    }
+    
+    if (state->waveMessageTimer > 0 && strcmp(state->waveMessage, hud.waveMessage) != 0) {
+        renderWaveMessageLayer(state);
+    }
+}
+
+void drawHud(const RenderSnapshot* state) {
+    if (!hud.loaded) return;
+    
+    hudStats.frames++;
+    drawCachedLayer(hud.layer, (Vector2){ 0, 0 }, 255);
+    
+    // Reload progress changes every frame, so only the bar fill is drawn live
+    if (state->isReloading && state->currentWeapon == WEAPON_NORMAL) {
+        int reloadBarWidth = 150;
+        int reloadBarHeight = 15;
+        int reloadBarX = 10;
+        int reloadBarY = 70 + 25;
+        
+        // Calculate reload progress percentage
+        float reloadPercent = 1.0f - (state->reloadTimer / RELOAD_TIME);
+        int currentReloadWidth = (int)(reloadBarWidth * reloadPercent);
+        
+        // Draw the filled part of the reload bar
+        DrawRectangle(reloadBarX, reloadBarY, currentReloadWidth, reloadBarHeight, ORANGE);
+        
+        // Draw border around reload bar
+        DrawRectangleLines(reloadBarX, reloadBarY, reloadBarWidth, reloadBarHeight, WHITE);
+    }
+    
+    // Draw wave message if timer is active
+    if (state->waveMessageTimer > 0) {
+        // Calculate alpha for fade-out effect
+        unsigned char alpha = (unsigned char)(255.0f * (state->waveMessageTimer > 1.0f ? 
+                                                       1.0f : state->waveMessageTimer));
+        drawCachedLayer(hud.waveMessageLayer, (Vector2){ 0, 0 }, alpha);
+    }
+}
+
+HudStats getHudStats(void) {
+    return hudStats;
+}
+
+void resetHudStats(void) {
+    hudStats = (HudStats){0};
+}
+
+void unloadHud(void) {
+    if (!hud.loaded) return;
+    
+    UnloadRenderTexture(hud.layer);
+    UnloadRenderTexture(hud.waveMessageLayer);
+    hud.loaded = false;
+}
\ No newline at end of file
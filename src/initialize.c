@@ -12,15 +12,20 @@
 #include "config.h"
 #include "audio.h"
 #include "asteroids.h"
+#include "asteroidmesh.h"
+#include "world.h"
+#include "random.h"
+#include "timerwheel.h"
+#include "lifecycle.h"
 
 void startWave(GameState* state) {
     // Clear any remaining asteroids and enemies
     for (int i = 0; i < MAX_ASTEROIDS; i++) {
-        state->asteroids[i].base.active = false;
+        despawnEntity(state, ENTITY_ASTEROID, i, DESPAWN_CLEARED);
     }
     
     for (int i = 0; i < MAX_ENEMIES; i++) {
-        state->enemies[i].base.active = false;
+        despawnEntity(state, ENTITY_ENEMY, i, DESPAWN_CLEARED);
     }
     
     // Calculate asteroid count based on wave
@@ -30,23 +35,15 @@ void startWave(GameState* state) {
     // Create asteroids
     createAsteroids(state, asteroidCount);
     
-    // Count active asteroids
-    state->asteroidsRemaining = 0;
-    for (int i = 0; i < MAX_ASTEROIDS; i++) {
-        if (state->asteroids[i].base.active) {
-            state->asteroidsRemaining++;
-        }
-    }
-    
     // Reset enemy spawn timer based on wave
     if (state->currentWave >= SCOUT_START_WAVE) {
         // Enemies should spawn faster in higher waves
         float spawnTime = ENEMY_SPAWN_TIME - (state->currentWave - SCOUT_START_WAVE) * 1.0f;
         // Ensure spawn time doesn't go below minimum
-        state->enemySpawnTimer = (spawnTime > 3.0f) ? spawnTime : 3.0f;
+        state->enemySpawnTick = scheduleGameTimer(state, (spawnTime > 3.0f) ? spawnTime : 3.0f, TIMER_ENEMY_SPAWN, -1);
     } else {
         // No enemies should spawn before their start wave
-        state->enemySpawnTimer = FLT_MAX;
+        state->enemySpawnTick = 0;
     }
     
     // Reset enemy spawn counter for new wave
@@ -64,7 +61,7 @@ void startWave(GameState* state) {
     
     // Display wave message
     sprintf(state->waveMessage, "WAVE %d", state->currentWave);
-    state->waveMessageTimer = 3.0f;  // Show message for 3 seconds
+    state->waveMessageEndTick = state->simTick + ticksFromSeconds(3.0f);  // Show message for 3 seconds
     
     // Debug output to verify wave transition
     if (state->Debug) {
@@ -72,14 +69,17 @@ void startWave(GameState* state) {
     }
     
     state->inWaveTransition = false;
+    state->waveStartTick = state->simTick;
 }
 
 void initMenuAsteroids(GameState* state) {
     for (int i = 0; i < MAX_MENU_ASTEROIDS; i++) {
         state->menuAsteroids[i].active = true;
         
-        // Randomize asteroid size
+        // Randomize asteroid size and outline
         state->menuAsteroids[i].radius = GetRandomValue(15, 40);
+        state->menuAsteroids[i].meshId = acquireAsteroidMesh(getMenuAsteroidSizeClass(state->menuAsteroids[i].radius),
+                                                             (unsigned int)GetRandomValue(0, 32767));
         
         // Start positions - either off-screen from left, right, top or bottom
         int side = GetRandomValue(0, 3); // 0: top, 1: right, 2: bottom, 3: left
@@ -122,13 +122,16 @@ void initMenuAsteroids(GameState* state) {
 }
 
 void initGameState(GameState* state) {
+    // Each session plays differently; traces and scenarios reseed before they start
+    seedGameRandom(state, (unsigned int)time(NULL));
+    
     // Initialize to default values
     state->score = 0;
     state->lives = 3;
     state->health = MAX_HEALTH;
-    state->reloadTimer = 0.0f;
+    state->reloadDoneTick = 0;
     state->isReloading = false;
-    state->fireTimer = 0.0f;
+    state->fireReadyTick = 0;
     state->running = true;
     state->Debug = false;
     state->screenState = MENU_STATE;
@@ -137,20 +140,22 @@ void initGameState(GameState* state) {
     state->musicLoaded = false;
     state->currentMusic = NULL;  // Initialize the pointer to NULL
     state->currentWave = 1;
-    state->asteroidsRemaining = 0;
-    state->waveDelayTimer = 0.0f;
+    state->nextWaveTick = 0;
     state->inWaveTransition = false;
     state->waveMessage[0] = '\0';
-    state->waveMessageTimer = 0.0f;
+    state->waveMessageEndTick = 0;
     state->soundVolume = 0.5f;  // Default to half volume for sound
     state->musicVolume = 0.2f;  // Default to 20% volume for music
     state->isDraggingSlider = false;
     state->isDraggingMusicSlider = false;
-    state->invulnerabilityTimer = 0.0f;
+    state->invulnerabilityEndTick = 0;
     state->isInvulnerable = false;
-    state->blinkTimer = 0.0f;
+    state->blinkTick = 0;
     state->shipVisible = true;
     
+    // Nothing is scheduled yet; startWave below adds the first spawn
+    resetTimerWheel(&state->timers, state->simTick);
+    
     // Load sounds
     loadSounds(state);
     
@@ -162,9 +167,12 @@ void initGameState(GameState* state) {
     state->camera.rotation = 0.0f;
     state->camera.offset = (Vector2){ WINDOW_WIDTH/2, WINDOW_HEIGHT/2 };
     
+    // Size the map; a large world starts with every sector ungenerated
+    resetWorld(state);
+    
     // Initialize ship
-    state->ship.base.x = MAP_WIDTH / 2;
-    state->ship.base.y = MAP_HEIGHT / 2;
+    state->ship.base.x = state->world.width / 2;
+    state->ship.base.y = state->world.height / 2;
     state->ship.base.dx = 0;
     state->ship.base.dy = 0;
     state->ship.base.angle = 0;
@@ -202,17 +210,16 @@ void initGameState(GameState* state) {
         state->powerups[i].base.active = false;
         state->powerups[i].texture = (Texture2D){0};
     }
+    recountEntities(state);
     
     // Initialize weapon system
     state->currentWeapon = WEAPON_NORMAL;
     state->normalAmmo = MAX_AMMO;
     state->shotgunAmmo = 0;
     state->grenadeAmmo = 0;
-    state->fireTimer = 0.0f;
-    state->shotgunFireTimer = 0.0f;
-    state->grenadeFireTimer = 0.0f;
-    
-    state->enemySpawnTimer = ENEMY_SPAWN_TIME;
+    state->fireReadyTick = 0;
+    state->shotgunReadyTick = 0;
+    state->grenadeReadyTick = 0;
     
     // Initialize menu background asteroids
     initMenuAsteroids(state);
@@ -226,30 +233,36 @@ void resetGameData(GameState* state) {
     state->score = 0;
     state->lives = 3;
     state->health = MAX_HEALTH;
-    state->reloadTimer = 0.0f;
+    state->reloadDoneTick = 0;
     state->isReloading = false;
-    state->fireTimer = 0.0f;
+    state->fireReadyTick = 0;
     state->Debug = false;
     state->currentWave = 1;
-    state->asteroidsRemaining = 0;
-    state->waveDelayTimer = 0.0f;
+    state->nextWaveTick = 0;
     state->inWaveTransition = false;
     state->waveMessage[0] = '\0';
-    state->waveMessageTimer = 0.0f;
+    state->waveMessageEndTick = 0;
     state->isDraggingSlider = false;
-    state->invulnerabilityTimer = 0.0f;
+    state->invulnerabilityEndTick = 0;
     state->isInvulnerable = false;
-    state->blinkTimer = 0.0f;
+    state->blinkTick = 0;
     state->shipVisible = true;
+    state->simTick = 0;
+    resetTimerWheel(&state->timers, state->simTick);
+    state->waveLocked = false;
+    state->flowField.valid = false;
     
     // Initialize camera
     state->camera.zoom = 1.0f;
     state->camera.rotation = 0.0f;
     state->camera.offset = (Vector2){ WINDOW_WIDTH/2, WINDOW_HEIGHT/2 };
     
+    // Size the map; a large world starts with every sector ungenerated
+    resetWorld(state);
+    
     // Initialize ship
-    state->ship.base.x = MAP_WIDTH / 2;
-    state->ship.base.y = MAP_HEIGHT / 2;
+    state->ship.base.x = state->world.width / 2;
+    state->ship.base.y = state->world.height / 2;
     state->ship.base.dx = 0;
     state->ship.base.dy = 0;
     state->ship.base.angle = 0;
@@ -286,6 +299,7 @@ void resetGameData(GameState* state) {
     for (int i = 0; i < MAX_POWERUPS; i++) {
         state->powerups[i].base.active = false;
     }
+    recountEntities(state);
     
     // Reset weapon system
     state->currentWeapon = WEAPON_NORMAL;
@@ -293,12 +307,10 @@ void resetGameData(GameState* state) {
     state->shotgunAmmo = 0;
     state->grenadeAmmo = 0;
     state->isReloading = false;
-    state->reloadTimer = 0.0f;
-    state->fireTimer = 0.0f;
-    state->shotgunFireTimer = 0.0f;
-    state->grenadeFireTimer = 0.0f;
-    
-    state->enemySpawnTimer = ENEMY_SPAWN_TIME;
+    state->reloadDoneTick = 0;
+    state->fireReadyTick = 0;
+    state->shotgunReadyTick = 0;
+    state->grenadeReadyTick = 0;
 
     for (int i = 0; i < MAX_ENEMIES; i++) {
         state->enemies[i].base.active = false;
@@ -309,8 +321,8 @@ void resetGameData(GameState* state) {
 }
 
 void resetShip(GameState* state) {
-    state->ship.base.x = MAP_WIDTH / 2;
-    state->ship.base.y = MAP_HEIGHT / 2;
+    state->ship.base.x = state->world.width / 2;
+    state->ship.base.y = state->world.height / 2;
     state->ship.base.dx = 0;
     state->ship.base.dy = 0;
     state->ship.base.angle = 0;
@@ -321,8 +333,8 @@ void resetShip(GameState* state) {
     state->isReloading = false; // Stop reloading
     // Activate invulnerability when ship respawns
     state->isInvulnerable = true;
-    state->invulnerabilityTimer = INVULNERABILITY_TIME;
+    state->invulnerabilityEndTick = scheduleGameTimer(state, INVULNERABILITY_TIME, TIMER_INVULNERABILITY, -1);
     state->shipVisible = true;
-    state->blinkTimer = 0.0f;
+    state->blinkTick = scheduleGameTimer(state, 0.0f, TIMER_BLINK, -1);
 }
 
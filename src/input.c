@@ -16,42 +16,71 @@
 #include "initialize.h"
 #include "scoreboard.h"
 #include "resources.h"
+#include "pacing.h"
+#include "viewport.h"
+#include "governor.h"
+#include "telemetry.h"
+#include "random.h"
+#include "timerwheel.h"
+#include "game.h"
+#include "lifecycle.h"
 
-void handleInput(GameState* state) {
+// Read the gameplay keys and cursor on the main thread for the simulation to replay
+void sampleGameInput(InputFrame* frame) {
+    frame->held = 0;
+    frame->pressed = 0;
+    
+    if (IsKeyDown(KEY_W)) frame->held |= INPUT_THRUST;
+    if (IsKeyDown(KEY_A)) frame->held |= INPUT_STRAFE_LEFT;
+    if (IsKeyDown(KEY_D)) frame->held |= INPUT_STRAFE_RIGHT;
+    if (IsKeyDown(KEY_S)) frame->held |= INPUT_REVERSE;
+    if (IsMouseButtonDown(MOUSE_LEFT_BUTTON)) frame->held |= INPUT_FIRE;
+    
+    if (IsKeyPressed(KEY_ESCAPE) || IsKeyPressed(KEY_P)) frame->pressed |= INPUT_PAUSE;
+    if (IsKeyPressed(KEY_R)) frame->pressed |= INPUT_RELOAD;
+    if (IsKeyPressed(KEY_F3)) frame->pressed |= INPUT_TOGGLE_DEBUG;
+    if (IsKeyPressed(KEY_F4)) frame->pressed |= INPUT_KILL_ASTEROIDS;
+    if (IsKeyPressed(KEY_F5)) frame->pressed |= INPUT_KILL_ENEMIES;
+    if (IsKeyPressed(KEY_F6)) frame->pressed |= INPUT_SKIP_WAVE;
+    
+    frame->mouse = GetMousePosition();
+}
+
+void handleInput(GameState* state, const InputFrame* input) {
     // BUG FIX: Add pause functionality
-    if (IsKeyPressed(KEY_ESCAPE) || IsKeyPressed(KEY_P)) {
+    if (input->pressed & INPUT_PAUSE) {
         state->screenState = PAUSE_STATE;
         return; // Exit early to prevent other input processing
     }
     
     // Get mouse position in world space for ship aiming
-    Vector2 mousePosition = GetScreenToWorld2D(GetMousePosition(), state->camera);
+    state->aimPosition = GetScreenToWorld2D(input->mouse, state->camera);
     
     // Calculate direction from ship to mouse cursor
-    float dx = mousePosition.x - state->ship.base.x;
-    float dy = mousePosition.y - state->ship.base.y;
+    float dx = state->aimPosition.x - state->ship.base.x;
+    float dy = state->aimPosition.y - state->ship.base.y;
     
     // Update ship angle to point toward cursor
     state->ship.base.angle = atan2(dx, -dy) * 180.0f / PI;
     
     // Handle mouse click for firing with weapon-specific timing
-    if (IsMouseButtonDown(MOUSE_LEFT_BUTTON)) {
+    if (input->held & INPUT_FIRE) {
         // Check weapon-specific fire rate
         if (state->currentWeapon == WEAPON_SHOTGUN) {
             // Shotgun has its own cooldown timer
-            if (state->shotgunFireTimer <= 0) {
+            if (state->simTick >= state->shotgunReadyTick) {
                 fireWeapon(state);
             }
         } else if (state->currentWeapon == WEAPON_GRENADE) {
             // Grenade has its own cooldown timer
-            if (state->grenadeFireTimer <= 0) {
+            if (state->simTick >= state->grenadeReadyTick) {
                 fireWeapon(state);
             }
         } else {
             // Normal weapon uses the general fire timer
-            if (state->fireTimer <= 0) {
+            if (state->simTick >= state->fireReadyTick) {
                 fireWeapon(state);
-                state->fireTimer = FIRE_RATE; // Set the cooldown timer for normal weapon
+                state->fireReadyTick = state->simTick + getWeaponCooldownTicks(FIRE_RATE);
             }
         }
     }
@@ -59,11 +88,11 @@ void handleInput(GameState* state) {
     // Debug mode keybindings - only active when debug mode is on
     if (state->Debug) {
         // F4: Kill all asteroids
-        if (IsKeyPressed(KEY_F4)) {
+        if (input->pressed & INPUT_KILL_ASTEROIDS) {
             int destroyedCount = 0;
             for (int i = 0; i < MAX_ASTEROIDS; i++) {
                 if (state->asteroids[i].base.active) {
-                    state->asteroids[i].base.active = false;
+                    despawnEntity(state, ENTITY_ASTEROID, i, DESPAWN_CLEARED);
                     destroyedCount++;
                 }
             }
@@ -71,12 +100,13 @@ void handleInput(GameState* state) {
         }
         
         // F5: Kill all enemies
-        if (IsKeyPressed(KEY_F5)) {
+        if (input->pressed & INPUT_KILL_ENEMIES) {
             int destroyedCount = 0;
             for (int i = 0; i < MAX_ENEMIES; i++) {
                 if (state->enemies[i].base.active) {
                     // Create explosion particles for visual feedback
-                    for (int k = 0; k < 20; k++) {
+                    int particleCount = scaleParticleCount(ENEMY_EXPLOSION_PARTICLES);
+                    for (int k = 0; k < particleCount; k++) {
                         for (int p = 0; p < MAX_PARTICLES; p++) {
                             if (!state->particles[p].active) {
                                 state->particles[p].active = true;
@@ -84,16 +114,16 @@ void handleInput(GameState* state) {
                                 state->particles[p].position.x = state->enemies[i].base.x;
                                 state->particles[p].position.y = state->enemies[i].base.y;
                                 
-                                float particleAngle = GetRandomValue(0, 359) * PI / 180.0f;
-                                float particleSpeed = PARTICLE_SPEED * GetRandomValue(50, 150) / 100.0f;
+                                float particleAngle = getGameRandomValue(state, 0, 359) * PI / 180.0f;
+                                float particleSpeed = PARTICLE_SPEED * getGameRandomValue(state, 50, 150) / 100.0f;
                                 state->particles[p].velocity.x = cos(particleAngle) * particleSpeed;
                                 state->particles[p].velocity.y = sin(particleAngle) * particleSpeed;
                                 
-                                state->particles[p].radius = GetRandomValue(2, 6);
+                                state->particles[p].radius = getGameRandomValue(state, 2, 6);
                                 state->particles[p].color = (Color){ 
-                                    GetRandomValue(200, 255), 
-                                    GetRandomValue(50, 100),
-                                    GetRandomValue(0, 50),
+                                    getGameRandomValue(state, 200, 255), 
+                                    getGameRandomValue(state, 50, 100),
+                                    getGameRandomValue(state, 0, 50),
                                     255
                                 };
                                 break;
@@ -101,7 +131,7 @@ void handleInput(GameState* state) {
                         }
                     }
                     
-                    state->enemies[i].base.active = false;
+                    despawnEntity(state, ENTITY_ENEMY, i, DESPAWN_CLEARED);
                     destroyedCount++;
                 }
             }
@@ -109,21 +139,16 @@ void handleInput(GameState* state) {
         }
         
         // F6: Skip to next wave
-        if (IsKeyPressed(KEY_F6)) {
+        if (input->pressed & INPUT_SKIP_WAVE) {
             // Force transition to the next wave
-            state->inWaveTransition = true;
-            state->waveDelayTimer = WAVE_DELAY;
-            
-            // Display wave complete message
-            sprintf(state->waveMessage, "WAVE %d COMPLETE", state->currentWave);
-            state->waveMessageTimer = WAVE_DELAY;
+            beginWaveTransition(state);
             
             printf("Debug: Skipping to wave %d\n", state->currentWave + 1);
         }
     }
     
     // Continuous key presses
-    if (IsKeyDown(KEY_W)) {
+    if (input->held & INPUT_THRUST) {
         // Accelerate ship in the direction it's facing
         state->ship.base.dx += SHIP_ACCELERATION * sin(state->ship.base.angle * PI / 180.0f);
         state->ship.base.dy -= SHIP_ACCELERATION * cos(state->ship.base.angle * PI / 180.0f);
@@ -139,38 +164,38 @@ void handleInput(GameState* state) {
         }
     }
     
-    if (IsKeyDown(KEY_A)) {
+    if (input->held & INPUT_STRAFE_LEFT) {
         // Strafe left (perpendicular to the ship's facing direction)
         state->ship.base.dx -= SHIP_ACCELERATION * 0.8f * cos(state->ship.base.angle * PI / 180.0f);
         state->ship.base.dy -= SHIP_ACCELERATION * 0.8f * sin(state->ship.base.angle * PI / 180.0f);
     }
     
-    if (IsKeyDown(KEY_D)) {
+    if (input->held & INPUT_STRAFE_RIGHT) {
         // Strafe right (perpendicular to the ship's facing direction)
         state->ship.base.dx += SHIP_ACCELERATION * 0.8f * cos(state->ship.base.angle * PI / 180.0f);
         state->ship.base.dy += SHIP_ACCELERATION * 0.8f * sin(state->ship.base.angle * PI / 180.0f);
     }
     
-    if (IsKeyDown(KEY_S)) {
+    if (input->held & INPUT_REVERSE) {
         // Decelerate/reverse
         state->ship.base.dx -= SHIP_ACCELERATION * 0.7f * sin(state->ship.base.angle * PI / 180.0f);
         state->ship.base.dy += SHIP_ACCELERATION * 0.7f * cos(state->ship.base.angle * PI / 180.0f);
     }
 
-    if (IsKeyPressed(KEY_R)) {
+    if (input->pressed & INPUT_RELOAD) {
         // Reload ammo (only for normal weapon)
         if (!state->isReloading && state->normalAmmo < MAX_AMMO && state->currentWeapon == WEAPON_NORMAL) {
             state->isReloading = true;
-            state->reloadTimer = RELOAD_TIME;
+            state->reloadDoneTick = scheduleGameTimer(state, RELOAD_TIME, TIMER_RELOAD, -1);
             
             // Play reload start sound
             if (state->soundLoaded) {
-                PlaySound(state->sounds[SOUND_RELOAD_START]);
+                playGameSound(state, SOUND_RELOAD_START);
             }
         }
     }
 
-    if (IsKeyPressed(KEY_F3)) {
+    if (input->pressed & INPUT_TOGGLE_DEBUG) {
         // Toggle debug mode
         state->Debug = !state->Debug;
     }
@@ -301,7 +326,7 @@ void updateMenuAsteroids(GameState* state, float deltaTime) {
 
 void handleMenuInput(GameState* state) {
     // Update menu background asteroids
-    updateMenuAsteroids(state, GetFrameTime());
+    updateMenuAsteroids(state, getPacedFrameTime());
     
     Vector2 mousePoint = GetMousePosition();
     
@@ -430,6 +455,11 @@ void handleOptionsInput(GameState* state) {
         state->screenState = state->previousScreenState;  
     }
     
+    // Cycle the internal render resolution if the render scale button is clicked
+    if (CheckCollisionPointRec(mousePoint, state->renderScaleButton) && IsMouseButtonReleased(MOUSE_LEFT_BUTTON)) {
+        cycleRenderScale();
+    }
+    
     Rectangle adjustedMusicSliderRect = {
         state->musicVolumeSlider.x,
         state->musicVolumeSlider.y + 40, 
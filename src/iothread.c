@@ -0,0 +1,144 @@
+#include <stdbool.h>
+#include <stdio.h>
+#include <stdlib.h>
+
+// Custom headers
+#include "iothread.h"
+#include "platform.h"
+#include "memtrack.h"
+#include "profiler.h"
+
+// A queued job: run() executes on the I/O thread, then complete() on the main thread.
+// Whichever of the two runs last owns data and frees it.
+typedef struct IoJob {
+    IoJobFunc run;
+    IoJobFunc complete;
+    void* data;
+    struct IoJob* next;
+} IoJob;
+
+// First-in first-out list of jobs
+typedef struct {
+    IoJob* first;
+    IoJob* last;
+} IoJobList;
+
+typedef struct {
+    IoJobList pending;      // Waiting for the I/O thread
+    IoJobList completed;    // Waiting for the main thread
+    PlatformThread thread;
+    PlatformMutex lock;
+    PlatformCondition changed;
+    bool quit;
+    bool started;
+} IoThread;
+
+static IoThread ioThread = {0};
+
+static void appendJob(IoJobList* list, IoJob* job) {
+    job->next = NULL;
+    if (list->last != NULL) {
+        list->last->next = job;
+    } else {
+        list->first = job;
+    }
+    list->last = job;
+}
+
+static IoJob* popJob(IoJobList* list) {
+    IoJob* job = list->first;
+    if (job == NULL) return NULL;
+    
+    list->first = job->next;
+    if (list->first == NULL) list->last = NULL;
+    return job;
+}
+
+static int ioThreadMain(void* arg) {
+    (void)arg;
+    
+    for (;;) {
+        lockMutex(&ioThread.lock);
+        while (ioThread.pending.first == NULL && !ioThread.quit) {
+            waitCondition(&ioThread.changed, &ioThread.lock);
+        }
+        
+        // Quit only once everything queued has been written
+        IoJob* job = popJob(&ioThread.pending);
+        unlockMutex(&ioThread.lock);
+        if (job == NULL) break;
+        
+        beginSubsystem(SUBSYSTEM_IO);
+        job->run(job->data);
+        endSubsystem();
+        
+        if (job->complete != NULL) {
+            lockMutex(&ioThread.lock);
+            appendJob(&ioThread.completed, job);
+            unlockMutex(&ioThread.lock);
+        } else {
+            trackedFree(job);
+        }
+    }
+    return 0;
+}
+
+void initIoThread(void) {
+    if (ioThread.started) return;
+    
+    if (!createMutex(&ioThread.lock) || !createCondition(&ioThread.changed) ||
+        !createThread(&ioThread.thread, ioThreadMain, NULL)) {
+        printf("Error: Failed to start the I/O thread\n");
+        exit(1);
+    }
+    ioThread.started = true;
+}
+
+// Queue file work; complete may be NULL when the main thread doesn't need the result
+void queueIoJob(IoJobFunc run, IoJobFunc complete, void* data) {
+    IoJob* job = (IoJob*)trackedMalloc(sizeof(IoJob));
+    if (job == NULL) {
+        printf("Error: Failed to allocate I/O job\n");
+        return;
+    }
+    job->run = run;
+    job->complete = complete;
+    job->data = data;
+    
+    lockMutex(&ioThread.lock);
+    appendJob(&ioThread.pending, job);
+    signalCondition(&ioThread.changed);
+    unlockMutex(&ioThread.lock);
+}
+
+// Hand finished jobs their results on the main thread; call once per frame
+void processIoCompletions(void) {
+    lockMutex(&ioThread.lock);
+    IoJobList completed = ioThread.completed;
+    ioThread.completed = (IoJobList){0};
+    unlockMutex(&ioThread.lock);
+    
+    beginSubsystem(SUBSYSTEM_IO);
+    IoJob* job;
+    while ((job = popJob(&completed)) != NULL) {
+        job->complete(job->data);
+        trackedFree(job);
+    }
+    endSubsystem();
+}
+
+// Finish every queued job, then stop the thread
+void shutdownIoThread(void) {
+    if (!ioThread.started) return;
+    
+    lockMutex(&ioThread.lock);
+    ioThread.quit = true;
+    broadcastCondition(&ioThread.changed);
+    unlockMutex(&ioThread.lock);
+    
+    joinThread(&ioThread.thread);
+    processIoCompletions();
+    destroyCondition(&ioThread.changed);
+    destroyMutex(&ioThread.lock);
+    ioThread.started = false;
+}
\ No newline at end of file
@@ -0,0 +1,41 @@
+#include "raylib.h"
+#include "rlgl.h"
+#include <stdbool.h>
+
+// Custom headers
+#include "typedefs.h"
+#include "config.h"
+#include "layers.h"
+
+// Render into a transparent layer with premultiplied colour so translucent
+// pixels keep their alpha when the layer is composited later
+void beginCachedLayer(RenderTexture2D layer) {
+    BeginTextureMode(layer);
+    ClearBackground(BLANK);
+    rlSetBlendFactorsSeparate(RL_SRC_ALPHA, RL_ONE_MINUS_SRC_ALPHA, RL_ONE, RL_ONE_MINUS_SRC_ALPHA, RL_FUNC_ADD, RL_FUNC_ADD);
+    BeginBlendMode(BLEND_CUSTOM_SEPARATE);
+}
+
+void endCachedLayer(void) {
+    EndBlendMode();
+    EndTextureMode();
+}
+
+// Blit a cached layer (render textures are stored upside down)
+void drawCachedLayer(RenderTexture2D layer, Vector2 position, unsigned char alpha) {
+    Rectangle source = { 0, 0, (float)layer.texture.width, -(float)layer.texture.height };
+    BeginBlendMode(BLEND_ALPHA_PREMULTIPLY);
+    DrawTextureRec(layer.texture, source, position, (Color){ alpha, alpha, alpha, alpha });
+    EndBlendMode();
+}
+
+// Report whether the window size differs from the one a cache was built for
+bool windowSizeChanged(int* width, int* height) {
+    int currentWidth = GetScreenWidth();
+    int currentHeight = GetScreenHeight();
+    if (currentWidth == *width && currentHeight == *height) return false;
+    
+    *width = currentWidth;
+    *height = currentHeight;
+    return true;
+}
\ No newline at end of file
@@ -0,0 +1,158 @@
+#include "raylib.h"
+#include <stdbool.h>
+#include <stddef.h>
+
+// Custom headers
+#include "typedefs.h"
+#include "config.h"
+#include "lifecycle.h"
+#include "enemies.h"
+#include "powerups.h"
+#include "random.h"
+
+static SpawnListener spawnListeners[MAX_ENTITY_LISTENERS];
+static DespawnListener despawnListeners[MAX_ENTITY_LISTENERS];
+static int spawnListenerCount = 0;
+static int despawnListenerCount = 0;
+
+bool addSpawnListener(SpawnListener listener) {
+    for (int i = 0; i < spawnListenerCount; i++) {
+        if (spawnListeners[i] == listener) return true;
+    }
+    if (spawnListenerCount >= MAX_ENTITY_LISTENERS) return false;
+    
+    spawnListeners[spawnListenerCount++] = listener;
+    return true;
+}
+
+bool addDespawnListener(DespawnListener listener) {
+    for (int i = 0; i < despawnListenerCount; i++) {
+        if (despawnListeners[i] == listener) return true;
+    }
+    if (despawnListenerCount >= MAX_ENTITY_LISTENERS) return false;
+    
+    despawnListeners[despawnListenerCount++] = listener;
+    return true;
+}
+
+static bool* getActiveFlag(GameState* state, EntityKind kind, int index) {
+    switch (kind) {
+        case ENTITY_BULLET: return &state->bullets[index].active;
+        case ENTITY_ASTEROID: return &state->asteroids[index].base.active;
+        case ENTITY_ENEMY: return &state->enemies[index].base.active;
+        case ENTITY_ENEMY_BULLET: return &state->enemyBullets[index].base.active;
+        case ENTITY_POWERUP: return &state->powerups[index].base.active;
+        default: return NULL;
+    }
+}
+
+// Per-type tallies move with the live count; delta is +1 on spawn and -1 on despawn
+static void countEntity(GameState* state, EntityKind kind, int index, int delta) {
+    EntityCounts* counts = &state->entities;
+    counts->live[kind] += delta;
+    
+    if (kind == ENTITY_ASTEROID) {
+        counts->asteroidsBySize[state->asteroids[index].size] += delta;
+    } else if (kind == ENTITY_ENEMY) {
+        counts->enemiesByType[state->enemies[index].type] += delta;
+    }
+}
+
+// Broken asteroids may drop powerups; only the player's own hits score, smaller ones worth more
+static void onAsteroidDestroyed(GameState* state, const Asteroid* asteroid, DespawnCause cause) {
+    // Only large asteroids (size 3) have a chance to drop life powerups
+    if (asteroid->size == 3) {
+        spawnLifePowerup(state, asteroid->base.x, asteroid->base.y);
+    }
+    spawnHealthPowerup(state, asteroid->base.x, asteroid->base.y);
+    
+    if (cause == DESPAWN_SHOT) {
+        state->score += (4 - asteroid->size) * 100;
+    }
+}
+
+static void onEnemyDestroyed(GameState* state, const Enemy* enemy, DespawnCause cause) {
+    int score = enemy->type == ENEMY_TANK ? TANK_ENEMY_SCORE : SCOUT_ENEMY_SCORE;
+    
+    if (cause == DESPAWN_SHOT) {
+        state->score += score;
+        
+        // Scouts may leave a shotgun behind, tanks a grenade launcher
+        if (enemy->type == ENEMY_SCOUT) {
+            if (getGameRandomValue(state, 1, 100) <= SHOTGUN_DROP_CHANCE) {
+                spawnShotgunPowerup(state, enemy->base.x, enemy->base.y);
+            }
+        } else if (enemy->type == ENEMY_TANK) {
+            if (getGameRandomValue(state, 1, 100) <= GRENADE_DROP_CHANCE) {
+                spawnGrenadePowerup(state, enemy->base.x, enemy->base.y);
+            }
+        }
+    } else {
+        // Half the score when an asteroid does the player's work
+        state->score += score / 2;
+    }
+    
+    createEnemyExplosion(state, enemy->base.x, enemy->base.y, ENEMY_EXPLOSION_PARTICLES);
+}
+
+void spawnEntity(GameState* state, EntityKind kind, int index) {
+    bool* active = getActiveFlag(state, kind, index);
+    if (active == NULL || *active) return;
+    
+    *active = true;
+    countEntity(state, kind, index, 1);
+    
+    for (int i = 0; i < spawnListenerCount; i++) {
+        spawnListeners[i](state, kind, index);
+    }
+}
+
+void despawnEntity(GameState* state, EntityKind kind, int index, DespawnCause cause) {
+    bool* active = getActiveFlag(state, kind, index);
+    if (active == NULL || !*active) return;
+    
+    *active = false;
+    countEntity(state, kind, index, -1);
+    
+    // Gameplay hooks; sleeping and cleared entities leave without any. A powerup's texture
+    // stays: it is the shared cached copy, released only by unloadAllTextures
+    bool destroyed = cause == DESPAWN_SHOT || cause == DESPAWN_DESTROYED;
+    if (destroyed && kind == ENTITY_ASTEROID) {
+        onAsteroidDestroyed(state, &state->asteroids[index], cause);
+    } else if (destroyed && kind == ENTITY_ENEMY) {
+        onEnemyDestroyed(state, &state->enemies[index], cause);
+    }
+    
+    for (int i = 0; i < despawnListenerCount; i++) {
+        despawnListeners[i](state, kind, index, cause);
+    }
+}
+
+void recountEntities(GameState* state) {
+    EntityCounts* counts = &state->entities;
+    *counts = (EntityCounts){ 0 };
+    
+    for (int i = 0; i < MAX_BULLETS; i++) {
+        if (state->bullets[i].active) countEntity(state, ENTITY_BULLET, i, 1);
+    }
+    for (int i = 0; i < MAX_ASTEROIDS; i++) {
+        if (state->asteroids[i].base.active) countEntity(state, ENTITY_ASTEROID, i, 1);
+    }
+    for (int i = 0; i < MAX_ENEMIES; i++) {
+        if (state->enemies[i].base.active) countEntity(state, ENTITY_ENEMY, i, 1);
+    }
+    for (int i = 0; i < MAX_ENEMY_BULLETS; i++) {
+        if (state->enemyBullets[i].base.active) countEntity(state, ENTITY_ENEMY_BULLET, i, 1);
+    }
+    for (int i = 0; i < MAX_POWERUPS; i++) {
+        if (state->powerups[i].base.active) countEntity(state, ENTITY_POWERUP, i, 1);
+    }
+}
+
+bool isWaveCleared(const GameState* state) {
+    if (state->entities.live[ENTITY_ASTEROID] > 0) return false;
+    
+    // Before enemies appear only the asteroids count
+    if (state->currentWave < SCOUT_START_WAVE) return true;
+    return state->EnemySpawnComplete && state->entities.live[ENTITY_ENEMY] == 0;
+}
\ No newline at end of file
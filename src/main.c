@@ -18,14 +18,52 @@
 #include "powerups.h"
 #include "resources.h" 
 #include "scoreboard.h"
+#include "background.h"
+#include "hud.h"
+#include "panels.h"
+#include "pacing.h"
+#include "viewport.h"
+#include "governor.h"
+#include "simulation.h"
+#include "platform.h"
+#include "iothread.h"
+#include "telemetry.h"
+#include "profiler.h"
+#include "memtrack.h"
+#include "flightrecorder.h"
+#include "trace.h"
+#include "cmdline.h"
+#include "scenario.h"
+#include "batch.h"
+#include "asteroidmesh.h"
 
 int main(int argc, char* argv[]) {
     // Initialize random seed
     srand(time(NULL));
-
-    // Initialize Raylib
+    
+    // Window, GPU and audio calls must stay on this thread
+    markMainThread();
+    
+    // Trace runs play a scripted game headless; scenarios start straight into a stress load
+    LaunchOptions launchOptions;
+    if (!parseLaunchOptions(argc, argv, &launchOptions)) {
+        return 1;
+    }
+    const TraceOptions* traceOptions = &launchOptions.trace;
+    
+    // Batch runs play bot games without ever opening a window
+    if (launchOptions.batch.count > 0) {
+        return runBatch(&launchOptions.batch);
+    }
+    
+    // Initialize Raylib with a resizable window
+    SetConfigFlags(FLAG_WINDOW_RESIZABLE | (traceOptions->mode != TRACE_OFF ? FLAG_WINDOW_HIDDEN : 0));
     InitWindow(WINDOW_WIDTH, WINDOW_HEIGHT, "Asteroids");
-    SetTargetFPS(60);
+    SetWindowMinSize(MIN_WINDOW_WIDTH, MIN_WINDOW_HEIGHT);
+    SetTargetFPS(GAME_FRAME_RATE);
+    
+    // Everything is drawn into an internal target and scaled to the window
+    initViewport();
     
     // Load and set the window icon
     Image icon = LoadImage(SHIP_TEXTURE_PATH);
@@ -46,9 +84,15 @@ int main(int argc, char* argv[]) {
     // Start with default cursor for menu
     SetMouseCursor(MOUSE_CURSOR_DEFAULT);
     
+    // Every asteroid outline exists before the menu or the simulation thread picks one
+    generateAsteroidMeshes();
+    
     // Create game state
     GameState gameState = {0}; // Initialize to zero
+    gameState.world.size = launchOptions.world;
     initGameState(&gameState);
+    gameState.crosshairTexture = crosshairTexture;
+    gameState.hasCustomCursor = hasCustomCursor;
     
     // Initialize the resource manager
     initResources(&gameState);
@@ -56,6 +100,20 @@ int main(int argc, char* argv[]) {
     // Preload all textures for info screen and performance
     loadAllTextures(&gameState);
     
+    if (traceOptions->mode != TRACE_OFF) {
+        int result = runTrace(&gameState, traceOptions);
+        if (hasCustomCursor) {
+            UnloadTexture(crosshairTexture);
+        }
+        unloadAllTextures(&gameState);
+        CloseWindow();
+        return result;
+    }
+    
+    // Bake the static map background into texture chunks
+    initBackground();
+    initHud();
+    
     // Setup buttons
     gameState.playButton = (Rectangle){
         WINDOW_WIDTH/2 - BUTTON_WIDTH/2,
@@ -98,14 +156,14 @@ int main(int argc, char* argv[]) {
         SLIDER_WIDTH,
         SLIDER_HEIGHT
     };
-
+    
     gameState.musicVolumeSlider = (Rectangle){
         WINDOW_WIDTH/2 - SLIDER_WIDTH/2,
         WINDOW_HEIGHT/2 + 80,  
         SLIDER_WIDTH,
         SLIDER_HEIGHT
     };
-
+    
     gameState.mainMenuButton = (Rectangle){
     WINDOW_WIDTH/2 - BUTTON_WIDTH/2,
     WINDOW_HEIGHT/2 + (BUTTON_HEIGHT + 20),
@@ -113,6 +171,13 @@ int main(int argc, char* argv[]) {
     BUTTON_HEIGHT
     };
     
+    gameState.renderScaleButton = (Rectangle){
+        WINDOW_WIDTH/2 - (BUTTON_WIDTH + 80)/2,
+        WINDOW_HEIGHT - 2 * BUTTON_HEIGHT - 60,
+        BUTTON_WIDTH + 80,
+        BUTTON_HEIGHT
+    };
+    
     // Start with menu state
     gameState.screenState = MENU_STATE;
     gameState.windowFocused = true;
@@ -120,34 +185,70 @@ int main(int argc, char* argv[]) {
     // Load sounds
     loadSounds(&gameState);
     loadMusic(&gameState);
-
+    
     // Start playing menu music
     PlayMusicStream(gameState.menuMusic);
     
+    // File work happens on a background thread from here on
+    initIoThread();
+    
     // Load high scores
     loadHighScores(&gameState);
     
+    // Per-run telemetry is written out by its own thread
+    initTelemetry();
+    
+    // Keep the last few seconds of frames around for hitch reports
+    initFlightRecorder();
+    
+    // Stress scenarios skip the menu
+    if (launchOptions.scenario.type != SCENARIO_NONE) {
+        startScenario(&gameState, &launchOptions.scenario);
+    }
+    
+    // Gameplay runs on its own thread and hands back render snapshots
+    initSimulation(&gameState);
+    
     // Game loop
     while (!WindowShouldClose() && gameState.running) {
-        float deltaTime = GetFrameTime();
+        // While the simulation thread owns the game state, only its snapshots are read here
+        GameScreenState screenState = isSimulationActive() ? GAME_STATE : gameState.screenState;
+        const RenderSnapshot* frameSnapshot = NULL;
+        
+        // Pick this screen's frame rate and start measuring the iteration
+        beginPacedFrame(screenState);
+        float deltaTime = getPacedFrameTime();
+        
+        // Follow window resizes so mouse coordinates map into the internal resolution
+        updateViewport();
+        
         
-
         // Update music streaming for any active music
+        beginSubsystem(SUBSYSTEM_AUDIO);
         if (gameState.musicLoaded && gameState.currentMusic != NULL) {
             UpdateMusicStream(*gameState.currentMusic);
         }
-
+        
+        // Play sound effects raised by the simulation since the last frame
+        playQueuedSounds(&gameState);
+        endSubsystem();
+        
+        // Pick up finished background file work (loaded high scores)
+        processIoCompletions();
+        
         // Check window focus status
         bool currentlyFocused = IsWindowFocused();
-        if (gameState.windowFocused && !currentlyFocused && gameState.screenState == GAME_STATE) {
+        if (gameState.windowFocused && !currentlyFocused && screenState == GAME_STATE) {
+            pauseSimulation();
             gameState.screenState = PAUSE_STATE;
+            screenState = PAUSE_STATE;
         }
         gameState.windowFocused = currentlyFocused;
         
         // Handle cursor switching based on game state
         static GameScreenState lastScreenState = MENU_STATE;
-        if (gameState.screenState != lastScreenState) {
-            if (gameState.screenState == GAME_STATE) {
+        if (screenState != lastScreenState) {
+            if (screenState == GAME_STATE) {
                 // Hide system cursor during gameplay to show custom crosshair
                 if (hasCustomCursor) {
                     HideCursor();
@@ -159,31 +260,51 @@ int main(int argc, char* argv[]) {
                 ShowCursor();
                 SetMouseCursor(MOUSE_CURSOR_DEFAULT);
             }
-            lastScreenState = gameState.screenState;
+            
+            // Send the partial frame-time histogram while it still belongs to this run
+            if (lastScreenState == GAME_STATE) {
+                flushFrameTelemetry();
+            }
+            lastScreenState = screenState;
         }
         
-        switch (gameState.screenState) {
+        // Static screens only redraw when something changed
+        bool redraw = shouldRedraw(screenState);
+        
+        switch (screenState) {
             case MENU_STATE:
                 // Switch to menu music when returning to menu
                 if (gameState.musicLoaded && gameState.currentMusic != &gameState.menuMusic) {
                     switchMusic(&gameState, &gameState.menuMusic);
                 }
                 handleMenuInput(&gameState);
-                renderMenu(&gameState);
+                if (redraw) renderMenu(&gameState);
                 break;
                 
             case INFO_STATE:
                 handleInfoInput(&gameState);
-                renderInfo(&gameState);
+                if (redraw) renderInfo(&gameState);
                 break;
                 
-            case GAME_STATE:
+            case GAME_STATE: {
+                // Hand the game state to the simulation thread when gameplay starts or resumes
+                resumeSimulation();
+                
+                // Forward this frame's input and draw the newest simulated state
+                InputFrame inputFrame;
+                beginSubsystem(SUBSYSTEM_INPUT);
+                sampleGameInput(&inputFrame);
+                submitInputFrame(&inputFrame);
+                endSubsystem();
+                const RenderSnapshot* snapshot = acquireRenderSnapshot();
+                frameSnapshot = snapshot;
+                
                 // Start game with phase1 music unless we're already playing phase2
                 if (gameState.musicLoaded) {
                     if (gameState.currentMusic == &gameState.menuMusic) {
                         // Coming from menu - switch to phase1
                         switchMusic(&gameState, &gameState.phase1Music);
-                    } else if (gameState.currentWave >= TANK_START_WAVE && 
+                    } else if (snapshot->currentWave >= TANK_START_WAVE && 
                                gameState.currentMusic == &gameState.phase1Music) {
                         // We've reached wave 5 - switch to phase2
                         switchMusic(&gameState, &gameState.phase2Music);
@@ -191,45 +312,66 @@ int main(int argc, char* argv[]) {
                     // Otherwise keep playing current phase music
                 }
                 
-                gameState.fireTimer -= deltaTime; // Update fire cooldown timer
-                gameState.shotgunFireTimer -= deltaTime; // Update shotgun cooldown timer
-                gameState.grenadeFireTimer -= deltaTime; // Update grenade cooldown timer
-                handleInput(&gameState);
-                updateGame(&gameState, deltaTime);
+                beginGovernorFrame();
                 
-                // Render game
-                renderGame(&gameState);
+                // Render game (including the custom crosshair)
+                beginSubsystem(SUBSYSTEM_RENDER);
+                renderGame(snapshot);
+                endSubsystem();
+                redraw = true;
                 
-                // Draw custom crosshair at mouse position during gameplay
-                if (hasCustomCursor) {
-                    Vector2 mousePos = GetMousePosition();
-                    float crosshairSize = 32.0f; // Adjust size as needed
-                    DrawTextureEx(crosshairTexture, 
-                                (Vector2){mousePos.x - crosshairSize/2, mousePos.y - crosshairSize/2}, 
-                                0.0f, crosshairSize/crosshairTexture.width, WHITE);
-                }
+                // Adjust cosmetic quality to hold the frame budget
+                updateGovernor(deltaTime);
+                recordFrameTelemetry(deltaTime, snapshot->currentWave, snapshot->simTick);
                 break;
+            }
                 
             case PAUSE_STATE:
                 // Keep playing current game music in pause
                 handlePauseInput(&gameState);
-                renderPause(&gameState);
+                if (redraw) renderPause(&gameState);
                 break;
                 
             case OPTIONS_STATE:
                 // Keep playing current music in options
                 handleOptionsInput(&gameState);
-                renderOptions(&gameState);
+                if (redraw) renderOptions(&gameState);
                 break;
                 
             case GAME_OVER_STATE:
                 // Keep playing current phase music for game over
                 handleGameOverInput(&gameState);
-                renderGameOver(&gameState);
+                if (redraw) renderGameOver(&gameState);
                 break;
         }
+        
+        endPacedFrame(redraw);
+        endMemoryFrame();
+        const FlightFrame* flightFrame = endFlightFrame(screenState, frameSnapshot);
+        
+        // A stress scenario ends the game once it has measured all its frames
+        if (!recordScenarioFrame(flightFrame)) break;
     }
     
+    // Take the game state back and stop the simulation thread
+    shutdownSimulation();
+    
+    // Write out the last telemetry once nothing else can record
+    flushFrameTelemetry();
+    shutdownTelemetry();
+    
+    // Let pending score saves and hitch dumps reach the disk
+    shutdownFlightRecorder();
+    shutdownIoThread();
+    unloadHighScores();
+    
+    // Report scenario frame times, how much CPU each screen used, what was allocated and,
+    // if enabled, hardware counters
+    endScenario();
+    printPacingReport();
+    printMemoryReport();
+    printPerfReport();
+    
     // Clean up resources
     if (hasCustomCursor) {
         UnloadTexture(crosshairTexture);
@@ -238,6 +380,14 @@ int main(int argc, char* argv[]) {
     // Unload all textures with the resource manager
     unloadAllTextures(&gameState);
     
+    // Unload the pre-rendered background and cached UI layers
+    unloadBackground();
+    unloadHud();
+    unloadPanels();
+    unloadScoreboard();
+    unloadPauseSnapshot();
+    unloadViewport();
+    
     // Unload sound effects
     if (gameState.soundLoaded) {
         for (int i = 0; i < MAX_SOUNDS; i++) {
@@ -245,7 +395,7 @@ int main(int argc, char* argv[]) {
         }
         CloseAudioDevice();
     }
-
+    
     // Unload music
     unloadMusic(&gameState);
     
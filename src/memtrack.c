@@ -0,0 +1,127 @@
+#include <stdbool.h>
+#include <stdio.h>
+#include <stdlib.h>
+#include <limits.h>
+
+// Custom headers
+#include "typedefs.h"
+#include "config.h"
+#include "memtrack.h"
+#include "profiler.h"
+#include "platform.h"
+
+// Counts since the last endMemoryFrame, bumped from whichever thread allocates
+typedef struct {
+    volatile int allocations;
+    volatile int frees;
+    volatile int bytes;
+} AllocationCounters;
+
+static AllocationCounters frameCounters[SUBSYSTEM_COUNT];
+static volatile int lateTickAllocations = 0;
+
+// Folded together once per frame, owned by the main thread
+static MemoryStats memoryStats = {0};
+
+static THREAD_LOCAL int threadAllocations = 0;
+static THREAD_LOCAL SubsystemId lastAllocationScope = SUBSYSTEM_OTHER;
+
+static void noteAllocation(size_t size) {
+    SubsystemId scope = getCurrentSubsystem();
+    atomicAdd(&frameCounters[scope].allocations, 1);
+    atomicAdd(&frameCounters[scope].bytes, size > INT_MAX ? INT_MAX : (int)size);
+    threadAllocations++;
+    lastAllocationScope = scope;
+}
+
+void* trackedMalloc(size_t size) {
+    void* pointer = malloc(size);
+    if (pointer != NULL) noteAllocation(size);
+    return pointer;
+}
+
+void* trackedCalloc(size_t count, size_t size) {
+    void* pointer = calloc(count, size);
+    if (pointer != NULL) noteAllocation(count * size);
+    return pointer;
+}
+
+// Growing or shrinking still goes to the allocator, so both count
+void* trackedRealloc(void* pointer, size_t size) {
+    void* resized = realloc(pointer, size);
+    if (resized != NULL && size > 0) noteAllocation(size);
+    return resized;
+}
+
+void trackedFree(void* pointer) {
+    if (pointer == NULL) return;
+    
+    atomicAdd(&frameCounters[getCurrentSubsystem()].frees, 1);
+    free(pointer);
+}
+
+// Allocations made so far by the calling thread
+int getThreadAllocationCount(void) {
+    return threadAllocations;
+}
+
+// Gameplay ticks must not allocate once warmed up; debug and benchmark builds stop at the first one that does
+void checkTickAllocations(unsigned int tick, int allocations) {
+    if (allocations <= 0 || tick < ALLOCATION_WARMUP_TICKS) return;
+    
+    atomicAdd(&lateTickAllocations, allocations);
+#if defined(DEBUG) || defined(BENCHMARK)
+    printf("Error: Gameplay tick %u allocated %d time(s) after warm-up, last in %s\n",
+           tick, allocations, getSubsystemName(lastAllocationScope));
+    fflush(stdout);
+    abort();
+#endif
+}
+
+// Close out the frame's counters; call once per main loop iteration
+void endMemoryFrame(void) {
+    MemoryStats* stats = &memoryStats;
+    stats->frameAllocations = 0;
+    stats->frameFrees = 0;
+    stats->frameBytes = 0;
+    
+    for (int scope = 0; scope < SUBSYSTEM_COUNT; scope++) {
+        int allocations = atomicExchange(&frameCounters[scope].allocations, 0);
+        int bytes = atomicExchange(&frameCounters[scope].bytes, 0);
+        stats->frameFrees += atomicExchange(&frameCounters[scope].frees, 0);
+        
+        stats->frameAllocations += allocations;
+        stats->frameBytes += bytes;
+        stats->totalAllocations[scope] += allocations;
+        stats->totalBytes[scope] += bytes;
+        if (allocations > stats->peakScopeAllocations[scope]) {
+            stats->peakScopeAllocations[scope] = allocations;
+        }
+    }
+    
+    if (stats->frameAllocations > stats->peakAllocations) stats->peakAllocations = stats->frameAllocations;
+    if (stats->frameBytes > stats->peakBytes) stats->peakBytes = stats->frameBytes;
+    if (stats->frameAllocations > 0) stats->allocatingFrames++;
+    stats->frames++;
+    stats->tickAllocations = atomicLoad(&lateTickAllocations);
+}
+
+MemoryStats getMemoryStats(void) {
+    return memoryStats;
+}
+
+void printMemoryReport(void) {
+    const MemoryStats* stats = &memoryStats;
+    printf("Allocation report: %d of %d frames allocated, peak %d allocations / %d bytes in one frame\n",
+           stats->allocatingFrames, stats->frames, stats->peakAllocations, stats->peakBytes);
+    printf("  %-12s %12s %14s %12s\n", "subsystem", "allocations", "bytes", "peak/frame");
+    for (int scope = 0; scope < SUBSYSTEM_COUNT; scope++) {
+        if (stats->totalAllocations[scope] == 0) continue;
+        
+        printf("  %-12s %12lld %14lld %12d\n", getSubsystemName(scope),
+               stats->totalAllocations[scope], stats->totalBytes[scope], stats->peakScopeAllocations[scope]);
+    }
+    if (stats->tickAllocations > 0) {
+        printf("  Warning: gameplay ticks allocated %d time(s) after warm-up\n", stats->tickAllocations);
+    }
+}
\ No newline at end of file
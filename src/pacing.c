@@ -0,0 +1,148 @@
+#include "raylib.h"
+#include <stdbool.h>
+#include <stdio.h>
+#include <time.h>
+
+// Custom headers
+#include "typedefs.h"
+#include "config.h"
+#include "pacing.h"
+
+// Frame pacing state for the main loop
+typedef struct {
+    GameScreenState screenState;
+    GameScreenState lastRedrawState;
+    bool focused;
+    int targetFps;
+    double frameStart;
+    double lastFrameStart;
+    double lastRedraw;
+    clock_t cpuStart;
+    float frameTime;
+    bool started;
+    bool uncapped;
+} Pacing;
+
+static Pacing pacing = {0};
+static PacingStats pacingStats[SCREEN_STATE_COUNT] = {0};
+
+static const char* screenStateNames[SCREEN_STATE_COUNT] = {
+    "menu", "game", "pause", "options", "game over", "info"
+};
+
+// Screens whose contents only change in response to input
+static bool isStaticScreen(GameScreenState screenState) {
+    return screenState == PAUSE_STATE || screenState == OPTIONS_STATE ||
+           screenState == GAME_OVER_STATE || screenState == INFO_STATE;
+}
+
+// Pick the frame rate for the current screen and focus
+static int getTargetFps(GameScreenState screenState, bool focused) {
+    if (screenState == GAME_STATE) return pacing.uncapped ? 0 : GAME_FRAME_RATE;
+    if (!focused) return UNFOCUSED_POLL_RATE;
+    if (screenState == MENU_STATE) return MENU_FRAME_RATE;
+    return IDLE_POLL_RATE;
+}
+
+// Check for any mouse or keyboard activity since the last poll
+static bool hasInputActivity(void) {
+    Vector2 mouseDelta = GetMouseDelta();
+    if (mouseDelta.x != 0 || mouseDelta.y != 0) return true;
+    if (GetMouseWheelMove() != 0) return true;
+    
+    for (int button = MOUSE_BUTTON_LEFT; button <= MOUSE_BUTTON_MIDDLE; button++) {
+        if (IsMouseButtonDown(button) || IsMouseButtonReleased(button)) return true;
+    }
+    
+    // Nothing reads the key queue, so draining it here is safe
+    return GetKeyPressed() != 0;
+}
+
+// Start timing a loop iteration and apply the frame rate for the current screen
+void beginPacedFrame(GameScreenState screenState) {
+    double now = GetTime();
+    bool focused = IsWindowFocused();
+    int targetFps = getTargetFps(screenState, focused);
+    
+    if (!pacing.started) {
+        pacing.lastFrameStart = now;
+        pacing.lastRedraw = -IDLE_HEARTBEAT;
+        pacing.lastRedrawState = screenState;
+        pacing.targetFps = -1;  // Always apply the first target, even unlimited
+        pacing.started = true;
+    }
+    
+    if (targetFps != pacing.targetFps) {
+        SetTargetFPS(targetFps);
+        pacing.targetFps = targetFps;
+    }
+    
+    // Frame time is measured here because GetFrameTime only updates when a frame is drawn
+    pacing.frameTime = (float)(now - pacing.lastFrameStart);
+    if (pacing.frameTime > MAX_FRAME_DELTA) pacing.frameTime = MAX_FRAME_DELTA;
+    pacing.lastFrameStart = now;
+    
+    pacing.screenState = screenState;
+    pacing.focused = focused;
+    pacing.frameStart = now;
+    pacing.cpuStart = clock();
+}
+
+float getPacedFrameTime(void) {
+    return pacing.frameTime;
+}
+
+// Decide whether this iteration needs to render a frame
+bool shouldRedraw(GameScreenState screenState) {
+    if (screenState != pacing.lastRedrawState) return true;
+    if (IsWindowResized()) return true;
+    if (pacing.frameStart - pacing.lastRedraw >= IDLE_HEARTBEAT) return true;
+    
+    // While in the background only the heartbeat redraws
+    if (!pacing.focused) return screenState == GAME_STATE;
+    
+    if (!isStaticScreen(screenState)) return true;
+    return hasInputActivity();
+}
+
+// Finish the iteration: sleep and poll input ourselves if nothing was drawn
+void endPacedFrame(bool redrawn) {
+    if (redrawn) {
+        pacing.lastRedraw = pacing.frameStart;
+        pacing.lastRedrawState = pacing.screenState;
+    } else {
+        // EndDrawing normally does the waiting and input polling
+        double remaining = pacing.targetFps > 0 ? 1.0 / pacing.targetFps - (GetTime() - pacing.frameStart) : 0.0;
+        if (remaining > 0) WaitTime(remaining);
+        PollInputEvents();
+    }
+    
+    PacingStats* stats = &pacingStats[pacing.screenState];
+    stats->wallTime += GetTime() - pacing.frameStart;
+    stats->cpuTime += (double)(clock() - pacing.cpuStart) / CLOCKS_PER_SEC;
+    stats->iterations++;
+    if (redrawn) stats->redraws++;
+}
+
+// Run gameplay as fast as it renders; 0 is raylib's unlimited target
+void setPacingUncapped(bool uncapped) {
+    pacing.uncapped = uncapped;
+}
+
+PacingStats getPacingStats(GameScreenState screenState) {
+    return pacingStats[screenState];
+}
+
+// Print CPU usage for each screen state
+void printPacingReport(void) {
+    printf("Frame pacing report:\n");
+    printf("  %-10s %9s %9s %6s %10s %9s\n", "state", "wall (s)", "cpu (s)", "cpu %", "iterations", "redraws");
+    for (int i = 0; i < SCREEN_STATE_COUNT; i++) {
+        const PacingStats* stats = &pacingStats[i];
+        if (stats->iterations == 0) continue;
+        
+        double cpuPercent = stats->wallTime > 0 ? 100.0 * stats->cpuTime / stats->wallTime : 0.0;
+        printf("  %-10s %9.1f %9.2f %5.1f%% %10d %9d\n", screenStateNames[i],
+               stats->wallTime, stats->cpuTime, cpuPercent, stats->iterations, stats->redraws);
+    }
+}
\ No newline at end of file
@@ -0,0 +1,293 @@
+#include "raylib.h"
+#include <stdbool.h>
+#include <stdio.h>
+#include <string.h>
+
+// Custom headers
+#include "typedefs.h"
+#include "config.h"
+#include "panels.h"
+#include "layers.h"
+#include "flightrecorder.h"
+
+// Pre-rendered information screen
+typedef struct {
+    RenderTexture2D panel;
+    int windowWidth;
+    int windowHeight;
+    bool dirty;
+    bool loaded;
+} InfoPanelCache;
+
+static InfoPanelCache infoPanel = { .dirty = true };
+static MenuTextLayout menuTextLayout = {0};
+static bool menuTextMeasured = false;
+
+// Measure the fixed menu strings the first time they are needed
+const MenuTextLayout* getMenuTextLayout(void) {
+    if (!menuTextMeasured) {
+        menuTextLayout.menuTitleWidth = MeasureText("ASTEROIDS", TITLE_FONT_SIZE);
+        menuTextLayout.playWidth = MeasureText("PLAY", BUTTON_FONT_SIZE);
+        menuTextLayout.optionsWidth = MeasureText("OPTIONS", BUTTON_FONT_SIZE);
+        menuTextLayout.quitWidth = MeasureText("QUIT", BUTTON_FONT_SIZE);
+        menuTextLayout.resumeWidth = MeasureText("RESUME", BUTTON_FONT_SIZE);
+        menuTextLayout.backWidth = MeasureText("BACK", BUTTON_FONT_SIZE);
+        menuTextLayout.mainMenuWidth = MeasureText("MAIN MENU", BUTTON_FONT_SIZE);
+        menuTextLayout.pauseTitleWidth = MeasureText("PAUSED", TITLE_FONT_SIZE);
+        menuTextLayout.optionsTitleWidth = MeasureText("OPTIONS", TITLE_FONT_SIZE);
+        menuTextLayout.soundVolumeWidth = MeasureText("SOUND VOLUME", OPTIONS_FONT_SIZE);
+        menuTextLayout.musicVolumeWidth = MeasureText("MUSIC VOLUME", OPTIONS_FONT_SIZE);
+        menuTextLayout.gameOverTitleWidth = MeasureText("GAME OVER", TITLE_FONT_SIZE);
+        menuTextLayout.versionWidth = MeasureText(VERSION_NUMBER, 16);
+        menuTextMeasured = true;
+    }
+    return &menuTextLayout;
+}
+
+// Re-format and re-measure a label only when its value changes
+const char* updateCachedLabel(CachedLabel* label, const char* format, int value, int fontSize) {
+    if (!label->valid || label->value != value) {
+        snprintf(label->text, sizeof(label->text), format, value);
+        label->width = MeasureText(label->text, fontSize);
+        label->value = value;
+        label->valid = true;
+    }
+    return label->text;
+}
+
+// Draw the two-column information layout
+static void drawInfoContent(const GameState* state) {
+    // Draw title 
+    const char* title = "GAME INFORMATION";
+    int titleWidth = MeasureText(title, TITLE_FONT_SIZE);
+    DrawText(title, WINDOW_WIDTH/2 - titleWidth/2, WINDOW_HEIGHT/4 - 30, TITLE_FONT_SIZE, WHITE);
+    
+    // Center the two columns on screen
+    int totalContentWidth = 800; 
+    int startX = (WINDOW_WIDTH - totalContentWidth) / 2;
+    int leftColumnX = startX;
+    int rightColumnX = startX + totalContentWidth / 2 + 80; 
+    
+    // Left Column - Controls and Weapons
+    int currentY = WINDOW_HEIGHT/4 + 45; 
+    
+    // Controls section
+    DrawText("CONTROLS:", leftColumnX, currentY, 30, (Color){255, 200, 100, 255});
+    currentY += 45;
+    
+    DrawText("WASD - Move ship", leftColumnX, currentY, 22, WHITE);
+    currentY += 28;
+    DrawText("Mouse - Aim and shoot", leftColumnX, currentY, 22, WHITE);
+    currentY += 28;
+    DrawText("R - Reload", leftColumnX, currentY, 22, WHITE);
+    currentY += 28;
+    DrawText("P - Pause", leftColumnX, currentY, 22, WHITE);
+    currentY += 50;
+    
+    // Weapons section
+    DrawText("WEAPONS & POWERUPS:", leftColumnX, currentY, 30, (Color){255, 150, 100, 255});
+    currentY += 45;
+    
+    // Health powerup
+    bool drewHealthTexture = false;
+    for (int i = 0; i < MAX_POWERUPS; i++) {
+        if (state->powerups[i].type == POWERUP_HEALTH && state->powerups[i].texture.id > 0) {
+            float scale = 32.0f / state->powerups[i].texture.width;
+            Rectangle source = { 0, 0, state->powerups[i].texture.width, state->powerups[i].texture.height };
+            Rectangle dest = { leftColumnX + 5, currentY + 2, 
+                             state->powerups[i].texture.width * scale, 
+                             state->powerups[i].texture.height * scale };
+            Vector2 origin = { 0, 0 };
+            DrawTexturePro(state->powerups[i].texture, source, dest, origin, 0.0f, WHITE);
+            drewHealthTexture = true;
+            break;
+        }
+    }
+    if (!drewHealthTexture) {
+        DrawCircleV((Vector2){leftColumnX + 20, currentY + 16}, 14, (Color){255, 100, 100, 255});
+        DrawText("+", leftColumnX + 16, currentY + 8, 16, WHITE);
+    }
+    DrawText("Health - Restores 20 health", leftColumnX + 45, currentY + 8, 18, WHITE);
+    currentY += 40; 
+
+    // Life powerup
+    bool drewLifeTexture = false;
+    for (int i = 0; i < MAX_POWERUPS; i++) {
+        if (state->powerups[i].type == POWERUP_LIFE && state->powerups[i].texture.id > 0) {
+            float scale = 32.0f / state->powerups[i].texture.width;
+            Rectangle source = { 0, 0, state->powerups[i].texture.width, state->powerups[i].texture.height };
+            Rectangle dest = { leftColumnX + 5, currentY + 2, 
+                            state->powerups[i].texture.width * scale, 
+                            state->powerups[i].texture.height * scale };
+            Vector2 origin = { 0, 0 };
+            DrawTexturePro(state->powerups[i].texture, source, dest, origin, 0.0f, WHITE);
+            drewLifeTexture = true;
+            break;
+        }
+    }
+    if (!drewLifeTexture) {
+        DrawCircleV((Vector2){leftColumnX + 20, currentY + 16}, 14, (Color){255, 100, 255, 255});
+        DrawText("1UP", leftColumnX + 8, currentY + 8, 14, WHITE);
+    }
+    DrawText("Extra Life - Gain one additional life", leftColumnX + 45, currentY + 8, 18, WHITE);
+    currentY += 40; 
+    
+    // Shotgun powerup
+    bool drewShotgunTexture = false;
+    for (int i = 0; i < MAX_POWERUPS; i++) {
+        if (state->powerups[i].type == POWERUP_SHOTGUN && state->powerups[i].texture.id > 0) {
+            float scale = 32.0f / state->powerups[i].texture.width;
+            Rectangle source = { 0, 0, state->powerups[i].texture.width, state->powerups[i].texture.height };
+            Rectangle dest = { leftColumnX + 5, currentY + 2, 
+                             state->powerups[i].texture.width * scale, 
+                             state->powerups[i].texture.height * scale };
+            Vector2 origin = { 0, 0 };
+            DrawTexturePro(state->powerups[i].texture, source, dest, origin, 0.0f, WHITE);
+            drewShotgunTexture = true;
+            break;
+        }
+    }
+    if (!drewShotgunTexture) {
+        DrawCircleV((Vector2){leftColumnX + 20, currentY + 16}, 14, (Color){100, 255, 100, 255});
+        DrawText("S", leftColumnX + 16, currentY + 8, 16, WHITE);
+    }
+    DrawText("Shotgun - 10 shots", leftColumnX + 45, currentY + 8, 18, WHITE);
+    currentY += 40; 
+    
+    // Grenade powerup
+    bool drewGrenadeTexture = false;
+    for (int i = 0; i < MAX_POWERUPS; i++) {
+        if (state->powerups[i].type == POWERUP_GRENADE && state->powerups[i].texture.id > 0) {
+            float scale = 32.0f / state->powerups[i].texture.width;
+            Rectangle source = { 0, 0, state->powerups[i].texture.width, state->powerups[i].texture.height };
+            Rectangle dest = { leftColumnX + 5, currentY + 2, 
+                             state->powerups[i].texture.width * scale, 
+                             state->powerups[i].texture.height * scale };
+            Vector2 origin = { 0, 0 };
+            DrawTexturePro(state->powerups[i].texture, source, dest, origin, 0.0f, WHITE);
+            drewGrenadeTexture = true;
+            break;
+        }
+    }
+    if (!drewGrenadeTexture) {
+        DrawCircleV((Vector2){leftColumnX + 20, currentY + 16}, 14, (Color){255, 165, 0, 255});
+        DrawText("G", leftColumnX + 16, currentY + 8, 16, WHITE);
+    }
+    DrawText("Grenade - 5 explosive shots", leftColumnX + 45, currentY + 8, 18, WHITE);
+    
+    // Right Column - Enemies and Objectives
+    currentY = WINDOW_HEIGHT/4 + 45; 
+    
+    // Enemies section
+    DrawText("ENEMIES:", rightColumnX, currentY, 30, (Color){255, 100, 100, 255});
+    currentY += 45;
+    
+    // Scout enemy
+    bool drewScoutTexture = false;
+    for (int i = 0; i < MAX_ENEMIES; i++) {
+        if (state->enemies[i].type == ENEMY_SCOUT && state->enemies[i].texture.id > 0) {
+            float scale = 32.0f / state->enemies[i].texture.width;
+            Rectangle source = { 0, 0, state->enemies[i].texture.width, state->enemies[i].texture.height };
+            Rectangle dest = { rightColumnX + 5, currentY + 4, 
+                             state->enemies[i].texture.width * scale, 
+                             state->enemies[i].texture.height * scale };
+            Vector2 origin = { 0, 0 };
+            DrawTexturePro(state->enemies[i].texture, source, dest, origin, 0.0f, WHITE);
+            drewScoutTexture = true;
+            break;
+        }
+    }
+    if (!drewScoutTexture) {
+        Vector2 scoutPoints[3] = {
+            {rightColumnX + 20, currentY + 8},
+            {rightColumnX + 10, currentY + 23},
+            {rightColumnX + 30, currentY + 23}
+        };
+        DrawTriangleLines(scoutPoints[0], scoutPoints[1], scoutPoints[2], SKYBLUE);
+    }
+    DrawText("Scout - Fast, drops shotgun", rightColumnX + 45, currentY + 8, 18, WHITE);
+    currentY += 35;
+    
+    // Tank enemy
+    bool drewTankTexture = false;
+    for (int i = 0; i < MAX_ENEMIES; i++) {
+        if (state->enemies[i].type == ENEMY_TANK && state->enemies[i].texture.id > 0) {
+            float scale = 32.0f / state->enemies[i].texture.width;
+            Rectangle source = { 0, 0, state->enemies[i].texture.width, state->enemies[i].texture.height };
+            Rectangle dest = { rightColumnX + 5, currentY + 4, 
+                             state->enemies[i].texture.width * scale, 
+                             state->enemies[i].texture.height * scale };
+            Vector2 origin = { 0, 0 };
+            DrawTexturePro(state->enemies[i].texture, source, dest, origin, 0.0f, WHITE);
+            drewTankTexture = true;
+            break;
+        }
+    }
+    if (!drewTankTexture) {
+        DrawRectangleLines(rightColumnX + 10, currentY + 8, 24, 16, RED);
+    }
+    DrawText("Tank - Strong, drops grenade", rightColumnX + 45, currentY + 8, 18, WHITE);
+    currentY += 50;
+    
+    // Game objective
+    DrawText("OBJECTIVES:", rightColumnX, currentY, 30, (Color){255, 255, 100, 255});
+    currentY += 45;
+    DrawText("-> Destroy all asteroids", rightColumnX, currentY, 20, WHITE);
+    currentY += 28;
+    DrawText("-> Eliminate enemies for points", rightColumnX, currentY, 20, WHITE);
+    currentY += 28;
+    DrawText("-> Survive as long as possible", rightColumnX, currentY, 20, WHITE);
+    
+    // Instructions to continue - centered at bottom 
+    const char* continueText = "Press Z to start playing!";
+    int continueWidth = MeasureText(continueText, OPTIONS_FONT_SIZE);
+    DrawText(continueText, 
+             WINDOW_WIDTH/2 - continueWidth/2, 
+             WINDOW_HEIGHT - 100, 
+             OPTIONS_FONT_SIZE, 
+             WHITE);
+    
+    // Draw version number in the bottom right corner 
+    DrawText(VERSION_NUMBER, 
+             WINDOW_WIDTH - MeasureText(VERSION_NUMBER, 16) - 10,
+             WINDOW_HEIGHT - 25,
+             16, GRAY);
+}
+
+// Re-render the information screen if it is stale; call before beginFrame
+void updateInfoPanel(const GameState* state) {
+    if (windowSizeChanged(&infoPanel.windowWidth, &infoPanel.windowHeight)) {
+        infoPanel.dirty = true;
+    }
+    
+    if (!infoPanel.loaded) {
+        infoPanel.panel = LoadRenderTexture(WINDOW_WIDTH, WINDOW_HEIGHT);
+        noteAssetLoad();
+        infoPanel.loaded = true;
+        infoPanel.dirty = true;
+    }
+    
+    if (!infoPanel.dirty) return;
+    
+    beginCachedLayer(infoPanel.panel);
+    drawInfoContent(state);
+    endCachedLayer();
+    infoPanel.dirty = false;
+}
+
+void drawInfoPanel(const GameState* state) {
+    // Fall back to drawing directly if the cache isn't ready
+    if (!infoPanel.loaded || infoPanel.dirty) {
+        drawInfoContent(state);
+        return;
+    }
+    
+    drawCachedLayer(infoPanel.panel, (Vector2){ 0, 0 }, 255);
+}
+
+void unloadPanels(void) {
+    if (!infoPanel.loaded) return;
+    
+    UnloadRenderTexture(infoPanel.panel);
+    infoPanel.loaded = false;
+}
\ No newline at end of file
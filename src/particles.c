@@ -11,10 +11,16 @@
 #include "typedefs.h"
 #include "config.h"
 #include "enemies.h"
+#include "governor.h"
+#include "profiler.h"
+#include "random.h"
 
 void updateParticles(GameState* state, float deltaTime) {
+    int updated = 0;
     for (int i = 0; i < MAX_PARTICLES; i++) {
         if (state->particles[i].active) {
+            updated++;
+            
             // Update particle position
             state->particles[i].position.x += state->particles[i].velocity.x;
             state->particles[i].position.y += state->particles[i].velocity.y;
@@ -34,6 +40,7 @@ void updateParticles(GameState* state, float deltaTime) {
             }
         }
     }
+    countSubsystemEntities(updated);
 }
 
 void emitParticles(GameState* state, int count) {
@@ -42,7 +49,8 @@ void emitParticles(GameState* state, int count) {
     float rearX = state->ship.base.x - sin(radians) * state->ship.base.radius * 1.2f;
     float rearY = state->ship.base.y + cos(radians) * state->ship.base.radius * 1.2f;
     
-    // Emit particles
+    // Emit particles, fewer when the quality governor is shedding load
+    count = scaleParticleCount(count);
     for (int i = 0; i < count; i++) {
         // Find an inactive particle
         for (int j = 0; j < MAX_PARTICLES; j++) {
@@ -55,19 +63,19 @@ void emitParticles(GameState* state, int count) {
                 state->particles[j].position.y = rearY;
                 
                 // Add slight randomness to position
-                state->particles[j].position.x += GetRandomValue(-3, 3);
-                state->particles[j].position.y += GetRandomValue(-3, 3);
+                state->particles[j].position.x += getGameRandomValue(state, -3, 3);
+                state->particles[j].position.y += getGameRandomValue(state, -3, 3);
                 
                 // Set particle velocity in the opposite direction of the ship
-                float particleAngle = radians + PI + GetRandomValue(-30, 30) * PI / 180.0f;
+                float particleAngle = radians + PI + getGameRandomValue(state, -30, 30) * PI / 180.0f;
                 state->particles[j].velocity.x = sin(particleAngle) * PARTICLE_SPEED;
                 state->particles[j].velocity.y = -cos(particleAngle) * PARTICLE_SPEED;
                 
                 // Set particle appearance
-                state->particles[j].radius = GetRandomValue(2, 5);
+                state->particles[j].radius = getGameRandomValue(state, 2, 5);
                 
                 // Different colors for visual interest - orange/red/yellow for engine exhaust
-                int colorChoice = GetRandomValue(0, 2);
+                int colorChoice = getGameRandomValue(state, 0, 2);
                 if (colorChoice == 0)
                     state->particles[j].color = (Color){ 255, 120, 0, 255 };  // Orange
                 else if (colorChoice == 1)
@@ -148,7 +156,8 @@ void emitEnemyThrustParticles(GameState* state, Enemy* enemy, int count) {
     float rearX = enemy->base.x - sin(radians) * visualRadius * config.rearOffset;
     float rearY = enemy->base.y + cos(radians) * visualRadius * config.rearOffset;
     
-    // Emit particles
+    // Emit particles, fewer when the quality governor is shedding load
+    count = scaleParticleCount(count);
     for (int i = 0; i < count; i++) {
         // Find an inactive particle
         for (int j = 0; j < MAX_PARTICLES; j++) {
@@ -161,20 +170,20 @@ void emitEnemyThrustParticles(GameState* state, Enemy* enemy, int count) {
                 state->particles[j].position.y = rearY;
                 
                 // Add randomness using config range
-                state->particles[j].position.x += GetRandomValue(-config.randomRange, config.randomRange);
-                state->particles[j].position.y += GetRandomValue(-config.randomRange, config.randomRange);
+                state->particles[j].position.x += getGameRandomValue(state, -config.randomRange, config.randomRange);
+                state->particles[j].position.y += getGameRandomValue(state, -config.randomRange, config.randomRange);
                 
                 // Set particle velocity in the opposite direction of the enemy
-                float particleAngle = radians + PI + GetRandomValue(-20, 20) * PI / 180.0f;
+                float particleAngle = radians + PI + getGameRandomValue(state, -20, 20) * PI / 180.0f;
                 float particleSpeed = PARTICLE_SPEED * config.speedMultiplier;
                 state->particles[j].velocity.x = sin(particleAngle) * particleSpeed;
                 state->particles[j].velocity.y = -cos(particleAngle) * particleSpeed;
                 
                 // Set particle size using config
-                state->particles[j].radius = GetRandomValue(config.minRadius, config.maxRadius);
+                state->particles[j].radius = getGameRandomValue(state, config.minRadius, config.maxRadius);
                 
                 // Set color using config colors
-                int colorChoice = GetRandomValue(0, 2);
+                int colorChoice = getGameRandomValue(state, 0, 2);
                 state->particles[j].color = config.colors[colorChoice];
                 
                 break;
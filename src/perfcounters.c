@@ -0,0 +1,232 @@
+#include <stdbool.h>
+#include <stdio.h>
+#include <string.h>
+
+// Custom headers
+#include "typedefs.h"
+#include "profiler.h"
+#include "perfcounters.h"
+#include "platform.h"
+
+#if defined(ASTEROIDS_PERF_COUNTERS) && defined(__linux__)
+
+#include <errno.h>
+#include <unistd.h>
+#include <sys/syscall.h>
+#include <linux/perf_event.h>
+
+typedef struct {
+    unsigned int type;
+    unsigned long long config;
+} PerfEventConfig;
+
+static const PerfEventConfig perfEvents[PERF_COUNTER_COUNT] = {
+    [PERF_CYCLES] = { PERF_TYPE_HARDWARE, PERF_COUNT_HW_CPU_CYCLES },
+    [PERF_INSTRUCTIONS] = { PERF_TYPE_HARDWARE, PERF_COUNT_HW_INSTRUCTIONS },
+    [PERF_L1D_MISSES] = { PERF_TYPE_HW_CACHE, PERF_COUNT_HW_CACHE_L1D | (PERF_COUNT_HW_CACHE_OP_READ << 8) |
+                                              (PERF_COUNT_HW_CACHE_RESULT_MISS << 16) },
+    [PERF_LLC_MISSES] = { PERF_TYPE_HARDWARE, PERF_COUNT_HW_CACHE_MISSES },
+    [PERF_BRANCH_MISSES] = { PERF_TYPE_HARDWARE, PERF_COUNT_HW_BRANCH_MISSES }
+};
+
+static const char* perfCounterNames[PERF_COUNTER_COUNT] = {
+    [PERF_CYCLES] = "cycles",
+    [PERF_INSTRUCTIONS] = "instructions",
+    [PERF_L1D_MISSES] = "L1D misses",
+    [PERF_LLC_MISSES] = "LLC misses",
+    [PERF_BRANCH_MISSES] = "branch misses"
+};
+
+// One counter group per thread, read with a single syscall. Counters the CPU or kernel
+// refuses are left out of the group; the rest still count.
+typedef struct {
+    bool opened;
+    int leader;                                  // Group leader's descriptor, -1 if nothing could be opened
+    int members;
+    PerfCounter counters[PERF_COUNTER_COUNT];    // Which counter each group member measures
+} PerfThreadCounters;
+
+static THREAD_LOCAL PerfThreadCounters threadCounters;
+
+// Self counts per subsystem from every thread, guarded by a spin lock (scopes end a few dozen times a frame)
+typedef struct {
+    PerfSample totals[SUBSYSTEM_COUNT];
+    long long passes[SUBSYSTEM_COUNT];
+    long long entities[SUBSYSTEM_COUNT];
+    bool available[PERF_COUNTER_COUNT];          // Opened on at least one thread
+    int openError;                               // errno of the first failed open, 0 if none
+} PerfTotals;
+
+static PerfTotals perfTotals;
+static volatile int perfTotalsLock = 0;
+
+static void lockPerfTotals(void) {
+    while (!atomicCompareExchange(&perfTotalsLock, 0, 1)) {
+    }
+}
+
+static void unlockPerfTotals(void) {
+    atomicStore(&perfTotalsLock, 0);
+}
+
+static int openPerfEvent(PerfCounter counter, int groupFd) {
+    struct perf_event_attr attr;
+    memset(&attr, 0, sizeof(attr));
+    attr.size = sizeof(attr);
+    attr.type = perfEvents[counter].type;
+    attr.config = perfEvents[counter].config;
+    attr.read_format = PERF_FORMAT_GROUP;
+    attr.exclude_kernel = 1;   // Also what an unprivileged user is allowed to count
+    attr.exclude_hv = 1;
+    
+    // Calling thread on any CPU; descriptors live until the process exits
+    return (int)syscall(SYS_perf_event_open, &attr, 0, -1, groupFd, 0);
+}
+
+// Open this thread's counters on first use
+static void openThreadCounters(void) {
+    PerfThreadCounters* thread = &threadCounters;
+    thread->opened = true;
+    thread->leader = -1;
+    thread->members = 0;
+    int error = 0;
+    
+    for (int counter = 0; counter < PERF_COUNTER_COUNT; counter++) {
+        int fd = openPerfEvent((PerfCounter)counter, thread->leader);
+        if (fd < 0) {
+            if (error == 0) error = errno;
+            continue;
+        }
+        if (thread->leader < 0) thread->leader = fd;
+        thread->counters[thread->members++] = (PerfCounter)counter;
+    }
+    
+    lockPerfTotals();
+    for (int i = 0; i < thread->members; i++) {
+        perfTotals.available[thread->counters[i]] = true;
+    }
+    if (perfTotals.openError == 0) perfTotals.openError = error;
+    unlockPerfTotals();
+}
+
+bool readPerfCounters(PerfSample* sample) {
+    if (!threadCounters.opened) openThreadCounters();
+    memset(sample, 0, sizeof(*sample));
+    if (threadCounters.leader < 0) return false;
+    
+    // Group layout: member count, then one value per member in open order
+    unsigned long long buffer[1 + PERF_COUNTER_COUNT];
+    ssize_t size = read(threadCounters.leader, buffer, sizeof(buffer));
+    if (size < (ssize_t)sizeof(unsigned long long)) return false;
+    
+    int members = (int)buffer[0] < threadCounters.members ? (int)buffer[0] : threadCounters.members;
+    for (int i = 0; i < members; i++) {
+        sample->values[threadCounters.counters[i]] = buffer[1 + i];
+    }
+    return true;
+}
+
+void addPerfCounters(SubsystemId subsystem, const PerfSample* self) {
+    lockPerfTotals();
+    for (int i = 0; i < PERF_COUNTER_COUNT; i++) {
+        perfTotals.totals[subsystem].values[i] += self->values[i];
+    }
+    perfTotals.passes[subsystem]++;
+    unlockPerfTotals();
+}
+
+// Entities the innermost open scope on this thread works through; call once per pass
+void countSubsystemEntities(int entities) {
+    SubsystemId subsystem = getCurrentSubsystem();
+    lockPerfTotals();
+    perfTotals.entities[subsystem] += entities;
+    unlockPerfTotals();
+}
+
+static void printPerCount(unsigned long long value, long long count, bool available) {
+    if (!available || count <= 0) {
+        printf(" %10s", "-");
+    } else {
+        printf(" %10.3f", (double)value / count);
+    }
+}
+
+void printPerfReport(void) {
+    lockPerfTotals();
+    PerfTotals totals = perfTotals;
+    unlockPerfTotals();
+    
+    bool anyAvailable = false;
+    for (int i = 0; i < PERF_COUNTER_COUNT; i++) anyAvailable |= totals.available[i];
+    if (!anyAvailable) {
+        printf("Hardware counters: unavailable (%s); check /proc/sys/kernel/perf_event_paranoid\n",
+               totals.openError != 0 ? strerror(totals.openError) : "never sampled");
+        return;
+    }
+    for (int i = 0; i < PERF_COUNTER_COUNT; i++) {
+        if (!totals.available[i]) printf("Hardware counters: %s not supported here\n", perfCounterNames[i]);
+    }
+    
+    // Misses are shown per pass and, where the pass reports its entities, per entity per pass
+    printf("Hardware counter report (self counts per subsystem scope):\n");
+    printf("  %-12s %8s %10s %10s %6s %10s %10s %10s %10s %10s %10s\n", "subsystem", "passes", "ent/pass",
+           "kcyc/pass", "IPC", "L1D/pass", "LLC/pass", "br/pass", "L1D/ent", "LLC/ent", "br/ent");
+    for (int scope = 0; scope < SUBSYSTEM_COUNT; scope++) {
+        long long passes = totals.passes[scope];
+        if (passes == 0) continue;
+        
+        const unsigned long long* values = totals.totals[scope].values;
+        long long entities = totals.entities[scope];
+        printf("  %-12s %8lld", getSubsystemName((SubsystemId)scope), passes);
+        if (entities > 0) {
+            printf(" %10.1f", (double)entities / passes);
+        } else {
+            printf(" %10s", "-");
+        }
+        
+        if (totals.available[PERF_CYCLES]) {
+            printf(" %10.1f", values[PERF_CYCLES] / 1000.0 / passes);
+        } else {
+            printf(" %10s", "-");
+        }
+        if (totals.available[PERF_CYCLES] && totals.available[PERF_INSTRUCTIONS] && values[PERF_CYCLES] > 0) {
+            printf(" %6.2f", (double)values[PERF_INSTRUCTIONS] / values[PERF_CYCLES]);
+        } else {
+            printf(" %6s", "-");
+        }
+        
+        printPerCount(values[PERF_L1D_MISSES], passes, totals.available[PERF_L1D_MISSES]);
+        printPerCount(values[PERF_LLC_MISSES], passes, totals.available[PERF_LLC_MISSES]);
+        printPerCount(values[PERF_BRANCH_MISSES], passes, totals.available[PERF_BRANCH_MISSES]);
+        printPerCount(values[PERF_L1D_MISSES], entities, totals.available[PERF_L1D_MISSES]);
+        printPerCount(values[PERF_LLC_MISSES], entities, totals.available[PERF_LLC_MISSES]);
+        printPerCount(values[PERF_BRANCH_MISSES], entities, totals.available[PERF_BRANCH_MISSES]);
+        printf("\n");
+    }
+}
+
+#else
+
+// Counters are compiled out; scopes only measure time
+
+bool readPerfCounters(PerfSample* sample) {
+    memset(sample, 0, sizeof(*sample));
+    return false;
+}
+
+void addPerfCounters(SubsystemId subsystem, const PerfSample* self) {
+    (void)subsystem;
+    (void)self;
+}
+
+void countSubsystemEntities(int entities) {
+    (void)entities;
+}
+
+void printPerfReport(void) {
+#ifdef ASTEROIDS_PERF_COUNTERS
+    printf("Hardware counters: only supported on Linux\n");
+#endif
+}
+
+#endif
\ No newline at end of file
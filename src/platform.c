@@ -0,0 +1,314 @@
+// No raylib here: windows.h clashes with several raylib names
+#include <stdbool.h>
+#include <stdio.h>
+#include <stdlib.h>
+
+#if defined(_WIN32)
+    #define WIN32_LEAN_AND_MEAN
+    #include <windows.h>
+    #include <io.h>
+#else
+    #include <pthread.h>
+    #include <time.h>
+    #include <errno.h>
+    #include <unistd.h>
+#endif
+
+// Custom headers
+#include "platform.h"
+
+// Entry point and argument carried into the new thread
+typedef struct {
+    PlatformThreadFunc func;
+    void* arg;
+} ThreadStart;
+
+#if defined(_WIN32)
+
+static DWORD mainThreadId = 0;
+
+static DWORD WINAPI threadEntry(LPVOID param) {
+    ThreadStart start = *(ThreadStart*)param;
+    free(param);
+    return (DWORD)start.func(start.arg);
+}
+
+bool createThread(PlatformThread* thread, PlatformThreadFunc func, void* arg) {
+    ThreadStart* start = (ThreadStart*)malloc(sizeof(ThreadStart));
+    if (start == NULL) return false;
+    start->func = func;
+    start->arg = arg;
+    
+    HANDLE handle = CreateThread(NULL, 0, threadEntry, start, 0, NULL);
+    if (handle == NULL) {
+        free(start);
+        return false;
+    }
+    thread->handle = handle;
+    return true;
+}
+
+void joinThread(PlatformThread* thread) {
+    if (thread->handle == NULL) return;
+    WaitForSingleObject((HANDLE)thread->handle, INFINITE);
+    CloseHandle((HANDLE)thread->handle);
+    thread->handle = NULL;
+}
+
+void markMainThread(void) {
+    mainThreadId = GetCurrentThreadId();
+}
+
+bool isMainThread(void) {
+    return GetCurrentThreadId() == mainThreadId;
+}
+
+int getProcessorCount(void) {
+    SYSTEM_INFO info;
+    GetSystemInfo(&info);
+    return (int)info.dwNumberOfProcessors;
+}
+
+bool createMutex(PlatformMutex* mutex) {
+    CRITICAL_SECTION* section = (CRITICAL_SECTION*)malloc(sizeof(CRITICAL_SECTION));
+    if (section == NULL) return false;
+    InitializeCriticalSection(section);
+    mutex->handle = section;
+    return true;
+}
+
+void lockMutex(PlatformMutex* mutex) {
+    EnterCriticalSection((CRITICAL_SECTION*)mutex->handle);
+}
+
+void unlockMutex(PlatformMutex* mutex) {
+    LeaveCriticalSection((CRITICAL_SECTION*)mutex->handle);
+}
+
+void destroyMutex(PlatformMutex* mutex) {
+    if (mutex->handle == NULL) return;
+    DeleteCriticalSection((CRITICAL_SECTION*)mutex->handle);
+    free(mutex->handle);
+    mutex->handle = NULL;
+}
+
+bool createCondition(PlatformCondition* condition) {
+    CONDITION_VARIABLE* variable = (CONDITION_VARIABLE*)malloc(sizeof(CONDITION_VARIABLE));
+    if (variable == NULL) return false;
+    InitializeConditionVariable(variable);
+    condition->handle = variable;
+    return true;
+}
+
+void waitCondition(PlatformCondition* condition, PlatformMutex* mutex) {
+    SleepConditionVariableCS((CONDITION_VARIABLE*)condition->handle, (CRITICAL_SECTION*)mutex->handle, INFINITE);
+}
+
+void signalCondition(PlatformCondition* condition) {
+    WakeConditionVariable((CONDITION_VARIABLE*)condition->handle);
+}
+
+void broadcastCondition(PlatformCondition* condition) {
+    WakeAllConditionVariable((CONDITION_VARIABLE*)condition->handle);
+}
+
+void destroyCondition(PlatformCondition* condition) {
+    free(condition->handle);
+    condition->handle = NULL;
+}
+
+int atomicLoad(volatile int* value) {
+    return (int)InterlockedCompareExchange((volatile LONG*)value, 0, 0);
+}
+
+void atomicStore(volatile int* value, int newValue) {
+    InterlockedExchange((volatile LONG*)value, newValue);
+}
+
+int atomicExchange(volatile int* value, int newValue) {
+    return (int)InterlockedExchange((volatile LONG*)value, newValue);
+}
+
+int atomicAdd(volatile int* value, int amount) {
+    return (int)InterlockedExchangeAdd((volatile LONG*)value, amount);
+}
+
+bool atomicCompareExchange(volatile int* value, int expected, int desired) {
+    return InterlockedCompareExchange((volatile LONG*)value, desired, expected) == expected;
+}
+
+double getMonotonicTime(void) {
+    static LARGE_INTEGER frequency = {0};
+    if (frequency.QuadPart == 0) QueryPerformanceFrequency(&frequency);
+    
+    LARGE_INTEGER counter;
+    QueryPerformanceCounter(&counter);
+    return (double)counter.QuadPart / (double)frequency.QuadPart;
+}
+
+void sleepSeconds(double seconds) {
+    if (seconds <= 0) return;
+    Sleep((DWORD)(seconds * 1000.0));
+}
+
+// Push buffered writes all the way to the disk
+bool syncFile(FILE* file) {
+    if (fflush(file) != 0) return false;
+    return _commit(_fileno(file)) == 0;
+}
+
+// Move source over destination in one step, so readers see either the old or the new file
+bool replaceFile(const char* source, const char* destination) {
+    return MoveFileExA(source, destination, MOVEFILE_REPLACE_EXISTING | MOVEFILE_WRITE_THROUGH) != 0;
+}
+
+#else
+
+static pthread_t mainThread;
+
+static void* threadEntry(void* param) {
+    ThreadStart start = *(ThreadStart*)param;
+    free(param);
+    start.func(start.arg);
+    return NULL;
+}
+
+bool createThread(PlatformThread* thread, PlatformThreadFunc func, void* arg) {
+    ThreadStart* start = (ThreadStart*)malloc(sizeof(ThreadStart));
+    pthread_t* handle = (pthread_t*)malloc(sizeof(pthread_t));
+    if (start == NULL || handle == NULL) {
+        free(start);
+        free(handle);
+        return false;
+    }
+    start->func = func;
+    start->arg = arg;
+    
+    if (pthread_create(handle, NULL, threadEntry, start) != 0) {
+        free(start);
+        free(handle);
+        return false;
+    }
+    thread->handle = handle;
+    return true;
+}
+
+void joinThread(PlatformThread* thread) {
+    if (thread->handle == NULL) return;
+    pthread_join(*(pthread_t*)thread->handle, NULL);
+    free(thread->handle);
+    thread->handle = NULL;
+}
+
+void markMainThread(void) {
+    mainThread = pthread_self();
+}
+
+bool isMainThread(void) {
+    return pthread_equal(pthread_self(), mainThread) != 0;
+}
+
+int getProcessorCount(void) {
+    long count = sysconf(_SC_NPROCESSORS_ONLN);
+    return count > 0 ? (int)count : 1;
+}
+
+bool createMutex(PlatformMutex* mutex) {
+    pthread_mutex_t* handle = (pthread_mutex_t*)malloc(sizeof(pthread_mutex_t));
+    if (handle == NULL) return false;
+    pthread_mutex_init(handle, NULL);
+    mutex->handle = handle;
+    return true;
+}
+
+void lockMutex(PlatformMutex* mutex) {
+    pthread_mutex_lock((pthread_mutex_t*)mutex->handle);
+}
+
+void unlockMutex(PlatformMutex* mutex) {
+    pthread_mutex_unlock((pthread_mutex_t*)mutex->handle);
+}
+
+void destroyMutex(PlatformMutex* mutex) {
+    if (mutex->handle == NULL) return;
+    pthread_mutex_destroy((pthread_mutex_t*)mutex->handle);
+    free(mutex->handle);
+    mutex->handle = NULL;
+}
+
+bool createCondition(PlatformCondition* condition) {
+    pthread_cond_t* handle = (pthread_cond_t*)malloc(sizeof(pthread_cond_t));
+    if (handle == NULL) return false;
+    pthread_cond_init(handle, NULL);
+    condition->handle = handle;
+    return true;
+}
+
+void waitCondition(PlatformCondition* condition, PlatformMutex* mutex) {
+    pthread_cond_wait((pthread_cond_t*)condition->handle, (pthread_mutex_t*)mutex->handle);
+}
+
+void signalCondition(PlatformCondition* condition) {
+    pthread_cond_signal((pthread_cond_t*)condition->handle);
+}
+
+void broadcastCondition(PlatformCondition* condition) {
+    pthread_cond_broadcast((pthread_cond_t*)condition->handle);
+}
+
+void destroyCondition(PlatformCondition* condition) {
+    if (condition->handle == NULL) return;
+    pthread_cond_destroy((pthread_cond_t*)condition->handle);
+    free(condition->handle);
+    condition->handle = NULL;
+}
+
+int atomicLoad(volatile int* value) {
+    return __atomic_load_n(value, __ATOMIC_SEQ_CST);
+}
+
+void atomicStore(volatile int* value, int newValue) {
+    __atomic_store_n(value, newValue, __ATOMIC_SEQ_CST);
+}
+
+int atomicExchange(volatile int* value, int newValue) {
+    return __atomic_exchange_n(value, newValue, __ATOMIC_SEQ_CST);
+}
+
+int atomicAdd(volatile int* value, int amount) {
+    return __atomic_fetch_add(value, amount, __ATOMIC_SEQ_CST);
+}
+
+bool atomicCompareExchange(volatile int* value, int expected, int desired) {
+    return __atomic_compare_exchange_n(value, &expected, desired, false, __ATOMIC_SEQ_CST, __ATOMIC_SEQ_CST);
+}
+
+double getMonotonicTime(void) {
+    struct timespec now;
+    clock_gettime(CLOCK_MONOTONIC, &now);
+    return (double)now.tv_sec + (double)now.tv_nsec / 1e9;
+}
+
+void sleepSeconds(double seconds) {
+    if (seconds <= 0) return;
+    
+    struct timespec duration;
+    duration.tv_sec = (time_t)seconds;
+    duration.tv_nsec = (long)((seconds - (double)duration.tv_sec) * 1e9);
+    while (nanosleep(&duration, &duration) != 0 && errno == EINTR) {
+        // Keep sleeping for whatever is left after a signal
+    }
+}
+
+// Push buffered writes all the way to the disk
+bool syncFile(FILE* file) {
+    if (fflush(file) != 0) return false;
+    return fsync(fileno(file)) == 0;
+}
+
+// Move source over destination in one step, so readers see either the old or the new file
+bool replaceFile(const char* source, const char* destination) {
+    return rename(source, destination) == 0;
+}
+
+#endif
\ No newline at end of file
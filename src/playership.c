@@ -10,6 +10,15 @@
 // Custom headers
 #include "typedefs.h"
 #include "config.h"
+#include "audio.h"
+#include "telemetry.h"
+#include "timerwheel.h"
+#include "lifecycle.h"
+
+// Ticks before a weapon with this cooldown (in seconds) can fire again
+unsigned int getWeaponCooldownTicks(float cooldown) {
+    return ticksFromSeconds(cooldown * WEAPON_COOLDOWN_SCALE);
+}
 
 void fireWeapon(GameState* state) {
     // Check ammo based on current weapon
@@ -28,20 +37,17 @@ void fireWeapon(GameState* state) {
     }
     
     // Check weapon-specific fire rate limitations
-    if (state->currentWeapon == WEAPON_SHOTGUN && state->shotgunFireTimer > 0) {
+    if (state->currentWeapon == WEAPON_SHOTGUN && state->simTick < state->shotgunReadyTick) {
         return; // Shotgun still on cooldown
     }
     
-    if (state->currentWeapon == WEAPON_GRENADE && state->grenadeFireTimer > 0) {
+    if (state->currentWeapon == WEAPON_GRENADE && state->simTick < state->grenadeReadyTick) {
         return; // Grenade still on cooldown
     }
     
-    // Get mouse position in world space
-    Vector2 mousePosition = GetScreenToWorld2D(GetMousePosition(), state->camera);
-    
-    // Calculate direction from ship to mouse cursor
-    float dx = mousePosition.x - state->ship.base.x;
-    float dy = mousePosition.y - state->ship.base.y;
+    // Aim at the cursor position sampled for this tick
+    float dx = state->aimPosition.x - state->ship.base.x;
+    float dy = state->aimPosition.y - state->ship.base.y;
     float length = sqrt(dx * dx + dy * dy);
     
     // Normalize the direction
@@ -57,7 +63,7 @@ void fireWeapon(GameState* state) {
         
         for (int i = 0; i < MAX_BULLETS && pelletsSpawned < pelletsToFire; i++) {
             if (!state->bullets[i].active) {
-                state->bullets[i].active = true;
+                spawnEntity(state, ENTITY_BULLET, i);
                 
                 // Start the bullet at the ship's position
                 state->bullets[i].x = state->ship.base.x;
@@ -75,16 +81,18 @@ void fireWeapon(GameState* state) {
                 // Set bullet velocity with spread
                 state->bullets[i].dx = spreadDx * BULLET_SPEED;
                 state->bullets[i].dy = spreadDy * BULLET_SPEED;
+                state->bulletWeapon[i] = WEAPON_SHOTGUN;
                 
                 pelletsSpawned++;
             }
         }
+        recordGameTelemetry(state, TELEMETRY_SHOT, WEAPON_SHOTGUN, pelletsSpawned);
         
         // Decrease shotgun ammo
         state->shotgunAmmo--;
         
         // Set shotgun cooldown timer
-        state->shotgunFireTimer = SHOTGUN_FIRE_RATE;
+        state->shotgunReadyTick = state->simTick + getWeaponCooldownTicks(SHOTGUN_FIRE_RATE);
         
         // Switch back to normal weapon when out of shotgun ammo
         if (state->shotgunAmmo <= 0) {
@@ -93,18 +101,17 @@ void fireWeapon(GameState* state) {
             state->normalAmmo = MAX_AMMO;
             // Cancel any ongoing reload since we now have full ammo
             state->isReloading = false;
-            state->reloadTimer = 0.0f;
         }
     } else if (state->currentWeapon == WEAPON_GRENADE) {
         // Fire grenade (use enemy bullet system but mark as player bullet)
         for (int i = 0; i < MAX_ENEMY_BULLETS; i++) {
             if (!state->enemyBullets[i].base.active) {
-                state->enemyBullets[i].base.active = true;
+                spawnEntity(state, ENTITY_ENEMY_BULLET, i);
                 
                 // Set grenade properties
                 state->enemyBullets[i].damage = PLAYER_GRENADE_EXPLOSION_DAMAGE;
                 state->enemyBullets[i].type = BULLET_GRENADE;
-                state->enemyBullets[i].timer = PLAYER_GRENADE_TIMER;
+                state->enemyBullets[i].fuseTick = scheduleGameTimer(state, PLAYER_GRENADE_TIMER, TIMER_GRENADE_FUSE, i);
                 state->enemyBullets[i].hasExploded = false;
                 state->enemyBullets[i].isPlayerBullet = true; // Mark as player bullet
                 
@@ -117,6 +124,7 @@ void fireWeapon(GameState* state) {
                 state->enemyBullets[i].base.dx = dx * BULLET_SPEED * 0.7f;
                 state->enemyBullets[i].base.dy = dy * BULLET_SPEED * 0.7f;
                 
+                recordGameTelemetry(state, TELEMETRY_SHOT, WEAPON_GRENADE, 1);
                 break;
             }
         }
@@ -125,7 +133,7 @@ void fireWeapon(GameState* state) {
         state->grenadeAmmo--;
         
         // Set grenade cooldown timer
-        state->grenadeFireTimer = GRENADE_FIRE_RATE;
+        state->grenadeReadyTick = state->simTick + getWeaponCooldownTicks(GRENADE_FIRE_RATE);
         
         // Switch back to normal weapon when out of grenade ammo
         if (state->grenadeAmmo <= 0) {
@@ -134,13 +142,12 @@ void fireWeapon(GameState* state) {
             state->normalAmmo = MAX_AMMO;
             // Cancel any ongoing reload since we now have full ammo
             state->isReloading = false;
-            state->reloadTimer = 0.0f;
         }
     } else {
         // Fire normal weapon
         for (int i = 0; i < MAX_BULLETS; i++) {
             if (!state->bullets[i].active) {
-                state->bullets[i].active = true;
+                spawnEntity(state, ENTITY_BULLET, i);
                 
                 // Start the bullet at the ship's position
                 state->bullets[i].x = state->ship.base.x;
@@ -150,6 +157,9 @@ void fireWeapon(GameState* state) {
                 // Set bullet velocity toward the mouse cursor
                 state->bullets[i].dx = dx * BULLET_SPEED;
                 state->bullets[i].dy = dy * BULLET_SPEED;
+                state->bulletWeapon[i] = WEAPON_NORMAL;
+                
+                recordGameTelemetry(state, TELEMETRY_SHOT, WEAPON_NORMAL, 1);
                 
                 // Only fire one bullet at a time for normal weapon
                 break;
@@ -162,11 +172,11 @@ void fireWeapon(GameState* state) {
         // Start reloading if out of ammo
         if (state->normalAmmo <= 0) {
             state->isReloading = true;
-            state->reloadTimer = RELOAD_TIME;
+            state->reloadDoneTick = scheduleGameTimer(state, RELOAD_TIME, TIMER_RELOAD, -1);
             
             // Play reload start sound
             if (state->soundLoaded) {
-                PlaySound(state->sounds[SOUND_RELOAD_START]);
+                playGameSound(state, SOUND_RELOAD_START);
             }
         }
     }
@@ -174,15 +184,9 @@ void fireWeapon(GameState* state) {
     // Play shooting sound effect
     if (state->soundLoaded) {
         // If we're firing rapidly, reduce volume slightly to prevent audio overload
-        float volumeMultiplier = state->fireTimer < 0.05f ? 0.6f : 1.0f;
-        
-        // Set the specific sound volume for this shot
-        SetSoundVolume(state->sounds[SOUND_SHOOT], state->soundVolume * volumeMultiplier);
-        
-        // Play the sound
-        PlaySound(state->sounds[SOUND_SHOOT]);
+        float volumeMultiplier = state->simTick < state->fireReadyTick + ticksFromSeconds(0.05f) ? 0.6f : 1.0f;
         
-        // Reset to normal volume for next time
-        SetSoundVolume(state->sounds[SOUND_SHOOT], state->soundVolume);
+        // Play the sound at that volume (applied when the main thread plays it)
+        playGameSoundScaled(state, SOUND_SHOOT, volumeMultiplier);
     }
 }
\ No newline at end of file
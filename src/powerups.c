@@ -9,18 +9,20 @@
 #include "audio.h"
 #include "collisions.h"
 #include "resources.h" 
+#include "random.h"
+#include "timerwheel.h"
+#include "lifecycle.h"
 
 
 void spawnHealthPowerup(GameState* state, float x, float y) {
     // Check drop chance
-    if (GetRandomValue(1, 100) > HEALTH_POWERUP_DROP_CHANCE) {
+    if (getGameRandomValue(state, 1, 100) > HEALTH_POWERUP_DROP_CHANCE) {
         return; // No powerup dropped
     }
     
     // Find an inactive powerup slot
     for (int i = 0; i < MAX_POWERUPS; i++) {
         if (!state->powerups[i].base.active) {
-            state->powerups[i].base.active = true;
             state->powerups[i].base.x = x;
             state->powerups[i].base.y = y;
             state->powerups[i].base.radius = 15.0f;
@@ -28,12 +30,13 @@ void spawnHealthPowerup(GameState* state, float x, float y) {
             state->powerups[i].base.dy = 0;
             state->powerups[i].base.angle = 0;
             state->powerups[i].type = POWERUP_HEALTH;
-            state->powerups[i].lifetime = POWERUP_LIFETIME;
+            state->powerups[i].expireTick = scheduleGameTimer(state, POWERUP_LIFETIME, TIMER_POWERUP_EXPIRY, i);
             state->powerups[i].pulseTimer = 0.0f;
             
             // Try to load health powerup texture
             state->powerups[i].texture = loadTextureOnce(HEALTH_POWERUP_TEXTURE_PATH);
             
+            spawnEntity(state, ENTITY_POWERUP, i);
             break;
         }
     }
@@ -41,14 +44,13 @@ void spawnHealthPowerup(GameState* state, float x, float y) {
 
 void spawnLifePowerup(GameState* state, float x, float y) {
     // Check drop chance
-    if (GetRandomValue(1, 100) > LIFE_POWERUP_DROP_CHANCE) {
+    if (getGameRandomValue(state, 1, 100) > LIFE_POWERUP_DROP_CHANCE) {
         return; // No powerup dropped
     }
     
     // Find an inactive powerup slot
     for (int i = 0; i < MAX_POWERUPS; i++) {
         if (!state->powerups[i].base.active) {
-            state->powerups[i].base.active = true;
             state->powerups[i].base.x = x;
             state->powerups[i].base.y = y;
             state->powerups[i].base.radius = 15.0f;
@@ -56,12 +58,13 @@ void spawnLifePowerup(GameState* state, float x, float y) {
             state->powerups[i].base.dy = 0;
             state->powerups[i].base.angle = 0;
             state->powerups[i].type = POWERUP_LIFE;
-            state->powerups[i].lifetime = POWERUP_LIFETIME;
+            state->powerups[i].expireTick = scheduleGameTimer(state, POWERUP_LIFETIME, TIMER_POWERUP_EXPIRY, i);
             state->powerups[i].pulseTimer = 0.0f;
             
             // Try to load life powerup texture
             state->powerups[i].texture = loadTextureOnce(LIFE_POWERUP_TEXTURE_PATH);
             
+            spawnEntity(state, ENTITY_POWERUP, i);
             break;
         }
     }
@@ -70,7 +73,6 @@ void spawnLifePowerup(GameState* state, float x, float y) {
 void spawnShotgunPowerup(GameState* state, float x, float y) {
     for (int i = 0; i < MAX_POWERUPS; i++) {
         if (!state->powerups[i].base.active) {
-            state->powerups[i].base.active = true;
             state->powerups[i].base.x = x;
             state->powerups[i].base.y = y;
             state->powerups[i].base.radius = 15.0f;
@@ -78,12 +80,13 @@ void spawnShotgunPowerup(GameState* state, float x, float y) {
             state->powerups[i].base.dx = 0.0f;
             state->powerups[i].base.dy = 0.0f;
             state->powerups[i].type = POWERUP_SHOTGUN;
-            state->powerups[i].lifetime = 15.0f; // 15 second lifetime
+            state->powerups[i].expireTick = scheduleGameTimer(state, 15.0f, TIMER_POWERUP_EXPIRY, i); // 15 second lifetime
             state->powerups[i].pulseTimer = 0.0f;
             
             // Try to load shotgun powerup texture
             state->powerups[i].texture = loadTextureOnce(SHOTGUN_POWERUP_TEXTURE_PATH);
             
+            spawnEntity(state, ENTITY_POWERUP, i);
             break;
         }
     }
@@ -92,7 +95,6 @@ void spawnShotgunPowerup(GameState* state, float x, float y) {
 void spawnGrenadePowerup(GameState* state, float x, float y) {
     for (int i = 0; i < MAX_POWERUPS; i++) {
         if (!state->powerups[i].base.active) {
-            state->powerups[i].base.active = true;
             state->powerups[i].base.x = x;
             state->powerups[i].base.y = y;
             state->powerups[i].base.radius = 15.0f;
@@ -100,17 +102,27 @@ void spawnGrenadePowerup(GameState* state, float x, float y) {
             state->powerups[i].base.dx = 0.0f;
             state->powerups[i].base.dy = 0.0f;
             state->powerups[i].type = POWERUP_GRENADE;
-            state->powerups[i].lifetime = 15.0f; // 15 second lifetime
+            state->powerups[i].expireTick = scheduleGameTimer(state, 15.0f, TIMER_POWERUP_EXPIRY, i); // 15 second lifetime
             state->powerups[i].pulseTimer = 0.0f;
             
             // Try to load grenade powerup texture
             state->powerups[i].texture = loadTextureOnce(GRENADE_POWERUP_TEXTURE_PATH);
             
+            spawnEntity(state, ENTITY_POWERUP, i);
             break;
         }
     }
 }
 
+// Timer wheel event: the powerup in slot i has run out of time, unless it was collected
+// (and maybe replaced) before its deadline
+void expirePowerup(GameState* state, int i, unsigned int deadline) {
+    Powerup* powerup = &state->powerups[i];
+    if (!powerup->base.active || powerup->expireTick != deadline) return;
+    
+    despawnEntity(state, ENTITY_POWERUP, i, DESPAWN_EXPIRED);
+}
+
 void updatePowerups(GameState* state, float deltaTime) {
     for (int i = 0; i < MAX_POWERUPS; i++) {
         if (state->powerups[i].base.active) {
@@ -119,17 +131,6 @@ void updatePowerups(GameState* state, float deltaTime) {
             // Update pulse timer for visual effect
             powerup->pulseTimer += deltaTime * 4.0f;
             
-            // Update lifetime
-            powerup->lifetime -= deltaTime;
-            if (powerup->lifetime <= 0.0f) {
-                powerup->base.active = false;
-                if (powerup->texture.id > 0) {
-                    UnloadTexture(powerup->texture);
-                    powerup->texture.id = 0;
-                }
-                continue;
-            }
-            
             // Check for collision with player
             if (checkCollision(&state->ship.base, &powerup->base)) {
                 if (powerup->type == POWERUP_HEALTH) {
@@ -140,7 +141,7 @@ void updatePowerups(GameState* state, float deltaTime) {
                     }
                     // Play pickup sound 
                     if (state->soundLoaded) {
-                        PlaySound(state->sounds[SOUND_POWERUP_PICKUP]);
+                        playGameSound(state, SOUND_POWERUP_PICKUP);
                     }
                 } else if (powerup->type == POWERUP_SHOTGUN) {
                     // Give player shotgun weapon
@@ -149,11 +150,10 @@ void updatePowerups(GameState* state, float deltaTime) {
                     // Cancel any ongoing reload when switching weapons
                     if (state->isReloading) {
                         state->isReloading = false;
-                        state->reloadTimer = 0.0f;
                     }
                     // Play pickup sound 
                     if (state->soundLoaded) {
-                        PlaySound(state->sounds[SOUND_POWERUP_PICKUP]);
+                        playGameSound(state, SOUND_POWERUP_PICKUP);
                     }
                 } else if (powerup->type == POWERUP_GRENADE) {
                     // Give player grenade weapon
@@ -162,27 +162,22 @@ void updatePowerups(GameState* state, float deltaTime) {
                     // Cancel any ongoing reload when switching weapons
                     if (state->isReloading) {
                         state->isReloading = false;
-                        state->reloadTimer = 0.0f;
                     }
                     // Play pickup sound 
                     if (state->soundLoaded) {
-                        PlaySound(state->sounds[SOUND_POWERUP_PICKUP]);
+                        playGameSound(state, SOUND_POWERUP_PICKUP);
                     }
                 }  else if (powerup->type == POWERUP_LIFE) {
                     // Give player an extra life
                     state->lives++;
                     // Play pickup sound 
                     if (state->soundLoaded) {
-                        PlaySound(state->sounds[SOUND_POWERUP_PICKUP]);
+                        playGameSound(state, SOUND_POWERUP_PICKUP);
                     }
                 }
                 
-                // Deactivate powerup
-                powerup->base.active = false;
-                if (powerup->texture.id > 0) {
-                    UnloadTexture(powerup->texture);
-                    powerup->texture.id = 0;
-                }
+                // Deactivate powerup; the despawn event records the pickup and frees its texture
+                despawnEntity(state, ENTITY_POWERUP, i, DESPAWN_COLLECTED);
             }
         }
     }
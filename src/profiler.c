@@ -0,0 +1,110 @@
+#include <stdbool.h>
+#include <stdio.h>
+
+// Custom headers
+#include "typedefs.h"
+#include "config.h"
+#include "profiler.h"
+#include "platform.h"
+#include "perfcounters.h"
+
+static const char* subsystemNames[SUBSYSTEM_COUNT] = {
+    [SUBSYSTEM_OTHER] = "other",
+    [SUBSYSTEM_INPUT] = "input",
+    [SUBSYSTEM_SIMULATION] = "simulation",
+    [SUBSYSTEM_COLLISIONS] = "collisions",
+    [SUBSYSTEM_ENEMIES] = "enemies",
+    [SUBSYSTEM_PARTICLES] = "particles",
+    [SUBSYSTEM_POWERUPS] = "powerups",
+    [SUBSYSTEM_RENDER] = "render",
+    [SUBSYSTEM_AUDIO] = "audio",
+    [SUBSYSTEM_RESOURCES] = "resources",
+    [SUBSYSTEM_IO] = "io"
+};
+
+typedef struct {
+    SubsystemId subsystem;
+    double start;
+    double childTime;   // Time spent in nested scopes, charged to them instead
+#ifdef ASTEROIDS_PERF_COUNTERS
+    PerfSample startCounts;
+    PerfSample childCounts;
+#endif
+} SubsystemScope;
+
+// Each thread keeps its own stack of open scopes; scopes nested deeper than the stack still balance
+static THREAD_LOCAL SubsystemScope scopeStack[MAX_SUBSYSTEM_DEPTH];
+static THREAD_LOCAL int scopeDepth = 0;
+
+// Self time per subsystem since the last collectSubsystemTimes, in microseconds, from every thread
+static volatile int subsystemMicros[SUBSYSTEM_COUNT];
+
+// Off for headless batch runs: nothing collects the totals there, and every scope exit on every
+// worker would contend on the same counters
+static bool subsystemTiming = true;
+
+void setSubsystemTiming(bool enabled) {
+    subsystemTiming = enabled;
+}
+
+void beginSubsystem(SubsystemId subsystem) {
+    if (scopeDepth < MAX_SUBSYSTEM_DEPTH) {
+        SubsystemScope* scope = &scopeStack[scopeDepth];
+        scope->subsystem = subsystem;
+        scope->childTime = 0.0;
+#ifdef ASTEROIDS_PERF_COUNTERS
+        scope->childCounts = (PerfSample){0};
+        readPerfCounters(&scope->startCounts);
+#endif
+        scope->start = subsystemTiming ? getMonotonicTime() : 0.0;
+    }
+    scopeDepth++;
+}
+
+void endSubsystem(void) {
+    if (scopeDepth == 0) return;
+    
+    scopeDepth--;
+    if (scopeDepth >= MAX_SUBSYSTEM_DEPTH) return;
+    
+    SubsystemScope* scope = &scopeStack[scopeDepth];
+#ifdef ASTEROIDS_PERF_COUNTERS
+    PerfSample counts;
+    if (readPerfCounters(&counts)) {
+        PerfSample self;
+        for (int i = 0; i < PERF_COUNTER_COUNT; i++) {
+            counts.values[i] -= scope->startCounts.values[i];
+            self.values[i] = counts.values[i] - scope->childCounts.values[i];
+            if (scopeDepth > 0) scopeStack[scopeDepth - 1].childCounts.values[i] += counts.values[i];
+        }
+        addPerfCounters(scope->subsystem, &self);
+    }
+#endif
+    if (!subsystemTiming) return;
+    
+    double elapsed = getMonotonicTime() - scope->start;
+    atomicAdd(&subsystemMicros[scope->subsystem], (int)((elapsed - scope->childTime) * 1000000.0));
+    if (scopeDepth > 0) {
+        scopeStack[scopeDepth - 1].childTime += elapsed;
+    }
+}
+
+// Innermost open scope on the calling thread
+SubsystemId getCurrentSubsystem(void) {
+    if (scopeDepth == 0) return SUBSYSTEM_OTHER;
+    
+    int top = scopeDepth < MAX_SUBSYSTEM_DEPTH ? scopeDepth : MAX_SUBSYSTEM_DEPTH;
+    return scopeStack[top - 1].subsystem;
+}
+
+// Seconds each subsystem spent since the previous call; called once per frame on the main thread
+void collectSubsystemTimes(float times[SUBSYSTEM_COUNT]) {
+    for (int i = 0; i < SUBSYSTEM_COUNT; i++) {
+        times[i] = atomicExchange(&subsystemMicros[i], 0) / 1000000.0f;
+    }
+}
+
+const char* getSubsystemName(SubsystemId subsystem) {
+    if (subsystem < 0 || subsystem >= SUBSYSTEM_COUNT) return "unknown";
+    return subsystemNames[subsystem];
+}
\ No newline at end of file
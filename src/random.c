@@ -0,0 +1,54 @@
+#include <stdbool.h>
+#include <stdlib.h>
+
+// Custom headers
+#include "typedefs.h"
+#include "config.h"
+#include "random.h"
+
+static unsigned int rotateLeft(unsigned int value, int bits) {
+    return (value << bits) | (value >> (32 - bits));
+}
+
+// Expand one seed into well-mixed generator words
+static unsigned long long splitMix64(unsigned long long* seed) {
+    unsigned long long z = (*seed += 0x9E3779B97F4A7C15ull);
+    z = (z ^ (z >> 30)) * 0xBF58476D1CE4E5B9ull;
+    z = (z ^ (z >> 27)) * 0x94D049BB133111EBull;
+    return z ^ (z >> 31);
+}
+
+// xoshiro128**, the generator behind GetRandomValue, with its state kept per game
+static unsigned int nextGameRandom(GameState* state) {
+    unsigned int* s = state->randomState;
+    unsigned int result = rotateLeft(s[1] * 5, 7) * 9;
+    unsigned int t = s[1] << 9;
+    
+    s[2] ^= s[0];
+    s[3] ^= s[1];
+    s[1] ^= s[2];
+    s[0] ^= s[3];
+    s[2] ^= t;
+    s[3] = rotateLeft(s[3], 11);
+    return result;
+}
+
+void seedGameRandom(GameState* state, unsigned int seed) {
+    unsigned long long mix = seed;
+    unsigned long long first = splitMix64(&mix);
+    unsigned long long second = splitMix64(&mix);
+    state->randomState[0] = (unsigned int)first;
+    state->randomState[1] = (unsigned int)(first >> 32);
+    state->randomState[2] = (unsigned int)second;
+    state->randomState[3] = (unsigned int)(second >> 32);
+}
+
+// Uniform integer in [min, max], both ends included, like GetRandomValue
+int getGameRandomValue(GameState* state, int min, int max) {
+    if (min > max) {
+        int swap = min;
+        min = max;
+        max = swap;
+    }
+    return (int)(nextGameRandom(state) % ((unsigned int)(max - min) + 1)) + min;
+}
\ No newline at end of file
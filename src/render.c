@@ -13,17 +13,91 @@
 #include "enemies.h"
 #include "powerups.h"
 #include "scoreboard.h"
+#include "culling.h"
+#include "background.h"
+#include "hud.h"
+#include "panels.h"
+#include "layers.h"
+#include "viewport.h"
+#include "governor.h"
+#include "asteroidmesh.h"
+#include "rendercmd.h"
+#include "simulation.h"
+#include "memtrack.h"
+#include "flightrecorder.h"
 
-void renderPowerups(const GameState* state) {
+// Get a cull radius that covers a rotated texture as well as the hitbox
+static float getTextureCullRadius(Texture2D texture, float scale, float radius) {
+    if (texture.id == 0) return radius;
+    float halfDiagonal = sqrtf((float)(texture.width * texture.width + texture.height * texture.height)) * scale / 2.0f;
+    return fmaxf(halfDiagonal, radius);
+}
+
+// Last gameplay frame, shown under the pause menu
+typedef struct {
+    RenderTexture2D frame;
+    int windowWidth;
+    int windowHeight;
+    bool valid;
+    bool loaded;
+} PauseSnapshot;
+
+static PauseSnapshot pauseSnapshot = {0};
+static RenderSnapshot pauseView;
+
+static void renderWorld(const RenderSnapshot* state);
+
+// Render the world into the pause snapshot if it isn't already frozen
+static void updatePauseSnapshot(const GameState* state) {
+    if (windowSizeChanged(&pauseSnapshot.windowWidth, &pauseSnapshot.windowHeight)) {
+        pauseSnapshot.valid = false;
+    }
+    
+    if (!pauseSnapshot.loaded) {
+        pauseSnapshot.frame = LoadRenderTexture(WINDOW_WIDTH, WINDOW_HEIGHT);
+        noteAssetLoad();
+        pauseSnapshot.loaded = true;
+        pauseSnapshot.valid = false;
+    }
+    
+    if (pauseSnapshot.valid) return;
+    
+    // The simulation is parked while paused, so the game state can be read directly
+    captureRenderSnapshot(state, NULL, &pauseView);
+    
+    BeginTextureMode(pauseSnapshot.frame);
+    ClearBackground(SPACE_COLOR);
+    renderWorld(&pauseView);
+    EndTextureMode();
+    pauseSnapshot.valid = true;
+}
+
+void unloadPauseSnapshot(void) {
+    if (!pauseSnapshot.loaded) return;
+    
+    UnloadRenderTexture(pauseSnapshot.frame);
+    pauseSnapshot.loaded = false;
+    pauseSnapshot.valid = false;
+}
+
+void renderPowerups(const RenderSnapshot* state) {
+    Rectangle view = getCameraView(state->camera);
+    
     for (int i = 0; i < MAX_POWERUPS; i++) {
         if (state->powerups[i].base.active) {
             const Powerup* powerup = &state->powerups[i];
             
+            // Skip powerups outside the camera view
+            float cullRadius = getTextureCullRadius(powerup->texture, POWERUP_TEXTURE_SCALE, powerup->base.radius);
+            if (!cullCircle(view, CULL_POWERUPS, powerup->base.x, powerup->base.y, cullRadius)) {
+                continue;
+            }
+            
             // Calculate pulsing effect
             float pulseAlpha = 0.7f + 0.3f * sinf(powerup->pulseTimer);
             
             // Flash faster when about to expire
-            if (powerup->lifetime < 3.0f) {
+            if (powerup->expireTick < state->simTick + 3 * SIM_TICK_RATE) {
                 pulseAlpha = 0.5f + 0.5f * sinf(powerup->pulseTimer * 3.0f);
             }
             
@@ -41,7 +115,7 @@ void renderPowerups(const GameState* state) {
                 Color tintColor = WHITE;
                 tintColor.a = (unsigned char)(255 * pulseAlpha);
                 
-                DrawTexturePro(powerup->texture, source, dest, origin, powerup->base.angle, tintColor);
+                pushSprite(LAYER_POWERUPS, powerup->texture, source, dest, origin, powerup->base.angle, tintColor);
             } else {
                 // Fallback: draw as colored circle
                 Color powerupColor;
@@ -63,34 +137,34 @@ void renderPowerups(const GameState* state) {
                         break;
                 }
                 
-                DrawCircleV((Vector2){powerup->base.x, powerup->base.y}, powerup->base.radius, powerupColor);
+                pushCircle(LAYER_POWERUPS, (Vector2){powerup->base.x, powerup->base.y}, powerup->base.radius, powerupColor);
                 
                 // Draw appropriate symbol
                 if (powerup->type == POWERUP_HEALTH) {
                     // Draw a cross for health powerup
                     Color crossColor = {255, 255, 255, (unsigned char)(255 * pulseAlpha)};
                     float crossSize = powerup->base.radius * 0.6f;
-                    DrawRectangle(powerup->base.x - 2, powerup->base.y - crossSize, 4, crossSize * 2, crossColor);
-                    DrawRectangle(powerup->base.x - crossSize, powerup->base.y - 2, crossSize * 2, 4, crossColor);
+                    pushRectangle(LAYER_POWERUPS, (Rectangle){powerup->base.x - 2, powerup->base.y - crossSize, 4, crossSize * 2}, crossColor);
+                    pushRectangle(LAYER_POWERUPS, (Rectangle){powerup->base.x - crossSize, powerup->base.y - 2, crossSize * 2, 4}, crossColor);
                 } else if (powerup->type == POWERUP_SHOTGUN) {
                     // Draw "S" for shotgun powerup
                     Color textColor = {255, 255, 255, (unsigned char)(255 * pulseAlpha)};
-                    DrawText("S", powerup->base.x - 6, powerup->base.y - 8, 16, textColor);
+                    pushText(LAYER_POWERUPS, "S", (Vector2){powerup->base.x - 6, powerup->base.y - 8}, 16, textColor);
                 } else if (powerup->type == POWERUP_GRENADE) {
                     // Draw "G" for grenade powerup
                     Color textColor = {255, 255, 255, (unsigned char)(255 * pulseAlpha)};
-                    DrawText("G", powerup->base.x - 6, powerup->base.y - 8, 16, textColor);
+                    pushText(LAYER_POWERUPS, "G", (Vector2){powerup->base.x - 6, powerup->base.y - 8}, 16, textColor);
                 } else if (powerup->type == POWERUP_LIFE) {
                     // Draw "1UP" for life powerup
                     Color textColor = {255, 255, 0, (unsigned char)(255 * pulseAlpha)};
-                    DrawText("1UP", powerup->base.x - 12, powerup->base.y - 8, 14, textColor);
+                    pushText(LAYER_POWERUPS, "1UP", (Vector2){powerup->base.x - 12, powerup->base.y - 8}, 14, textColor);
                 }
             }
         }
     }
 }
 
-void renderGameObject(const GameObject* obj, int sides, const GameState* state) {
+void renderGameObject(const GameObject* obj, int sides, const RenderSnapshot* state) {
     if (sides <= 0 || !obj->active) return;
     
     // Skip rendering the ship if it's in the invisible part of the blinking cycle
@@ -113,7 +187,7 @@ void renderGameObject(const GameObject* obj, int sides, const GameState* state)
             };
             
             // Draw the ship texture rotated (image is facing north)
-            DrawTexturePro(state->ship.texture, source, dest, origin, obj->angle, WHITE);
+            pushSprite(LAYER_SHIP, state->ship.texture, source, dest, origin, obj->angle, WHITE);
         }
         
         // Draw hitbox lines in debug mode or as fallback
@@ -137,9 +211,9 @@ void renderGameObject(const GameObject* obj, int sides, const GameState* state)
             
             // Draw the hitbox lines (semi-transparent when debug mode is on)
             Color hitboxColor = state->Debug ? (Color){0, 255, 0, 100} : GREEN;
-            DrawLineV(points[0], points[1], hitboxColor);
-            DrawLineV(points[1], points[2], hitboxColor);
-            DrawLineV(points[2], points[0], hitboxColor);
+            pushLine(LAYER_OVERLAY, points[0], points[1], hitboxColor);
+            pushLine(LAYER_OVERLAY, points[1], points[2], hitboxColor);
+            pushLine(LAYER_OVERLAY, points[2], points[0], hitboxColor);
         }
     } else {
         // Regular rendering for other objects (asteroids, enemies)
@@ -154,22 +228,27 @@ void renderGameObject(const GameObject* obj, int sides, const GameState* state)
         // Draw the lines
         for (int i = 0; i < sides; i++) {
             int next = (i + 1) % sides;
-            DrawLineV(points[i], points[next], LIGHTGRAY);
+            pushLine(LAYER_ASTEROIDS, points[i], points[next], LIGHTGRAY);
         }
     }
 }
 
-void renderParticles(const GameState* state) {
+void renderParticles(const RenderSnapshot* state) {
+    Rectangle view = getCameraView(state->camera);
+    
     for (int i = 0; i < MAX_PARTICLES; i++) {
-        if (state->particles[i].active) {
-            DrawCircleV(state->particles[i].position, state->particles[i].radius, state->particles[i].color);
+        if (state->particles[i].active &&
+            cullCircle(view, CULL_PARTICLES, state->particles[i].position.x, state->particles[i].position.y, state->particles[i].radius)) {
+            pushCircle(LAYER_PARTICLES, state->particles[i].position, state->particles[i].radius, state->particles[i].color);
         }
     }
 }
 
-void renderEnemies(const GameState* state) {
-    // Find active scout groups for visualization
-    if (state->Debug) {
+void renderEnemies(const RenderSnapshot* state) {
+    Rectangle view = getCameraView(state->camera);
+    
+    // Find active scout groups for visualization (skipped when the governor sheds detail)
+    if (state->Debug && governorAllowsDetail()) {
         // Identify scouts that want to group
         for (int i = 0; i < MAX_ENEMIES; i++) {
             if (state->enemies[i].base.active && state->enemies[i].type == ENEMY_SCOUT) {
@@ -183,12 +262,11 @@ void renderEnemies(const GameState* state) {
                         if (distance < SCOUT_GROUP_RADIUS && 
                             (i % 100 < SCOUT_GROUP_CHANCE) && 
                             (j % 100 < SCOUT_GROUP_CHANCE)) {
-                            DrawLineEx(
-                                (Vector2){state->enemies[i].base.x, state->enemies[i].base.y},
-                                (Vector2){state->enemies[j].base.x, state->enemies[j].base.y},
-                                1.0f, 
-                                (Color){0, 200, 255, 100}
-                            );
+                            Vector2 start = {state->enemies[i].base.x, state->enemies[i].base.y};
+                            Vector2 end = {state->enemies[j].base.x, state->enemies[j].base.y};
+                            if (cullSegment(view, CULL_DEBUG, start, end)) {
+                                pushThickLine(LAYER_ENEMY_DEBUG, start, end, 1.0f, (Color){0, 200, 255, 100});
+                            }
                         }
                     }
                 }
@@ -199,12 +277,13 @@ void renderEnemies(const GameState* state) {
     // Regular enemy rendering 
     for (int i = 0; i < MAX_ENEMIES; i++) {
         if (state->enemies[i].base.active) {
-            // Draw attack range visualization when in debug mode
-            if (state->Debug) {
+            // Draw attack range visualization when in debug mode (attack circle lies inside detection circle)
+            if (state->Debug && governorAllowsDetail() &&
+                cullCircle(view, CULL_DEBUG, state->enemies[i].base.x, state->enemies[i].base.y, ENEMY_DETECTION_RADIUS)) {
                 // Draw detection radius (outer circle)
-                DrawCircleLines(
-                    state->enemies[i].base.x,
-                    state->enemies[i].base.y,
+                pushCircleLines(
+                    LAYER_ENEMY_DEBUG,
+                    (Vector2){state->enemies[i].base.x, state->enemies[i].base.y},
                     ENEMY_DETECTION_RADIUS,
                     (Color){150, 150, 255, 100}
                 );
@@ -214,14 +293,24 @@ void renderEnemies(const GameState* state) {
                                        TANK_ENEMY_ATTACK_DISTANCE : 
                                        SCOUT_ENEMY_ATTACK_DISTANCE;
                                        
-                DrawCircleLines(
-                    state->enemies[i].base.x,
-                    state->enemies[i].base.y,
+                pushCircleLines(
+                    LAYER_ENEMY_DEBUG,
+                    (Vector2){state->enemies[i].base.x, state->enemies[i].base.y},
                     attackDistance,
                     (Color){255, 150, 150, 100}
                 );
             }
             
+            // Skip the enemy body if it's outside the camera view
+            // (margin covers the texture, the debug nose line and the health bar above it)
+            float cullRadius = fmaxf(
+                getTextureCullRadius(state->enemies[i].texture, getEnemyTextureScale(state->enemies[i].type), state->enemies[i].base.radius),
+                state->enemies[i].base.radius * 1.5f
+            ) + 12.0f;
+            if (!cullCircle(view, CULL_ENEMIES, state->enemies[i].base.x, state->enemies[i].base.y, cullRadius)) {
+                continue;
+            }
+            
             // Draw enemy texture
             if (state->enemies[i].texture.id > 0) {
                 // Get appropriate scale based on enemy type
@@ -242,7 +331,7 @@ void renderEnemies(const GameState* state) {
                 };
                 
                 // Draw the enemy texture rotated (images are facing north)
-                DrawTexturePro(state->enemies[i].texture, source, dest, origin, state->enemies[i].base.angle, WHITE);
+                pushSprite(LAYER_ENEMIES, state->enemies[i].texture, source, dest, origin, state->enemies[i].base.angle, WHITE);
             }
             
             // Draw hitbox lines in debug mode or as fallback
@@ -261,7 +350,7 @@ void renderEnemies(const GameState* state) {
                     Color hitboxColor = state->Debug ? (Color){255, 0, 0, 100} : RED;
                     for (int j = 0; j < 5; j++) {
                         int next = (j + 1) % 5;
-                        DrawLineV(points[j], points[next], hitboxColor);
+                        pushLine(LAYER_OVERLAY, points[j], points[next], hitboxColor);
                     }
                     
                     // Draw a gun barrel pointing toward player (debug only)
@@ -275,7 +364,7 @@ void renderEnemies(const GameState* state) {
                             state->enemies[i].base.x + sin(radians) * state->enemies[i].base.radius * 1.5f,
                             state->enemies[i].base.y - cos(radians) * state->enemies[i].base.radius * 1.5f
                         };
-                        DrawLineV(barrelStart, barrelEnd, (Color){255, 0, 0, 100});
+                        pushLine(LAYER_OVERLAY, barrelStart, barrelEnd, (Color){255, 0, 0, 100});
                     }
                 } else {
                     // Draw scout enemy as triangle with blue color
@@ -298,14 +387,15 @@ void renderEnemies(const GameState* state) {
                     
                     // Draw the hitbox lines
                     Color hitboxColor = state->Debug ? (Color){0, 0, 255, 100} : SKYBLUE;
-                    DrawLineV(points[0], points[1], hitboxColor);
-                    DrawLineV(points[1], points[2], hitboxColor);
-                    DrawLineV(points[2], points[0], hitboxColor);
+                    pushLine(LAYER_OVERLAY, points[0], points[1], hitboxColor);
+                    pushLine(LAYER_OVERLAY, points[1], points[2], hitboxColor);
+                    pushLine(LAYER_OVERLAY, points[2], points[0], hitboxColor);
                     
                     // If in debug mode, add an indicator for scouts that want to group
                     if (state->Debug && (i % 100 < SCOUT_GROUP_CHANCE)) {
                         // Draw small dot on scouts that want to group
-                        DrawCircleV(
+                        pushCircle(
+                            LAYER_OVERLAY,
                             (Vector2){state->enemies[i].base.x, state->enemies[i].base.y},
                             3.0f,
                             (Color){0, 255, 255, 200}
@@ -326,18 +416,19 @@ void renderEnemies(const GameState* state) {
                 int currentHealthWidth = (int)(barWidth * healthPercent);
                 
                 // Background of health bar
-                DrawRectangle(barX, barY, barWidth, barHeight, DARKGRAY);
+                pushRectangle(LAYER_OVERLAY, (Rectangle){barX, barY, barWidth, barHeight}, DARKGRAY);
                 
                 // Filled part of health bar
                 Color healthColor = (healthPercent > 0.5f) ? GREEN : RED;
-                DrawRectangle(barX, barY, currentHealthWidth, barHeight, healthColor);
+                pushRectangle(LAYER_OVERLAY, (Rectangle){barX, barY, currentHealthWidth, barHeight}, healthColor);
             }
         }
     }
     
     // Draw enemy bullets
     for (int i = 0; i < MAX_ENEMY_BULLETS; i++) {
-        if (state->enemyBullets[i].base.active) {
+        if (state->enemyBullets[i].base.active &&
+            cullCircle(view, CULL_BULLETS, state->enemyBullets[i].base.x, state->enemyBullets[i].base.y, state->enemyBullets[i].base.radius)) {
             Color bulletColor;
             
             if (state->enemyBullets[i].type == BULLET_GRENADE) {
@@ -351,10 +442,11 @@ void renderEnemies(const GameState* state) {
                 };
                 
                 // Draw grenade with a slightly larger radius
-                DrawCircleV((Vector2){state->enemyBullets[i].base.x, state->enemyBullets[i].base.y}, 
+                pushCircle(LAYER_ENEMY_BULLETS, (Vector2){state->enemyBullets[i].base.x, state->enemyBullets[i].base.y}, 
                            state->enemyBullets[i].base.radius, bulletColor);
 
-                DrawLineEx(
+                pushThickLine(
+                    LAYER_ENEMY_BULLETS,
                     (Vector2){state->enemyBullets[i].base.x, state->enemyBullets[i].base.y - 3},
                     (Vector2){state->enemyBullets[i].base.x, state->enemyBullets[i].base.y + 3},
                     2.0f, WHITE
@@ -379,57 +471,58 @@ void renderEnemies(const GameState* state) {
                 
                 }
                 
-                DrawCircleV((Vector2){state->enemyBullets[i].base.x, state->enemyBullets[i].base.y}, 
+                pushCircle(LAYER_ENEMY_BULLETS, (Vector2){state->enemyBullets[i].base.x, state->enemyBullets[i].base.y}, 
                            state->enemyBullets[i].base.radius, bulletColor);
             }
         }
     }
 }
 
-void renderGame(const GameState* state) {
-    BeginDrawing();
+// Draw the map and everything in it through the game camera
+static void renderWorld(const RenderSnapshot* state) {
+    // Work out what the camera can see and reset the culling counters
+    Rectangle view = getCameraView(state->camera);
+    resetCullStats();
     
-    // Clear screen with a very dark background for space
-    ClearBackground((Color){5, 5, 15, 255});
+    // Draw the pre-rendered map grid, boundary and starfield
+    renderBackground(state->camera, state->worldWidth, state->worldHeight);
+    
+    // Collect this frame's world draws so they can be sorted by layer and texture
+    beginRenderCommands();
     
     // Begin camera rendering
     BeginMode2D(state->camera);
     
-    // Draw map boundaries
-    DrawRectangleLines(0, 0, MAP_WIDTH, MAP_HEIGHT, BOUNDARY_COLOR);
-    
-    // Draw grid lines to help visualize the larger map
-    for (int i = 0; i < MAP_WIDTH; i += 200) {
-        DrawLine(i, 0, i, MAP_HEIGHT, (Color){20, 20, 40, 100});
-    }
-    for (int i = 0; i < MAP_HEIGHT; i += 200) {
-        DrawLine(0, i, MAP_WIDTH, i, (Color){20, 20, 40, 100});
-    }
-    
     // Draw particles
     renderParticles(state);
     
     // Draw ship
     renderGameObject(&state->ship.base, 3, state);
-
     
     // Draw bullets
     for (int i = 0; i < MAX_BULLETS; i++) {
-        if (state->bullets[i].active) {
-            DrawRectangle(
-                state->bullets[i].x - state->bullets[i].radius, 
-                state->bullets[i].y - state->bullets[i].radius, 
-                state->bullets[i].radius * 2, 
-                state->bullets[i].radius * 2, 
+        if (state->bullets[i].active &&
+            cullCircle(view, CULL_BULLETS, state->bullets[i].x, state->bullets[i].y, state->bullets[i].radius)) {
+            pushRectangle(
+                LAYER_BULLETS,
+                (Rectangle){
+                    state->bullets[i].x - state->bullets[i].radius, 
+                    state->bullets[i].y - state->bullets[i].radius, 
+                    state->bullets[i].radius * 2, 
+                    state->bullets[i].radius * 2
+                },
                 YELLOW
             );
         }
     }
     
-    // Draw asteroids
+    // Draw all visible asteroid outlines (submitted together as one line batch)
     for (int i = 0; i < MAX_ASTEROIDS; i++) {
-        if (state->asteroids[i].base.active) {
-            renderGameObject(&state->asteroids[i].base, 8, state); // Draw as octagon
+        if (state->asteroids[i].base.active &&
+            cullCircle(view, CULL_ASTEROIDS, state->asteroids[i].base.x, state->asteroids[i].base.y, state->asteroids[i].base.radius)) {
+            pushAsteroid(LAYER_ASTEROIDS, state->asteroids[i].meshId,
+                         (Vector2){state->asteroids[i].base.x, state->asteroids[i].base.y},
+                         state->asteroids[i].base.radius, state->asteroids[i].meshRotation, LIGHTGRAY);
         }
     }
     
@@ -439,155 +532,84 @@ void renderGame(const GameState* state) {
     // Draw powerups
     renderPowerups(state);
     
-    // Draw aiming guide only in debug mode
-    if (state->Debug) {
-        Vector2 mousePosition = GetScreenToWorld2D(GetMousePosition(), state->camera);
-        DrawLine(state->ship.base.x, state->ship.base.y, mousePosition.x, mousePosition.y, GRAY);
-    }
+    // Sort the collected commands and draw them in as few batches as possible
+    submitRenderCommands();
     
     EndMode2D();
+}
+
+void renderGame(const RenderSnapshot* state) {
+    // Refresh the cached HUD layer before the frame starts drawing
+    updateHud(state);
     
-    // UI elements should be drawn after EndMode2D so they stay fixed on screen
+    // The world is moving again, so any frozen pause frame is out of date
+    pauseSnapshot.valid = false;
     
-    // Draw score and lives
-    DrawText(TextFormat("Score: %d", state->score), 10, 10, 20, WHITE);
-
-    if (state->lives > 1) {
-        DrawText(TextFormat("Lives: %d", state->lives), 10, 40, 20, WHITE);
-    } else {
-        DrawText(TextFormat("Lives: %d", state->lives), 10, 40, 20, RED);
-    }
+    beginFrame();
     
-    // Draw health bar
-    int barWidth = 200;
-    int barHeight = 20;
-    int barX = WINDOW_WIDTH - barWidth - 20;
-    int barY = 8;
-    
-    // Background of health bar
-    DrawRectangle(barX, barY, barWidth, barHeight, GRAY);
-    
-    // Calculate health percentage
-    float healthPercent = (float)state->health / MAX_HEALTH;
-    int currentHealthWidth = (int)(barWidth * healthPercent);
-    
-    // Pick color based on health level
-    Color healthColor;
-    if (healthPercent > 0.7f) healthColor = GREEN;
-    else if (healthPercent > 0.3f) healthColor = YELLOW;
-    else healthColor = RED;
-    
-    // Draw the filled part of the health bar
-    DrawRectangle(barX, barY, currentHealthWidth, barHeight, healthColor);
-    
-    // Draw border around health bar
-    DrawRectangleLines(barX, barY, barWidth, barHeight, WHITE);
-    
-    // Draw health text
-    DrawText(TextFormat("Health: %d/%d", state->health, MAX_HEALTH), barX, barY + barHeight + 5, 15, WHITE);
-    
-    // Draw ammo counter
-    int ammoY = 70; // Position below lives
-    
-    // Get current weapon ammo info
-    int currentAmmo, maxAmmo;
-    const char* weaponName;
-    
-    if (state->currentWeapon == WEAPON_SHOTGUN) {
-        currentAmmo = state->shotgunAmmo;
-        maxAmmo = SHOTGUN_MAX_AMMO;
-        weaponName = "SHOTGUN";
-    } else if (state->currentWeapon == WEAPON_GRENADE) {
-        currentAmmo = state->grenadeAmmo;
-        maxAmmo = GRENADE_MAX_AMMO;
-        weaponName = "GRENADE";
-    } else {
-        currentAmmo = state->normalAmmo;
-        maxAmmo = MAX_AMMO;
-        weaponName = "RIFLE";
-    }
+    // Clear screen with a very dark background for space
+    ClearBackground(SPACE_COLOR);
     
-    if (state->isReloading && state->currentWeapon == WEAPON_NORMAL) {
-        // Draw reload timer text
-        DrawText(TextFormat("RELOADING: %.1f", state->reloadTimer), 10, ammoY, 20, RED);
-        
-        // Draw reload progress bar - positioned directly below the text
-        int reloadBarWidth = 150;
-        int reloadBarHeight = 15;
-        int reloadBarX = 10; // Align with text
-        int reloadBarY = ammoY + 25; // Position below text with some spacing
-        
-        // Background of reload bar
-        DrawRectangle(reloadBarX, reloadBarY, reloadBarWidth, reloadBarHeight, GRAY);
-        
-        // Calculate reload progress percentage
-        float reloadPercent = 1.0f - (state->reloadTimer / RELOAD_TIME);
-        int currentReloadWidth = (int)(reloadBarWidth * reloadPercent);
-        
-        // Draw the filled part of the reload bar
-        DrawRectangle(reloadBarX, reloadBarY, currentReloadWidth, reloadBarHeight, ORANGE);
-        
-        // Draw border around reload bar
-        DrawRectangleLines(reloadBarX, reloadBarY, reloadBarWidth, reloadBarHeight, WHITE);
-    } else {
-        // Draw ammo count with weapon type
-        Color ammoColor = currentAmmo > (maxAmmo / 4) ? WHITE : RED;
-        DrawText(TextFormat("%s: %d/%d", weaponName, currentAmmo, maxAmmo), 10, ammoY, 20, ammoColor);
-        
-        // Draw ammo indicators as small rectangles - positioned below the text
-        int ammoRectSize = 5;
-        int ammoRectSpacing = 3;
-        int ammoStartX = 10; // Align with text
-        int ammoIndicatorY = ammoY + 30; // Position below text with some spacing
-        
-        // Draw ammo indicators
-        for (int i = 0; i < maxAmmo; i++) {
-            Color rectColor;
-            if (i < currentAmmo) {
-                if (state->currentWeapon == WEAPON_SHOTGUN) {
-                    rectColor = GREEN;
-                } else if (state->currentWeapon == WEAPON_GRENADE) {
-                    rectColor = ORANGE;
-                } else {
-                    rectColor = YELLOW;
-                }
-            } else {
-                rectColor = DARKGRAY;
-            }
-            
-            DrawRectangle(
-                ammoStartX + (i * (ammoRectSize + ammoRectSpacing)), 
-                ammoIndicatorY, 
-                ammoRectSize, 
-                ammoRectSize, 
-                rectColor
-            );
-        }
-    }
+    // Draw the map, ship, bullets, asteroids, enemies and powerups
+    renderWorld(state);
     
-    // Draw weapon indicator
-    int weaponIndicatorY = ammoY + 50;
-    const char* weaponText;
-    Color weaponColor;
-    
-    if (state->currentWeapon == WEAPON_SHOTGUN) {
-        weaponText = "WEAPON: SHOTGUN";
-        weaponColor = GREEN;
-    } else if (state->currentWeapon == WEAPON_GRENADE) {
-        weaponText = "WEAPON: GRENADE";
-        weaponColor = ORANGE;
-    } else {
-        weaponText = "WEAPON: RIFLE";
-        weaponColor = WHITE;
+    // Draw aiming guide only in debug mode
+    if (state->Debug) {
+        BeginMode2D(state->camera);
+        Vector2 mousePosition = GetScreenToWorld2D(GetMousePosition(), state->camera);
+        DrawLine(state->ship.base.x, state->ship.base.y, mousePosition.x, mousePosition.y, GRAY);
+        EndMode2D();
     }
     
-    DrawText(weaponText, 10, weaponIndicatorY, 18, weaponColor);
-
+    // UI elements should be drawn after EndMode2D so they stay fixed on screen
+    
+    // Draw the cached HUD layer (score, lives, health, ammo, weapon and wave counters)
+    drawHud(state);
+    
     if (state->Debug) {
         // Draw debug information at bottom left
         int debugStartY = WINDOW_HEIGHT - 210; // Start 200 pixels from bottom
         
-        DrawText(TextFormat("FPS: %d", GetFPS()), 10, debugStartY - 30, 20, WHITE);
+        // Report how much of each pool the camera culled this frame
+        CullStats cullStats = getCullStats();
+        int totalDrawn = 0;
+        int totalCulled = 0;
+        for (int i = 0; i < CULL_CATEGORY_COUNT; i++) {
+            totalDrawn += cullStats.drawn[i];
+            totalCulled += cullStats.culled[i];
+        }
+        // Show what the frame allocated and whether gameplay ticks stayed allocation-free
+        MemoryStats memoryStats = getMemoryStats();
+        DrawText(TextFormat("Mem: %d allocs  %d B  peak %d / %d B  late tick allocs %d", memoryStats.frameAllocations,
+                            memoryStats.frameBytes, memoryStats.peakAllocations, memoryStats.peakBytes,
+                            memoryStats.tickAllocations),
+                 10, debugStartY - 180, 20, WHITE);
+        // Show how the simulation thread is keeping up
+        SimulationStats simulationStats = getSimulationStats();
+        DrawText(TextFormat("Sim: tick %llu  %.2f ms/tick  skipped %d  inputs %d", simulationStats.ticks,
+                            simulationStats.tickTime * 1000.0f, simulationStats.skippedTicks, simulationStats.queuedInputs),
+                 10, debugStartY - 150, 20, WHITE);
+        // Show what the quality governor is currently doing
+        GovernorStats governorStats = getGovernorStats();
+        DrawText(TextFormat("Quality: %s (%d changes)  frame %.1f ms  work %.1f ms  particles x%.2f  scale %d%%",
+                            getQualityName(governorStats.level), governorStats.changes,
+                            governorStats.averageFrameTime * 1000.0f, governorStats.averageWorkTime * 1000.0f,
+                            governorStats.particleScale, (int)(getEffectiveRenderScale() * 100 + 0.5f)),
+                 10, debugStartY - 120, 20, WHITE);
+        RenderCommandStats commandStats = getRenderCommandStats();
+        DrawText(TextFormat("Drawn: %d  Culled: %d  Cmds %d  Batches %d  Dropped %d", totalDrawn, totalCulled,
+                            commandStats.commands, commandStats.batches, commandStats.dropped),
+                 10, debugStartY - 90, 20, WHITE);
+        DrawText(TextFormat("P %d/%d  B %d/%d  A %d/%d  E %d/%d  U %d/%d  D %d/%d",
+                            cullStats.drawn[CULL_PARTICLES], cullStats.culled[CULL_PARTICLES],
+                            cullStats.drawn[CULL_BULLETS], cullStats.culled[CULL_BULLETS],
+                            cullStats.drawn[CULL_ASTEROIDS], cullStats.culled[CULL_ASTEROIDS],
+                            cullStats.drawn[CULL_ENEMIES], cullStats.culled[CULL_ENEMIES],
+                            cullStats.drawn[CULL_POWERUPS], cullStats.culled[CULL_POWERUPS],
+                            cullStats.drawn[CULL_DEBUG], cullStats.culled[CULL_DEBUG]),
+                 10, debugStartY - 60, 16, LIGHTGRAY);
+        HudStats hudStats = getHudStats();
+        DrawText(TextFormat("FPS: %d  HUD renders: %d / %d frames", GetFPS(), hudStats.renders, hudStats.frames), 10, debugStartY - 30, 20, WHITE);
         DrawText(TextFormat("Ship Position: (%.1f, %.1f)", state->ship.base.x, state->ship.base.y), 10, debugStartY, 20, WHITE);
         DrawText(TextFormat("Ship Velocity: (%.1f, %.1f)", state->ship.base.dx, state->ship.base.dy), 10, debugStartY + 30, 20, WHITE);
 
@@ -613,99 +635,47 @@ void renderGame(const GameState* state) {
         DrawText("F6: Skip to Next Wave", 10, debugStartY + 180, 20, YELLOW);
     }
     
-    // Draw wave counter in bottom right
-    DrawText(TextFormat("Wave: %d", state->currentWave), 
-             WINDOW_WIDTH - MeasureText(TextFormat("Wave: %d", state->currentWave), 20) - 10,
-             WINDOW_HEIGHT - 30,
-             20, WHITE);
-             
-
-    DrawText(TextFormat("Asteroids: %d", state->asteroidsRemaining),
-            WINDOW_WIDTH - MeasureText(TextFormat("Asteroids: %d", state->asteroidsRemaining), 20) - 10,
-            WINDOW_HEIGHT - 60,
-            20, WHITE);
-    
-            // Draw enemies counter (only if we're in a wave that has enemies)
-    if (state->currentWave >= SCOUT_START_WAVE) {
-        int enemiesRemaining = 0;
-        for (int i = 0; i < MAX_ENEMIES; i++) {
-            if (state->enemies[i].base.active) {
-                enemiesRemaining++;
-            }
-        }
-        
-        // Calculate enemies that haven't been spawned yet
-        int enemiesNotYetSpawned = 0;
-        if (state->maxEnemiesThisWave > state->enemiesSpawnedThisWave) {
-            enemiesNotYetSpawned = state->maxEnemiesThisWave - state->enemiesSpawnedThisWave;
-        }
-        
-        // Total remaining = currently active + not yet spawned
-        int totalEnemiesRemaining = enemiesRemaining + enemiesNotYetSpawned;
-        
-        DrawText(TextFormat("Enemies: %d/%d", totalEnemiesRemaining, state->maxEnemiesThisWave),
-                WINDOW_WIDTH - MeasureText(TextFormat("Enemies: %d/%d", totalEnemiesRemaining, state->maxEnemiesThisWave), 20) - 10,
-                WINDOW_HEIGHT - 90,
-                20, WHITE);
-    }
-    
-    // Draw wave message if timer is active
-    if (state->waveMessageTimer > 0) {
-        int fontSize = 40;
-        int textWidth = MeasureText(state->waveMessage, fontSize);
-        
-        // Calculate alpha for fade-out effect
-        unsigned char alpha = (unsigned char)(255.0f * (state->waveMessageTimer > 1.0f ? 
-                                                       1.0f : state->waveMessageTimer));
-        
-        // Draw with semi-transparent background for better visibility
-        DrawRectangle(WINDOW_WIDTH/2 - textWidth/2 - 10,
-                      WINDOW_HEIGHT/2 - fontSize/2 - 10,
-                      textWidth + 20, fontSize + 20,
-                      (Color){0, 0, 0, alpha/2});
-                    
-        DrawText(state->waveMessage,
-                WINDOW_WIDTH/2 - textWidth/2,
-                WINDOW_HEIGHT/2 - fontSize/2,
-                fontSize,
-                (Color){255, 255, 255, alpha});
+    // Draw custom crosshair at mouse position during gameplay
+    if (state->hasCustomCursor) {
+        Vector2 mousePos = GetMousePosition();
+        float crosshairSize = 32.0f; // Adjust size as needed
+        DrawTextureEx(state->crosshairTexture, 
+                    (Vector2){mousePos.x - crosshairSize/2, mousePos.y - crosshairSize/2}, 
+                    0.0f, crosshairSize/state->crosshairTexture.width, WHITE);
     }
     
-    EndDrawing();
+    endFrame();
 }
 
 void renderMenu(const GameState* state) {
-    BeginDrawing();
+    // Refresh the cached high score table before the frame starts drawing
+    updateScoreboard(state, SCOREBOARD_WIDTH);
+    const MenuTextLayout* layout = getMenuTextLayout();
+    
+    beginFrame();
     
     // Clear screen with a very dark background for space
     ClearBackground((Color){5, 5, 15, 255});
     
-    // Draw animated background asteroids
+    // Draw animated background asteroids using the shared game asteroid outlines
+    beginAsteroidBatch(MAX_MENU_ASTEROIDS);
     for (int i = 0; i < MAX_MENU_ASTEROIDS; i++) {
         if (state->menuAsteroids[i].active) {
-            // Draw each menu asteroid as an octagon, similar to game asteroids
-            Vector2 points[8];
-            for (int j = 0; j < 8; j++) {
-                float angle = state->menuAsteroids[i].angle + j * 45.0f;  // 360 / 8 = 45 degrees
-                float radians = angle * PI / 180.0f;
-                points[j].x = state->menuAsteroids[i].x + sin(radians) * state->menuAsteroids[i].radius;
-                points[j].y = state->menuAsteroids[i].y - cos(radians) * state->menuAsteroids[i].radius;
-            }
-            
-            // Draw the asteroid outlines
-            for (int j = 0; j < 8; j++) {
-                int next = (j + 1) % 8;
-                DrawLineV(points[j], points[next], (Color){150, 150, 150, 200});
-            }
+            // Menu asteroids spin, so their rotation is the only per-frame trig
+            float radians = state->menuAsteroids[i].angle * PI / 180.0f;
+            Vector2 rotation = { cosf(radians), sinf(radians) };
+            batchAsteroidOutline(state->menuAsteroids[i].meshId, state->menuAsteroids[i].x, state->menuAsteroids[i].y,
+                                 state->menuAsteroids[i].radius, rotation, (Color){150, 150, 150, 200});
         }
     }
+    endAsteroidBatch();
     
     // Calculate estimated height of scoreboard
     int scoreboardHeight = 50 + (MAX_HIGH_SCORES * 30);  // Header + (rows * row height)
     int scoreboardY = (WINDOW_HEIGHT - scoreboardHeight) / 2;  // Center vertically
     
     // Draw scoreboard on left side
-    renderScoreboard(state, 20, scoreboardY, 350);
+    renderScoreboard(state, 20, scoreboardY, SCOREBOARD_WIDTH);
     
     // Calculate right side area (for title and buttons)
     int rightSideX = 400;  // Starting X position of right side content
@@ -714,7 +684,7 @@ void renderMenu(const GameState* state) {
     
     // Draw title centered in the right area
     const char* title = "ASTEROIDS";
-    int titleWidth = MeasureText(title, TITLE_FONT_SIZE);
+    int titleWidth = layout->menuTitleWidth;
     DrawText(title, centerRightX - titleWidth/2, WINDOW_HEIGHT/4, TITLE_FONT_SIZE, WHITE);
     
     // Adjust button positions to be centered in the right area
@@ -749,7 +719,7 @@ void renderMenu(const GameState* state) {
     
     // Draw play button text
     const char* playButtonText = "PLAY";
-    int playButtonTextWidth = MeasureText(playButtonText, BUTTON_FONT_SIZE);
+    int playButtonTextWidth = layout->playWidth;
     DrawText(
         playButtonText,
         playButtonPos.x + playButtonPos.width/2 - playButtonTextWidth/2,
@@ -766,7 +736,7 @@ void renderMenu(const GameState* state) {
     
     // Draw options button text
     const char* optionsButtonText = "OPTIONS";
-    int optionsButtonTextWidth = MeasureText(optionsButtonText, BUTTON_FONT_SIZE);
+    int optionsButtonTextWidth = layout->optionsWidth;
     DrawText(
         optionsButtonText,
         optionsButtonPos.x + optionsButtonPos.width/2 - optionsButtonTextWidth/2,
@@ -784,7 +754,7 @@ void renderMenu(const GameState* state) {
     
     // Draw quit button text
     const char* quitButtonText = "QUIT";
-    int quitButtonTextWidth = MeasureText(quitButtonText, BUTTON_FONT_SIZE);
+    int quitButtonTextWidth = layout->quitWidth;
     DrawText(
         quitButtonText,
         quitButtonPos.x + quitButtonPos.width/2 - quitButtonTextWidth/2,
@@ -795,68 +765,34 @@ void renderMenu(const GameState* state) {
              
     // Draw version number in the bottom right corner
     DrawText(VERSION_NUMBER, 
-             WINDOW_WIDTH - MeasureText(VERSION_NUMBER, 16) - 10,
+             WINDOW_WIDTH - layout->versionWidth - 10,
              WINDOW_HEIGHT - 25,
              16, GRAY);
     
-    EndDrawing();
+    endFrame();
 }
 
 void renderPause(const GameState* state) {
-    // First, render the game underneath to show what's paused
-    BeginDrawing();
+    const MenuTextLayout* layout = getMenuTextLayout();
     
-    // Begin camera rendering
-    BeginMode2D(state->camera);
-    
-    // Draw map boundaries
-    DrawRectangleLines(0, 0, MAP_WIDTH, MAP_HEIGHT, BOUNDARY_COLOR);
-    
-    // Draw grid lines
-    for (int i = 0; i < MAP_WIDTH; i += 200) {
-        DrawLine(i, 0, i, MAP_HEIGHT, (Color){20, 20, 40, 100});
-    }
-    for (int i = 0; i < MAP_HEIGHT; i += 200) {
-        DrawLine(0, i, MAP_WIDTH, i, (Color){20, 20, 40, 100});
-    }
+    // Freeze the last gameplay frame once instead of re-rendering the world every frame
+    updatePauseSnapshot(state);
     
-    // Draw particles
-    renderParticles(state);
-    
-    // Draw ship
-    renderGameObject(&state->ship.base, 3, state);
+    beginFrame();
     
-    // Draw bullets
-    for (int i = 0; i < MAX_BULLETS; i++) {
-        if (state->bullets[i].active) {
-            DrawRectangle(
-                state->bullets[i].x - state->bullets[i].radius, 
-                state->bullets[i].y - state->bullets[i].radius, 
-                state->bullets[i].radius * 2, 
-                state->bullets[i].radius * 2, 
-                YELLOW
-            );
-        }
-    }
-    
-    // Draw asteroids
-    for (int i = 0; i < MAX_ASTEROIDS; i++) {
-        if (state->asteroids[i].base.active) {
-            renderGameObject(&state->asteroids[i].base, 8, state); // Draw as octagon
-        }
-    }
-    
-    // Draw enemies
-    renderEnemies(state);
+    // Clear screen with a very dark background for space
+    ClearBackground(SPACE_COLOR);
     
-    EndMode2D();
+    // Draw the frozen game underneath to show what's paused
+    Rectangle source = { 0, 0, (float)pauseSnapshot.frame.texture.width, -(float)pauseSnapshot.frame.texture.height };
+    DrawTextureRec(pauseSnapshot.frame.texture, source, (Vector2){ 0, 0 }, WHITE);
     
     // Draw semi-transparent overlay to darken the paused game
     DrawRectangle(0, 0, WINDOW_WIDTH, WINDOW_HEIGHT, (Color){0, 0, 0, 150});
     
     // Draw pause title
     const char* pauseTitle = "PAUSED";
-    int pauseTitleWidth = MeasureText(pauseTitle, TITLE_FONT_SIZE);
+    int pauseTitleWidth = layout->pauseTitleWidth;
     DrawText(pauseTitle, WINDOW_WIDTH/2 - pauseTitleWidth/2, WINDOW_HEIGHT/4, TITLE_FONT_SIZE, WHITE);
     
     // Calculate button positions centered on screen
@@ -891,7 +827,7 @@ void renderPause(const GameState* state) {
     
     // Draw resume button text
     const char* resumeButtonText = "RESUME";
-    int resumeButtonTextWidth = MeasureText(resumeButtonText, BUTTON_FONT_SIZE);
+    int resumeButtonTextWidth = layout->resumeWidth;
     DrawText(
         resumeButtonText,
         resumeButtonPos.x + resumeButtonPos.width/2 - resumeButtonTextWidth/2,
@@ -908,7 +844,7 @@ void renderPause(const GameState* state) {
     
     // Draw options button text
     const char* optionsButtonText = "OPTIONS";
-    int optionsButtonTextWidth = MeasureText(optionsButtonText, BUTTON_FONT_SIZE);
+    int optionsButtonTextWidth = layout->optionsWidth;
     DrawText(
         optionsButtonText,
         optionsButtonPos.x + optionsButtonPos.width/2 - optionsButtonTextWidth/2,
@@ -926,7 +862,7 @@ void renderPause(const GameState* state) {
     
     // Draw quit button text
     const char* quitButtonText = "QUIT";
-    int quitButtonTextWidth = MeasureText(quitButtonText, BUTTON_FONT_SIZE);
+    int quitButtonTextWidth = layout->quitWidth;
     DrawText(
         quitButtonText,
         quitButtonPos.x + quitButtonPos.width/2 - quitButtonTextWidth/2,
@@ -935,23 +871,28 @@ void renderPause(const GameState* state) {
         WHITE
     );
     
-    EndDrawing();
+    endFrame();
 }
 
 void renderOptions(const GameState* state) {
-    BeginDrawing();
+    static CachedLabel volumeLabel = {0};
+    static CachedLabel musicVolumeLabel = {0};
+    static CachedLabel renderScaleLabel = {0};
+    const MenuTextLayout* layout = getMenuTextLayout();
+    
+    beginFrame();
     
     // Clear screen with a very dark background for space
     ClearBackground((Color){5, 5, 15, 255});
     
     // Draw title
     const char* title = "OPTIONS";
-    int titleWidth = MeasureText(title, TITLE_FONT_SIZE);
+    int titleWidth = layout->optionsTitleWidth;
     DrawText(title, WINDOW_WIDTH/2 - titleWidth/2, WINDOW_HEIGHT/4, TITLE_FONT_SIZE, WHITE);
     
     // Draw volume label
     const char* volumeText = "SOUND VOLUME";
-    int volumeTextWidth = MeasureText(volumeText, OPTIONS_FONT_SIZE);
+    int volumeTextWidth = layout->soundVolumeWidth;
     DrawText(
         volumeText,
         WINDOW_WIDTH/2 - volumeTextWidth/2,
@@ -986,9 +927,8 @@ void renderOptions(const GameState* state) {
     );
     
     // Draw volume percentage
-    char volumePercentText[10];
-    sprintf(volumePercentText, "%d%%", (int)(state->soundVolume * 100));
-    int volumePercentWidth = MeasureText(volumePercentText, OPTIONS_FONT_SIZE);
+    const char* volumePercentText = updateCachedLabel(&volumeLabel, "%d%%", (int)(state->soundVolume * 100), OPTIONS_FONT_SIZE);
+    int volumePercentWidth = volumeLabel.width;
     DrawText(
         volumePercentText,
         WINDOW_WIDTH/2 - volumePercentWidth/2,
@@ -999,7 +939,7 @@ void renderOptions(const GameState* state) {
 
     // Draw music volume label
     const char* musicVolumeText = "MUSIC VOLUME";
-    int musicVolumeTextWidth = MeasureText(musicVolumeText, OPTIONS_FONT_SIZE);
+    int musicVolumeTextWidth = layout->musicVolumeWidth;
     DrawText(
         musicVolumeText,
         WINDOW_WIDTH/2 - musicVolumeTextWidth/2,
@@ -1046,9 +986,8 @@ void renderOptions(const GameState* state) {
     );
     
     // Draw music volume percentage
-    char musicVolumePercentText[10];
-    sprintf(musicVolumePercentText, "%d%%", (int)(state->musicVolume * 100));
-    int musicVolumePercentWidth = MeasureText(musicVolumePercentText, OPTIONS_FONT_SIZE);
+    const char* musicVolumePercentText = updateCachedLabel(&musicVolumeLabel, "%d%%", (int)(state->musicVolume * 100), OPTIONS_FONT_SIZE);
+    int musicVolumePercentWidth = musicVolumeLabel.width;
     DrawText(
         musicVolumePercentText,
         WINDOW_WIDTH/2 - musicVolumePercentWidth/2,
@@ -1057,8 +996,25 @@ void renderOptions(const GameState* state) {
         WHITE
     );
     
-    // Draw back button
+    // Draw render scale button
     Vector2 mousePoint = GetMousePosition();
+    bool isMouseOverRenderScaleButton = CheckCollisionPointRec(mousePoint, state->renderScaleButton);
+    
+    Color renderScaleButtonColor = isMouseOverRenderScaleButton ? BLUE : DARKBLUE;
+    DrawRectangleRec(state->renderScaleButton, renderScaleButtonColor);
+    DrawRectangleLinesEx(state->renderScaleButton, 2, WHITE);
+    
+    // Draw render scale button text
+    const char* renderScaleText = updateCachedLabel(&renderScaleLabel, "RESOLUTION: %d%%", (int)(getRenderScale() * 100 + 0.5f), OPTIONS_FONT_SIZE);
+    DrawText(
+        renderScaleText,
+        state->renderScaleButton.x + state->renderScaleButton.width/2 - renderScaleLabel.width/2,
+        state->renderScaleButton.y + state->renderScaleButton.height/2 - OPTIONS_FONT_SIZE/2,
+        OPTIONS_FONT_SIZE,
+        WHITE
+    );
+    
+    // Draw back button
     bool isMouseOverBackButton = CheckCollisionPointRec(mousePoint, state->backButton);
     
     Color backButtonColor = isMouseOverBackButton ? GREEN : DARKGREEN;
@@ -1067,7 +1023,7 @@ void renderOptions(const GameState* state) {
     
     // Draw back button text
     const char* backButtonText = "BACK";
-    int backButtonTextWidth = MeasureText(backButtonText, BUTTON_FONT_SIZE);
+    int backButtonTextWidth = layout->backWidth;
     DrawText(
         backButtonText,
         state->backButton.x + state->backButton.width/2 - backButtonTextWidth/2,
@@ -1078,28 +1034,31 @@ void renderOptions(const GameState* state) {
     
     // Draw version number in the bottom right corner
     DrawText(VERSION_NUMBER, 
-             WINDOW_WIDTH - MeasureText(VERSION_NUMBER, 16) - 10,
+             WINDOW_WIDTH - layout->versionWidth - 10,
              WINDOW_HEIGHT - 25,
              16, GRAY);
     
-    EndDrawing();
+    endFrame();
 }
 
 void renderGameOver(const GameState* state) {
-    BeginDrawing();
+    static CachedLabel scoreLabel = {0};
+    static CachedLabel waveLabel = {0};
+    const MenuTextLayout* layout = getMenuTextLayout();
+    
+    beginFrame();
     
     // Clear screen with a very dark background for space
     ClearBackground((Color){5, 5, 15, 255});
     
     // Draw game over title
     const char* gameOverTitle = "GAME OVER";
-    int titleWidth = MeasureText(gameOverTitle, TITLE_FONT_SIZE);
+    int titleWidth = layout->gameOverTitleWidth;
     DrawText(gameOverTitle, WINDOW_WIDTH/2 - titleWidth/2, WINDOW_HEIGHT/4, TITLE_FONT_SIZE, RED);
     
     // Draw final score
-    char scoreText[64];
-    sprintf(scoreText, "Final Score: %d", state->score);
-    int scoreWidth = MeasureText(scoreText, BUTTON_FONT_SIZE);
+    const char* scoreText = updateCachedLabel(&scoreLabel, "Final Score: %d", state->score, BUTTON_FONT_SIZE);
+    int scoreWidth = scoreLabel.width;
     DrawText(
         scoreText,
         WINDOW_WIDTH/2 - scoreWidth/2,
@@ -1109,9 +1068,8 @@ void renderGameOver(const GameState* state) {
     );
 
     // Show the wave the player reached
-    char waveText[64];
-    sprintf(waveText, "Reached Wave: %d", state->currentWave);
-    int waveWidth = MeasureText(waveText, BUTTON_FONT_SIZE);
+    const char* waveText = updateCachedLabel(&waveLabel, "Reached Wave: %d", state->currentWave, BUTTON_FONT_SIZE);
+    int waveWidth = waveLabel.width;
     DrawText(
         waveText,
         WINDOW_WIDTH/2 - waveWidth/2,
@@ -1130,7 +1088,7 @@ void renderGameOver(const GameState* state) {
     
     // Draw button text
     const char* mainMenuButtonText = "MAIN MENU";
-    int mainMenuButtonTextWidth = MeasureText(mainMenuButtonText, BUTTON_FONT_SIZE);
+    int mainMenuButtonTextWidth = layout->mainMenuWidth;
     DrawText(
         mainMenuButtonText,
         state->mainMenuButton.x + state->mainMenuButton.width/2 - mainMenuButtonTextWidth/2,
@@ -1141,214 +1099,24 @@ void renderGameOver(const GameState* state) {
     
     // Draw version number in the bottom right corner
     DrawText(VERSION_NUMBER, 
-             WINDOW_WIDTH - MeasureText(VERSION_NUMBER, 16) - 10,
+             WINDOW_WIDTH - layout->versionWidth - 10,
              WINDOW_HEIGHT - 25,
              16, GRAY);
     
-    EndDrawing();
+    endFrame();
 }
 
 void renderInfo(const GameState* state) {
-    BeginDrawing();
+    // Refresh the cached information screen before the frame starts drawing
+    updateInfoPanel(state);
+    
+    beginFrame();
     
     // Clear screen with a very dark background for space
     ClearBackground((Color){5, 5, 15, 255});
     
-    // Draw title 
-    const char* title = "GAME INFORMATION";
-    int titleWidth = MeasureText(title, TITLE_FONT_SIZE);
-    DrawText(title, WINDOW_WIDTH/2 - titleWidth/2, WINDOW_HEIGHT/4 - 30, TITLE_FONT_SIZE, WHITE);
-    
-    // Center the two columns on screen
-    int totalContentWidth = 800; 
-    int startX = (WINDOW_WIDTH - totalContentWidth) / 2;
-    int leftColumnX = startX;
-    int rightColumnX = startX + totalContentWidth / 2 + 80; 
-    
-    // Left Column - Controls and Weapons
-    int currentY = WINDOW_HEIGHT/4 + 45; 
-    
-    // Controls section
-    DrawText("CONTROLS:", leftColumnX, currentY, 30, (Color){255, 200, 100, 255});
-    currentY += 45;
-    
-    DrawText("WASD - Move ship", leftColumnX, currentY, 22, WHITE);
-    currentY += 28;
-    DrawText("Mouse - Aim and shoot", leftColumnX, currentY, 22, WHITE);
-    currentY += 28;
-    DrawText("R - Reload", leftColumnX, currentY, 22, WHITE);
-    currentY += 28;
-    DrawText("P - Pause", leftColumnX, currentY, 22, WHITE);
-    currentY += 50;
-    
-    // Weapons section
-    DrawText("WEAPONS & POWERUPS:", leftColumnX, currentY, 30, (Color){255, 150, 100, 255});
-    currentY += 45;
-    
-    // Health powerup
-    bool drewHealthTexture = false;
-    for (int i = 0; i < MAX_POWERUPS; i++) {
-        if (state->powerups[i].type == POWERUP_HEALTH && state->powerups[i].texture.id > 0) {
-            float scale = 32.0f / state->powerups[i].texture.width;
-            Rectangle source = { 0, 0, state->powerups[i].texture.width, state->powerups[i].texture.height };
-            Rectangle dest = { leftColumnX + 5, currentY + 2, 
-                             state->powerups[i].texture.width * scale, 
-                             state->powerups[i].texture.height * scale };
-            Vector2 origin = { 0, 0 };
-            DrawTexturePro(state->powerups[i].texture, source, dest, origin, 0.0f, WHITE);
-            drewHealthTexture = true;
-            break;
-        }
-    }
-    if (!drewHealthTexture) {
-        DrawCircleV((Vector2){leftColumnX + 20, currentY + 16}, 14, (Color){255, 100, 100, 255});
-        DrawText("+", leftColumnX + 16, currentY + 8, 16, WHITE);
-    }
-    DrawText("Health - Restores 20 health", leftColumnX + 45, currentY + 8, 18, WHITE);
-    currentY += 40; 
-
-    // Life powerup
-    bool drewLifeTexture = false;
-    for (int i = 0; i < MAX_POWERUPS; i++) {
-        if (state->powerups[i].type == POWERUP_LIFE && state->powerups[i].texture.id > 0) {
-            float scale = 32.0f / state->powerups[i].texture.width;
-            Rectangle source = { 0, 0, state->powerups[i].texture.width, state->powerups[i].texture.height };
-            Rectangle dest = { leftColumnX + 5, currentY + 2, 
-                            state->powerups[i].texture.width * scale, 
-                            state->powerups[i].texture.height * scale };
-            Vector2 origin = { 0, 0 };
-            DrawTexturePro(state->powerups[i].texture, source, dest, origin, 0.0f, WHITE);
-            drewLifeTexture = true;
-            break;
-        }
-    }
-    if (!drewLifeTexture) {
-        DrawCircleV((Vector2){leftColumnX + 20, currentY + 16}, 14, (Color){255, 100, 255, 255});
-        DrawText("1UP", leftColumnX + 8, currentY + 8, 14, WHITE);
-    }
-    DrawText("Extra Life - Gain one additional life", leftColumnX + 45, currentY + 8, 18, WHITE);
-    currentY += 40; 
-    
-    // Shotgun powerup
-    bool drewShotgunTexture = false;
-    for (int i = 0; i < MAX_POWERUPS; i++) {
-        if (state->powerups[i].type == POWERUP_SHOTGUN && state->powerups[i].texture.id > 0) {
-            float scale = 32.0f / state->powerups[i].texture.width;
-            Rectangle source = { 0, 0, state->powerups[i].texture.width, state->powerups[i].texture.height };
-            Rectangle dest = { leftColumnX + 5, currentY + 2, 
-                             state->powerups[i].texture.width * scale, 
-                             state->powerups[i].texture.height * scale };
-            Vector2 origin = { 0, 0 };
-            DrawTexturePro(state->powerups[i].texture, source, dest, origin, 0.0f, WHITE);
-            drewShotgunTexture = true;
-            break;
-        }
-    }
-    if (!drewShotgunTexture) {
-        DrawCircleV((Vector2){leftColumnX + 20, currentY + 16}, 14, (Color){100, 255, 100, 255});
-        DrawText("S", leftColumnX + 16, currentY + 8, 16, WHITE);
-    }
-    DrawText("Shotgun - 10 shots", leftColumnX + 45, currentY + 8, 18, WHITE);
-    currentY += 40; 
-    
-    // Grenade powerup
-    bool drewGrenadeTexture = false;
-    for (int i = 0; i < MAX_POWERUPS; i++) {
-        if (state->powerups[i].type == POWERUP_GRENADE && state->powerups[i].texture.id > 0) {
-            float scale = 32.0f / state->powerups[i].texture.width;
-            Rectangle source = { 0, 0, state->powerups[i].texture.width, state->powerups[i].texture.height };
-            Rectangle dest = { leftColumnX + 5, currentY + 2, 
-                             state->powerups[i].texture.width * scale, 
-                             state->powerups[i].texture.height * scale };
-            Vector2 origin = { 0, 0 };
-            DrawTexturePro(state->powerups[i].texture, source, dest, origin, 0.0f, WHITE);
-            drewGrenadeTexture = true;
-            break;
-        }
-    }
-    if (!drewGrenadeTexture) {
-        DrawCircleV((Vector2){leftColumnX + 20, currentY + 16}, 14, (Color){255, 165, 0, 255});
-        DrawText("G", leftColumnX + 16, currentY + 8, 16, WHITE);
-    }
-    DrawText("Grenade - 5 explosive shots", leftColumnX + 45, currentY + 8, 18, WHITE);
-    
-    // Right Column - Enemies and Objectives
-    currentY = WINDOW_HEIGHT/4 + 45; 
-    
-    // Enemies section
-    DrawText("ENEMIES:", rightColumnX, currentY, 30, (Color){255, 100, 100, 255});
-    currentY += 45;
-    
-    // Scout enemy
-    bool drewScoutTexture = false;
-    for (int i = 0; i < MAX_ENEMIES; i++) {
-        if (state->enemies[i].type == ENEMY_SCOUT && state->enemies[i].texture.id > 0) {
-            float scale = 32.0f / state->enemies[i].texture.width;
-            Rectangle source = { 0, 0, state->enemies[i].texture.width, state->enemies[i].texture.height };
-            Rectangle dest = { rightColumnX + 5, currentY + 4, 
-                             state->enemies[i].texture.width * scale, 
-                             state->enemies[i].texture.height * scale };
-            Vector2 origin = { 0, 0 };
-            DrawTexturePro(state->enemies[i].texture, source, dest, origin, 0.0f, WHITE);
-            drewScoutTexture = true;
-            break;
-        }
-    }
-    if (!drewScoutTexture) {
-        Vector2 scoutPoints[3] = {
-            {rightColumnX + 20, currentY + 8},
-            {rightColumnX + 10, currentY + 23},
-            {rightColumnX + 30, currentY + 23}
-        };
-        DrawTriangleLines(scoutPoints[0], scoutPoints[1], scoutPoints[2], SKYBLUE);
-    }
-    DrawText("Scout - Fast, drops shotgun", rightColumnX + 45, currentY + 8, 18, WHITE);
-    currentY += 35;
-    
-    // Tank enemy
-    bool drewTankTexture = false;
-    for (int i = 0; i < MAX_ENEMIES; i++) {
-        if (state->enemies[i].type == ENEMY_TANK && state->enemies[i].texture.id > 0) {
-            float scale = 32.0f / state->enemies[i].texture.width;
-            Rectangle source = { 0, 0, state->enemies[i].texture.width, state->enemies[i].texture.height };
-            Rectangle dest = { rightColumnX + 5, currentY + 4, 
-                             state->enemies[i].texture.width * scale, 
-                             state->enemies[i].texture.height * scale };
-            Vector2 origin = { 0, 0 };
-            DrawTexturePro(state->enemies[i].texture, source, dest, origin, 0.0f, WHITE);
-            drewTankTexture = true;
-            break;
-        }
-    }
-    if (!drewTankTexture) {
-        DrawRectangleLines(rightColumnX + 10, currentY + 8, 24, 16, RED);
-    }
-    DrawText("Tank - Strong, drops grenade", rightColumnX + 45, currentY + 8, 18, WHITE);
-    currentY += 50;
-    
-    // Game objective
-    DrawText("OBJECTIVES:", rightColumnX, currentY, 30, (Color){255, 255, 100, 255});
-    currentY += 45;
-    DrawText("-> Destroy all asteroids", rightColumnX, currentY, 20, WHITE);
-    currentY += 28;
-    DrawText("-> Eliminate enemies for points", rightColumnX, currentY, 20, WHITE);
-    currentY += 28;
-    DrawText("-> Survive as long as possible", rightColumnX, currentY, 20, WHITE);
-    
-    // Instructions to continue - centered at bottom 
-    const char* continueText = "Press Z to start playing!";
-    int continueWidth = MeasureText(continueText, OPTIONS_FONT_SIZE);
-    DrawText(continueText, 
-             WINDOW_WIDTH/2 - continueWidth/2, 
-             WINDOW_HEIGHT - 100, 
-             OPTIONS_FONT_SIZE, 
-             WHITE);
-    
-    // Draw version number in the bottom right corner 
-    DrawText(VERSION_NUMBER, 
-             WINDOW_WIDTH - MeasureText(VERSION_NUMBER, 16) - 10,
-             WINDOW_HEIGHT - 25,
-             16, GRAY);
+    // Draw the pre-rendered controls, powerups, enemies and objectives
+    drawInfoPanel(state);
     
-    EndDrawing();
+    endFrame();
 }
\ No newline at end of file
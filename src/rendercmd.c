@@ -0,0 +1,212 @@
+#include "raylib.h"
+#include "rlgl.h"
+#include <stdbool.h>
+#include <stdlib.h>
+
+// Custom headers
+#include "typedefs.h"
+#include "config.h"
+#include "rendercmd.h"
+#include "asteroidmesh.h"
+
+// Per-frame command buffer; filled by the render functions, sorted and submitted once
+static RenderCommand commands[RENDER_COMMAND_CAPACITY];
+static int commandCount = 0;
+static RenderCommandStats renderStats = {0};
+
+// Primitives drawn through our own line list versus ones handed to raylib's shape functions
+typedef enum {
+    BATCH_TRIANGLES,
+    BATCH_LINES
+} BatchClass;
+
+static BatchClass getBatchClass(const RenderCommand* command) {
+    return (command->kind == RENDER_LINE || command->kind == RENDER_ASTEROID) ? BATCH_LINES : BATCH_TRIANGLES;
+}
+
+// Layer first, then texture, then primitive kind; the sequence number keeps the rest in call order
+static unsigned long long makeSortKey(RenderLayer layer, unsigned int textureId, RenderCommandKind kind, int sequence) {
+    return ((unsigned long long)layer << 56) |
+           ((unsigned long long)(textureId & 0xFFFFFF) << 32) |
+           ((unsigned long long)kind << 24) |
+           (unsigned long long)(sequence & 0xFFFFFF);
+}
+
+// Reserve the next command slot, or count a drop if the buffer is full
+static RenderCommand* allocateCommand(RenderLayer layer, RenderCommandKind kind, unsigned int textureId, Color color) {
+    if (commandCount >= RENDER_COMMAND_CAPACITY) {
+        renderStats.dropped++;
+        return NULL;
+    }
+    
+    RenderCommand* command = &commands[commandCount];
+    command->sortKey = makeSortKey(layer, textureId, kind, commandCount);
+    command->layer = (unsigned char)layer;
+    command->kind = (unsigned char)kind;
+    command->textureId = textureId;
+    command->color = color;
+    commandCount++;
+    
+    renderStats.commands++;
+    renderStats.perLayer[layer]++;
+    return command;
+}
+
+static int compareCommands(const void* a, const void* b) {
+    unsigned long long keyA = ((const RenderCommand*)a)->sortKey;
+    unsigned long long keyB = ((const RenderCommand*)b)->sortKey;
+    return (keyA > keyB) - (keyA < keyB);
+}
+
+// Count the vertices a run of line commands will emit so the batch can be sized up front
+static int countLineVertices(int start) {
+    int vertices = 0;
+    for (int i = start; i < commandCount; i++) {
+        if (commands[i].textureId != commands[start].textureId || getBatchClass(&commands[i]) != BATCH_LINES) break;
+        vertices += (commands[i].kind == RENDER_LINE) ? 2 : ASTEROID_MESH_MAX_VERTICES * 2;
+    }
+    return vertices;
+}
+
+// Start a new frame's command list
+void beginRenderCommands(void) {
+    commandCount = 0;
+    renderStats = (RenderCommandStats){0};
+}
+
+void pushSprite(RenderLayer layer, Texture2D texture, Rectangle source, Rectangle dest, Vector2 origin, float rotation, Color tint) {
+    RenderCommand* command = allocateCommand(layer, RENDER_SPRITE, texture.id, tint);
+    if (command == NULL) return;
+    
+    command->data.sprite.texture = texture;
+    command->data.sprite.source = source;
+    command->data.sprite.dest = dest;
+    command->data.sprite.origin = origin;
+    command->data.sprite.rotation = rotation;
+}
+
+void pushCircle(RenderLayer layer, Vector2 center, float radius, Color color) {
+    RenderCommand* command = allocateCommand(layer, RENDER_CIRCLE, 0, color);
+    if (command == NULL) return;
+    
+    command->data.circle.center = center;
+    command->data.circle.radius = radius;
+}
+
+void pushCircleLines(RenderLayer layer, Vector2 center, float radius, Color color) {
+    RenderCommand* command = allocateCommand(layer, RENDER_CIRCLE_LINES, 0, color);
+    if (command == NULL) return;
+    
+    command->data.circle.center = center;
+    command->data.circle.radius = radius;
+}
+
+void pushRectangle(RenderLayer layer, Rectangle rectangle, Color color) {
+    RenderCommand* command = allocateCommand(layer, RENDER_RECTANGLE, 0, color);
+    if (command == NULL) return;
+    
+    command->data.rectangle = rectangle;
+}
+
+void pushLine(RenderLayer layer, Vector2 start, Vector2 end, Color color) {
+    RenderCommand* command = allocateCommand(layer, RENDER_LINE, 0, color);
+    if (command == NULL) return;
+    
+    command->data.line.start = start;
+    command->data.line.end = end;
+    command->data.line.thickness = 1.0f;
+}
+
+void pushThickLine(RenderLayer layer, Vector2 start, Vector2 end, float thickness, Color color) {
+    RenderCommand* command = allocateCommand(layer, RENDER_THICK_LINE, 0, color);
+    if (command == NULL) return;
+    
+    command->data.line.start = start;
+    command->data.line.end = end;
+    command->data.line.thickness = thickness;
+}
+
+// Text is stored by pointer, so only pass string literals
+void pushText(RenderLayer layer, const char* text, Vector2 position, int fontSize, Color color) {
+    RenderCommand* command = allocateCommand(layer, RENDER_TEXT, GetFontDefault().texture.id, color);
+    if (command == NULL) return;
+    
+    command->data.text.text = text;
+    command->data.text.position = position;
+    command->data.text.fontSize = fontSize;
+}
+
+void pushAsteroid(RenderLayer layer, int meshId, Vector2 position, float radius, Vector2 rotation, Color color) {
+    RenderCommand* command = allocateCommand(layer, RENDER_ASTEROID, 0, color);
+    if (command == NULL) return;
+    
+    command->data.asteroid.meshId = meshId;
+    command->data.asteroid.position = position;
+    command->data.asteroid.radius = radius;
+    command->data.asteroid.rotation = rotation;
+}
+
+// Sort the frame's commands and hand them to raylib in batches
+void submitRenderCommands(void) {
+    qsort(commands, commandCount, sizeof(RenderCommand), compareCommands);
+    
+    bool lineRunOpen = false;
+    for (int i = 0; i < commandCount; i++) {
+        const RenderCommand* command = &commands[i];
+        BatchClass batchClass = getBatchClass(command);
+        
+        // A new batch starts whenever the texture or primitive type changes
+        if (i == 0 || command->textureId != commands[i - 1].textureId || batchClass != getBatchClass(&commands[i - 1])) {
+            if (lineRunOpen) {
+                rlEnd();
+                lineRunOpen = false;
+            }
+            
+            if (batchClass == BATCH_LINES) {
+                rlCheckRenderBatchLimit(countLineVertices(i));
+                rlBegin(RL_LINES);
+                lineRunOpen = true;
+            }
+            renderStats.batches++;
+        }
+        
+        switch (command->kind) {
+            case RENDER_SPRITE:
+                DrawTexturePro(command->data.sprite.texture, command->data.sprite.source, command->data.sprite.dest,
+                               command->data.sprite.origin, command->data.sprite.rotation, command->color);
+                break;
+            case RENDER_CIRCLE:
+                DrawCircleV(command->data.circle.center, command->data.circle.radius, command->color);
+                break;
+            case RENDER_CIRCLE_LINES:
+                DrawCircleLines((int)command->data.circle.center.x, (int)command->data.circle.center.y, command->data.circle.radius, command->color);
+                break;
+            case RENDER_RECTANGLE:
+                DrawRectangleRec(command->data.rectangle, command->color);
+                break;
+            case RENDER_THICK_LINE:
+                DrawLineEx(command->data.line.start, command->data.line.end, command->data.line.thickness, command->color);
+                break;
+            case RENDER_TEXT:
+                DrawText(command->data.text.text, (int)command->data.text.position.x, (int)command->data.text.position.y,
+                         command->data.text.fontSize, command->color);
+                break;
+            case RENDER_LINE:
+                rlColor4ub(command->color.r, command->color.g, command->color.b, command->color.a);
+                rlVertex2f(command->data.line.start.x, command->data.line.start.y);
+                rlVertex2f(command->data.line.end.x, command->data.line.end.y);
+                break;
+            case RENDER_ASTEROID:
+                batchAsteroidOutline(command->data.asteroid.meshId, command->data.asteroid.position.x, command->data.asteroid.position.y,
+                                     command->data.asteroid.radius, command->data.asteroid.rotation, command->color);
+                break;
+        }
+    }
+    
+    if (lineRunOpen) rlEnd();
+    commandCount = 0;
+}
+
+RenderCommandStats getRenderCommandStats(void) {
+    return renderStats;
+}
\ No newline at end of file
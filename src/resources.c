@@ -2,11 +2,16 @@
 #include <stdio.h>
 #include <stdlib.h>
 #include <stdbool.h>
+#include <string.h>
 
 // Custom headers
 #include "typedefs.h"
 #include "config.h"
 #include "resources.h"
+#include "platform.h"
+#include "memtrack.h"
+#include "profiler.h"
+#include "flightrecorder.h"
 
 // Tracks all loaded textures for proper cleanup
 typedef struct {
@@ -17,16 +22,44 @@ typedef struct {
 
 static TextureTracker textureTracker = {0};
 
+// Textures already loaded from disk, looked up by path so spawns share one GPU copy
+typedef struct {
+    char path[128];
+    Texture2D texture;
+} CachedTexture;
+
+typedef struct {
+    CachedTexture entries[TEXTURE_CACHE_SIZE];
+    int count;
+    PlatformMutex lock;
+} TextureCache;
+
+static TextureCache textureCache = {0};
+
+// Batch runs have no window, so every lookup comes back empty
+static bool headlessResources = false;
+
+void setHeadlessResources(bool headless) {
+    headlessResources = headless;
+}
+
 void initResources(GameState* state) {
     // Initialize texture tracker
     textureTracker.capacity = 20; // Start with space for 20 textures
-    textureTracker.textures = (Texture2D*)malloc(sizeof(Texture2D) * textureTracker.capacity);
+    textureTracker.textures = (Texture2D*)trackedMalloc(sizeof(Texture2D) * textureTracker.capacity);
     textureTracker.count = 0;
     
     if (textureTracker.textures == NULL) {
         printf("Error: Failed to allocate memory for texture tracker\n");
         exit(1);
     }
+    
+    // Spawns on the simulation thread look textures up concurrently with the main thread
+    textureCache.count = 0;
+    if (!createMutex(&textureCache.lock)) {
+        printf("Error: Failed to create texture cache lock\n");
+        exit(1);
+    }
 }
 
 // Helper function to track a texture
@@ -36,8 +69,8 @@ static void trackTexture(Texture2D texture) {
     // Check if we need to expand capacity
     if (textureTracker.count >= textureTracker.capacity) {
         int newCapacity = textureTracker.capacity * 2;
-        Texture2D* newTextures = (Texture2D*)realloc(textureTracker.textures, 
-                                                    sizeof(Texture2D) * newCapacity);
+        Texture2D* newTextures = (Texture2D*)trackedRealloc(textureTracker.textures, 
+                                                           sizeof(Texture2D) * newCapacity);
         
         if (newTextures == NULL) {
             printf("Error: Failed to expand texture tracker capacity\n");
@@ -58,17 +91,46 @@ bool isTextureLoaded(Texture2D texture) {
 
 Texture2D loadTextureOnce(const char* path) {
     Texture2D texture = {0};
+    if (headlessResources) return texture;
+    
+    lockMutex(&textureCache.lock);
+    
+    // Reuse the texture if this path was loaded before
+    for (int i = 0; i < textureCache.count; i++) {
+        if (strcmp(textureCache.entries[i].path, path) == 0) {
+            texture = textureCache.entries[i].texture;
+            unlockMutex(&textureCache.lock);
+            return texture;
+        }
+    }
+    
+    // GPU uploads can only happen on the thread that owns the window
+    if (!isMainThread()) {
+        unlockMutex(&textureCache.lock);
+        printf("Warning: Texture not preloaded, drawing without it: %s\n", path);
+        return texture;
+    }
     
     // Try to load the texture
+    beginSubsystem(SUBSYSTEM_RESOURCES);
     texture = LoadTexture(path);
+    noteAssetLoad();
     
-    // Track the texture if successfully loaded
+    // Track and cache the texture if successfully loaded
     if (texture.id != 0) {
         trackTexture(texture);
+        if (textureCache.count < TEXTURE_CACHE_SIZE) {
+            CachedTexture* entry = &textureCache.entries[textureCache.count++];
+            strncpy(entry->path, path, sizeof(entry->path) - 1);
+            entry->path[sizeof(entry->path) - 1] = '\0';
+            entry->texture = texture;
+        }
     } else {
         printf("Warning: Failed to load texture: %s\n", path);
     }
+    endSubsystem();
     
+    unlockMutex(&textureCache.lock);
     return texture;
 }
 
@@ -149,9 +211,10 @@ void unloadAllTextures(GameState* state) {
     
     // Reset tracker
     textureTracker.count = 0;
+    textureCache.count = 0;
     
     // Free the tracker memory
-    free(textureTracker.textures);
+    trackedFree(textureTracker.textures);
     textureTracker.textures = NULL;
     textureTracker.capacity = 0;
     
@@ -0,0 +1,292 @@
+#include "raylib.h"
+#include <stdbool.h>
+#include <stdio.h>
+#include <stdlib.h>
+#include <math.h>
+
+// Custom headers
+#include "typedefs.h"
+#include "config.h"
+#include "scenario.h"
+#include "cmdline.h"
+#include "asteroids.h"
+#include "enemies.h"
+#include "powerups.h"
+#include "initialize.h"
+#include "pacing.h"
+#include "governor.h"
+#include "memtrack.h"
+#include "random.h"
+#include "lifecycle.h"
+
+// Chosen on the main thread before gameplay starts, read by the simulation thread afterwards
+static ScenarioOptions scenario = { SCENARIO_NONE };
+
+// Per-frame measurements in seconds, owned by the main thread
+typedef struct {
+    float* frameTimes;
+    float* renderTimes;
+    float* simulationTimes;
+    double liveEntities;       // Sum over measured frames of the scenario's pool occupancy
+    int warmup;
+    int measured;
+} ScenarioSamples;
+
+static ScenarioSamples samples = {0};
+
+// Random point on a ring around the ship, kept inside the world
+static Vector2 pickScenarioPoint(GameState* state, float radius) {
+    float angle = getGameRandomValue(state, 0, 359) * PI / 180.0f;
+    float distance = (float)getGameRandomValue(state, (int)SCENARIO_MIN_DISTANCE, (int)SCENARIO_MAX_DISTANCE);
+    Vector2 point = {
+        state->ship.base.x + sinf(angle) * distance,
+        state->ship.base.y - cosf(angle) * distance
+    };
+    point.x = fminf(fmaxf(point.x, radius), state->world.width - radius);
+    point.y = fminf(fmaxf(point.y, radius), state->world.height - radius);
+    return point;
+}
+
+// Point within spread of center, kept inside the world
+static Vector2 jitterScenarioPoint(GameState* state, Vector2 center, float spread, float radius) {
+    Vector2 point = {
+        center.x + getGameRandomValue(state, -(int)spread, (int)spread),
+        center.y + getGameRandomValue(state, -(int)spread, (int)spread)
+    };
+    point.x = fminf(fmaxf(point.x, radius), state->world.width - radius);
+    point.y = fminf(fmaxf(point.y, radius), state->world.height - radius);
+    return point;
+}
+
+// spawnEnemy takes the first free slot; move the new enemy to where the scenario wants it
+static bool spawnScenarioEnemy(GameState* state, EnemyType type, Vector2 position) {
+    int slot = -1;
+    for (int i = 0; i < MAX_ENEMIES; i++) {
+        if (!state->enemies[i].base.active) {
+            slot = i;
+            break;
+        }
+    }
+    if (slot < 0) return false;
+    
+    spawnEnemy(state, type);
+    if (!state->enemies[slot].base.active) return false;
+    
+    state->enemies[slot].base.x = position.x;
+    state->enemies[slot].base.y = position.y;
+    return true;
+}
+
+static void topUpAsteroids(GameState* state) {
+    int active = state->entities.live[ENTITY_ASTEROID];
+    for (int i = 0; i < MAX_ASTEROIDS && active < scenario.count; i++) {
+        if (state->asteroids[i].base.active) continue;
+        
+        int size = scenario.asteroidSize > 0 ? scenario.asteroidSize : getGameRandomValue(state, 1, 3);
+        createAsteroidsOfSize(state, 1, size);
+        
+        // createAsteroids fills the first free slot, which is this one
+        Vector2 position = pickScenarioPoint(state, state->asteroids[i].base.radius);
+        state->asteroids[i].base.x = position.x;
+        state->asteroids[i].base.y = position.y;
+        active++;
+    }
+}
+
+static void topUpScouts(GameState* state) {
+    int missing = scenario.count - state->entities.enemiesByType[ENEMY_SCOUT];
+    while (missing > 0) {
+        Vector2 center = pickScenarioPoint(state, SCOUT_ENEMY_RADIUS + SCENARIO_GROUP_SPREAD);
+        for (int k = 0; k < SCENARIO_GROUP_SIZE && missing > 0; k++, missing--) {
+            Vector2 position = jitterScenarioPoint(state, center, SCENARIO_GROUP_SPREAD, SCOUT_ENEMY_RADIUS);
+            if (!spawnScenarioEnemy(state, ENEMY_SCOUT, position)) return;
+        }
+    }
+}
+
+static void topUpTanks(GameState* state) {
+    int missing = scenario.count - state->entities.enemiesByType[ENEMY_TANK];
+    for (; missing > 0; missing--) {
+        if (!spawnScenarioEnemy(state, ENEMY_TANK, pickScenarioPoint(state, TANK_ENEMY_RADIUS))) return;
+    }
+}
+
+static void topUpParticles(GameState* state) {
+    int active = 0;
+    for (int i = 0; i < MAX_PARTICLES; i++) active += state->particles[i].active;
+    
+    // Whole explosions, so the storm looks like the real thing
+    for (; active < scenario.count; active += ENEMY_EXPLOSION_PARTICLES) {
+        Vector2 position = pickScenarioPoint(state, 0.0f);
+        createEnemyExplosion(state, position.x, position.y, ENEMY_EXPLOSION_PARTICLES);
+    }
+}
+
+static void topUpPowerups(GameState* state) {
+    int active = state->entities.live[ENTITY_POWERUP];
+    
+    // Health and life drops are chance based; these two always spawn
+    for (; active < scenario.count; active++) {
+        Vector2 position = pickScenarioPoint(state, 15.0f);
+        if (active % 2 == 0) {
+            spawnShotgunPowerup(state, position.x, position.y);
+        } else {
+            spawnGrenadePowerup(state, position.x, position.y);
+        }
+    }
+}
+
+static int getScenarioPoolSize(ScenarioType type) {
+    switch (type) {
+        case SCENARIO_ASTEROIDS: return MAX_ASTEROIDS;
+        case SCENARIO_SCOUTS:
+        case SCENARIO_TANKS: return MAX_ENEMIES;
+        case SCENARIO_PARTICLES: return MAX_PARTICLES;
+        case SCENARIO_POWERUPS: return MAX_POWERUPS;
+        default: return 0;
+    }
+}
+
+static TelemetryPool getScenarioPool(ScenarioType type) {
+    switch (type) {
+        case SCENARIO_ASTEROIDS: return TELEMETRY_POOL_ASTEROIDS;
+        case SCENARIO_PARTICLES: return TELEMETRY_POOL_PARTICLES;
+        case SCENARIO_POWERUPS: return TELEMETRY_POOL_POWERUPS;
+        default: return TELEMETRY_POOL_ENEMIES;
+    }
+}
+
+// Skip the menu and start a game holding only the scenario's load; main thread, before gameplay runs
+void startScenario(GameState* state, const ScenarioOptions* options) {
+    scenario = *options;
+    
+    int poolSize = getScenarioPoolSize(scenario.type);
+    if (scenario.count == 0) scenario.count = poolSize;
+    if (scenario.count > poolSize) {
+        printf("Scenario: %d entities requested but the pool holds %d; rebuild with larger pools "
+               "(premake5 --stress-pools) to go higher\n", scenario.count, poolSize);
+        scenario.count = poolSize;
+    }
+    
+    seedGameRandom(state, scenario.seed);
+    resetGameData(state);
+    state->screenState = GAME_STATE;
+    
+    // No wave asteroids, no wave spawner and no wave ending; the scenario supplies the load
+    for (int i = 0; i < MAX_ASTEROIDS; i++) despawnEntity(state, ENTITY_ASTEROID, i, DESPAWN_CLEARED);
+    state->waveLocked = true;
+    state->maxEnemiesThisWave = 0;
+    state->EnemySpawnComplete = 1;
+    state->enemySpawnTick = 0;
+    if (scenario.type == SCENARIO_SCOUTS) state->currentWave = SCOUT_START_WAVE;
+    if (scenario.type == SCENARIO_TANKS) state->currentWave = TANK_START_WAVE;
+    updateScenario(state);
+    
+    // Measure real frame cost at a fixed quality instead of the paced, self-adjusting frame rate
+    setPacingUncapped(true);
+    lockQualityLevel(QUALITY_HIGH);
+    
+    samples.frameTimes = (float*)trackedMalloc(sizeof(float) * scenario.frames);
+    samples.renderTimes = (float*)trackedMalloc(sizeof(float) * scenario.frames);
+    samples.simulationTimes = (float*)trackedMalloc(sizeof(float) * scenario.frames);
+    if (samples.frameTimes == NULL || samples.renderTimes == NULL || samples.simulationTimes == NULL) {
+        printf("Error: Could not allocate %d scenario frames\n", scenario.frames);
+        exit(1);
+    }
+    
+    printf("Scenario: %s x%d, %d frames after %d warm-up, seed %u\n", getScenarioName(scenario.type),
+           scenario.count, scenario.frames, SCENARIO_WARMUP_FRAMES, scenario.seed);
+}
+
+// Put back whatever was destroyed so the load stays constant; simulation thread, every tick
+void updateScenario(GameState* state) {
+    if (scenario.type == SCENARIO_NONE) return;
+    
+    // The player can't run out of lives, so the run always lasts its full length.
+    // A burst of hits can still take a life within one tick; the ship then respawns.
+    state->health = MAX_HEALTH;
+    state->lives = 3;
+    
+    switch (scenario.type) {
+        case SCENARIO_ASTEROIDS: topUpAsteroids(state); break;
+        case SCENARIO_SCOUTS: topUpScouts(state); break;
+        case SCENARIO_TANKS: topUpTanks(state); break;
+        case SCENARIO_PARTICLES: topUpParticles(state); break;
+        case SCENARIO_POWERUPS: topUpPowerups(state); break;
+        default: break;
+    }
+}
+
+// Returns false once all frames have been measured; true while measuring or with no scenario
+bool recordScenarioFrame(const FlightFrame* frame) {
+    if (scenario.type == SCENARIO_NONE) return true;
+    if (!frame->gameplay) return true;
+    
+    if (samples.warmup < SCENARIO_WARMUP_FRAMES) {
+        samples.warmup++;
+        return true;
+    }
+    
+    // Work the simulation thread finished while this frame was underway
+    float simulationTime = frame->subsystemTime[SUBSYSTEM_SIMULATION] + frame->subsystemTime[SUBSYSTEM_COLLISIONS] +
+                           frame->subsystemTime[SUBSYSTEM_ENEMIES] + frame->subsystemTime[SUBSYSTEM_PARTICLES] +
+                           frame->subsystemTime[SUBSYSTEM_POWERUPS];
+    
+    samples.frameTimes[samples.measured] = frame->frameTime;
+    samples.renderTimes[samples.measured] = frame->subsystemTime[SUBSYSTEM_RENDER];
+    samples.simulationTimes[samples.measured] = simulationTime;
+    samples.liveEntities += frame->poolCounts[getScenarioPool(scenario.type)];
+    samples.measured++;
+    return samples.measured < scenario.frames;
+}
+
+static int compareFloats(const void* a, const void* b) {
+    float x = *(const float*)a;
+    float y = *(const float*)b;
+    return (x > y) - (x < y);
+}
+
+// Nearest-rank percentile of sorted values
+static float percentile(const float* sorted, int count, float percent) {
+    int rank = (int)ceilf(percent / 100.0f * count);
+    if (rank < 1) rank = 1;
+    if (rank > count) rank = count;
+    return sorted[rank - 1];
+}
+
+static void printPercentiles(const char* name, float* values, int count) {
+    qsort(values, count, sizeof(float), compareFloats);
+    
+    double sum = 0.0;
+    for (int i = 0; i < count; i++) sum += values[i];
+    
+    printf("  %-10s %8.3f %8.3f %8.3f %8.3f %8.3f %8.3f\n", name, 1000.0 * sum / count,
+           1000.0f * percentile(values, count, 50.0f), 1000.0f * percentile(values, count, 90.0f),
+           1000.0f * percentile(values, count, 99.0f), 1000.0f * percentile(values, count, 99.9f),
+           1000.0f * values[count - 1]);
+}
+
+// Print the frame-time percentiles and release the samples; main thread, after the game loop
+void endScenario(void) {
+    if (scenario.type == SCENARIO_NONE) return;
+    
+    int count = samples.measured;
+    if (count > 0) {
+        printf("Scenario report: %s x%d", getScenarioName(scenario.type), scenario.count);
+        if (scenario.type == SCENARIO_ASTEROIDS) printf(" (%s)", getAsteroidSizeName(scenario.asteroidSize));
+        printf(", %d frames, %.1f live on average\n", count, samples.liveEntities / count);
+        printf("  %-10s %8s %8s %8s %8s %8s %8s\n", "ms", "mean", "p50", "p90", "p99", "p99.9", "max");
+        printPercentiles("frame", samples.frameTimes, count);
+        printPercentiles("render", samples.renderTimes, count);
+        printPercentiles("simulation", samples.simulationTimes, count);
+        if (count < scenario.frames) {
+            printf("  Stopped early after %d of %d frames\n", count, scenario.frames);
+        }
+    }
+    
+    trackedFree(samples.frameTimes);
+    trackedFree(samples.renderTimes);
+    trackedFree(samples.simulationTimes);
+    samples = (ScenarioSamples){0};
+    scenario.type = SCENARIO_NONE;
+}
\ No newline at end of file
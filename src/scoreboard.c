@@ -7,109 +7,190 @@
 // Custom headers
 #include "typedefs.h"
 #include "config.h"
+#include "layers.h"
+#include "scorestore.h"
+#include "iothread.h"
+#include "platform.h"
+#include "memtrack.h"
+#include "flightrecorder.h"
 
-// Load high scores from file
-void loadHighScores(GameState* state) {
-    FILE* file = fopen(SCORE_FILE_PATH, "r");
-    
-    // Initialize scores
+// Pre-rendered high score table, rebuilt only when the table or window changes
+typedef struct {
+    RenderTexture2D panel;
+    int width;
+    int windowWidth;
+    int windowHeight;
+    bool dirty;
+    bool loaded;
+} ScoreboardCache;
+
+static ScoreboardCache scoreboardCache = { .dirty = true };
+
+// Mark the cached table as stale
+static void invalidateScoreboard(void) {
+    scoreboardCache.dirty = true;
+}
+
+// Every run ever recorded; the table in GameState is rebuilt from this.
+// Only the main thread touches it; file work happens on the I/O thread.
+static ScoreHistory scoreHistory = {0};
+static bool scoreHistoryLoaded = false;
+static volatile int latestSaveGeneration = 0;
+
+typedef struct {
+    GameState* state;
+    ScoreHistory loaded;
+    bool imported;
+} ScoreLoadJob;
+
+typedef struct {
+    int generation;
+    int count;
+    HighScore runs[];
+} ScoreSaveJob;
+
+// Pick the best MAX_HIGH_SCORES runs; on equal scores the earlier run ranks higher
+static void rebuildHighScoreTable(GameState* state) {
     state->scoreCount = 0;
-    for (int i = 0; i < MAX_HIGH_SCORES; i++) {
-        state->highScores[i].score = 0;
-        state->highScores[i].wave = 0;
-        strcpy(state->highScores[i].date, "");
-    }
-    
-    if (file == NULL) {
-        printf("File doesn't exist or failed to open: %s\n", SCORE_FILE_PATH);
-        return;
-    }
-    
-    // Read scores from file
-    while (!feof(file) && state->scoreCount < MAX_HIGH_SCORES) {
-        int result = fscanf(file, "%d,%d,%11s\n", 
-                           &state->highScores[state->scoreCount].score,
-                           &state->highScores[state->scoreCount].wave,
-                           state->highScores[state->scoreCount].date);
+    for (int i = 0; i < scoreHistory.count; i++) {
+        const HighScore* run = &scoreHistory.runs[i];
+        if (run->score <= 0) continue;
         
-        // Check if we read all 3 values successfully
-        if (result == 3) {
+        // Find where this score should be inserted
+        int insertPos = state->scoreCount;
+        for (int j = 0; j < state->scoreCount; j++) {
+            if (run->score > state->highScores[j].score) {
+                insertPos = j;
+                break;
+            }
+        }
+        if (insertPos >= MAX_HIGH_SCORES) continue;
+        
+        // Shift lower scores down
+        int lastPos = (state->scoreCount < MAX_HIGH_SCORES - 1) ? state->scoreCount : MAX_HIGH_SCORES - 1;
+        for (int j = lastPos; j > insertPos; j--) {
+            state->highScores[j] = state->highScores[j - 1];
+        }
+        state->highScores[insertPos] = *run;
+        
+        if (state->scoreCount < MAX_HIGH_SCORES) {
             state->scoreCount++;
         }
     }
+    invalidateScoreboard();
+}
+
+static void runScoreSave(void* data) {
+    ScoreSaveJob* job = (ScoreSaveJob*)data;
     
-    fclose(file);
+    // A newer save is already queued, so this one would just be overwritten
+    if (job->generation == atomicLoad(&latestSaveGeneration)) {
+        writeScoreFile(SCORE_FILE_PATH, SCORE_TEMP_FILE_PATH, job->runs, job->count);
+    }
+    trackedFree(job);
 }
 
-// Save high scores to file
-void saveHighScores(GameState* state) {
-    FILE* file = fopen(SCORE_FILE_PATH, "w");
+// Queue a copy of the full history to be written on the I/O thread
+void saveHighScores(void) {
+    // Saving before the file is read would replace it with a partial history
+    if (!scoreHistoryLoaded) return;
     
-    if (file == NULL) {
-        // Failed to open file for writing
+    ScoreSaveJob* job = (ScoreSaveJob*)trackedMalloc(sizeof(ScoreSaveJob) + sizeof(HighScore) * scoreHistory.count);
+    if (job == NULL) {
+        printf("Error: Failed to allocate score save\n");
         return;
     }
-    
-    // Write each score to file
-    for (int i = 0; i < state->scoreCount; i++) {
-        fprintf(file, "%d,%d,%s\n", 
-                state->highScores[i].score,
-                state->highScores[i].wave,
-                state->highScores[i].date);
+    job->generation = atomicAdd(&latestSaveGeneration, 1) + 1;
+    job->count = scoreHistory.count;
+    if (scoreHistory.count > 0) {
+        memcpy(job->runs, scoreHistory.runs, sizeof(HighScore) * scoreHistory.count);
     }
+    queueIoJob(runScoreSave, NULL, job);
+}
+
+static void runScoreLoad(void* data) {
+    ScoreLoadJob* job = (ScoreLoadJob*)data;
     
-    fclose(file);
+    if (readScoreFile(SCORE_FILE_PATH, &job->loaded)) return;
+    
+    // No usable binary file: fall back to the old text format
+    freeScoreHistory(&job->loaded);
+    job->imported = importLegacyScores(SCORE_LEGACY_FILE_PATH, &job->loaded);
+    if (!job->imported) {
+        printf("File doesn't exist or failed to open: %s\n", SCORE_FILE_PATH);
+    }
 }
 
-// Add a new high score if it qualifies
-void addHighScore(GameState* state, int score, int wave) {
-    if (score <= 0) return;  // Don't add zero scores
+static void completeScoreLoad(void* data) {
+    ScoreLoadJob* job = (ScoreLoadJob*)data;
     
-    // Get current date
-    time_t t = time(NULL);
-    struct tm* tm_info = localtime(&t);
-    char date[12];
-    strftime(date, 12, "%m/%d/%Y", tm_info);
+    // Runs finished while the file was loading go after the loaded history
+    int finishedWhileLoading = scoreHistory.count;
+    for (int i = 0; i < finishedWhileLoading; i++) {
+        appendScoreRun(&job->loaded, &scoreHistory.runs[i]);
+    }
+    freeScoreHistory(&scoreHistory);
+    scoreHistory = job->loaded;
+    scoreHistoryLoaded = true;
     
-    // Find where this score should be inserted
-    int insertPos = state->scoreCount;
-    for (int i = 0; i < state->scoreCount; i++) {
-        if (score > state->highScores[i].score) {
-            insertPos = i;
-            break;
-        }
+    rebuildHighScoreTable(job->state);
+    
+    // Convert imported scores to the binary format right away
+    if (job->imported || finishedWhileLoading > 0) {
+        saveHighScores();
     }
+    trackedFree(job);
+}
+
+// Start loading the score history in the background; the table fills in when it arrives
+void loadHighScores(GameState* state) {
+    // Initialize scores
+    state->scoreCount = 0;
+    for (int i = 0; i < MAX_HIGH_SCORES; i++) {
+        state->highScores[i].score = 0;
+        state->highScores[i].wave = 0;
+        strcpy(state->highScores[i].date, "");
+    }
+    invalidateScoreboard();
     
-    // If we're at max capacity and the new score doesn't qualify, return
-    if (insertPos >= MAX_HIGH_SCORES) {
+    ScoreLoadJob* job = (ScoreLoadJob*)trackedCalloc(1, sizeof(ScoreLoadJob));
+    if (job == NULL) {
+        printf("Error: Failed to allocate score load\n");
         return;
     }
-    
-    // Shift lower scores down
-    int lastPos = (state->scoreCount < MAX_HIGH_SCORES - 1) ? state->scoreCount : MAX_HIGH_SCORES - 1;
-for (int i = lastPos; i > insertPos; i--) {
-    state->highScores[i] = state->highScores[i-1];
+    job->state = state;
+    queueIoJob(runScoreLoad, completeScoreLoad, job);
 }
+
+// Record a finished run and refresh the table if it qualifies
+void addHighScore(GameState* state, int score, int wave) {
+    if (score <= 0) return;  // Don't add zero scores
     
-    // Insert new score
-    state->highScores[insertPos].score = score;
-    state->highScores[insertPos].wave = wave;
-    strcpy(state->highScores[insertPos].date, date);
+    // Get current date
+    time_t t = time(NULL);
+    struct tm* tm_info = localtime(&t);
+    HighScore run;
+    run.score = score;
+    run.wave = wave;
+    strftime(run.date, sizeof(run.date), "%m/%d/%Y", tm_info);
     
-    // Increase score count if not at max
-    if (state->scoreCount < MAX_HIGH_SCORES) {
-        state->scoreCount++;
-    }
+    if (!appendScoreRun(&scoreHistory, &run)) return;
+    rebuildHighScoreTable(state);
     
-    // Save the updated scores
-    saveHighScores(state);
+    // Save the updated history
+    saveHighScores();
 }
 
-// Render scoreboard on the menu
-void renderScoreboard(const GameState* state, int x, int y, int width) {
+void unloadHighScores(void) {
+    freeScoreHistory(&scoreHistory);
+    scoreHistoryLoaded = false;
+}
+
+// Draw the full scoreboard table
+static void drawScoreboardPanel(const GameState* state, int x, int y, int width) {
     // Draw scoreboard background
-    DrawRectangle(x, y, width, 360, (Color){0, 0, 0, 150});
-    DrawRectangleLines(x, y, width, 360, WHITE);
+    DrawRectangle(x, y, width, SCOREBOARD_HEIGHT, (Color){0, 0, 0, 150});
+    DrawRectangleLines(x, y, width, SCOREBOARD_HEIGHT, WHITE);
     
     // Draw scoreboard title
     const char* title = "HIGH SCORES";
@@ -167,4 +248,46 @@ void renderScoreboard(const GameState* state, int x, int y, int width) {
         int playWidth = MeasureText(playToAdd, 18);
         DrawText(playToAdd, x + width/2 - playWidth/2, y + 190, 18, LIGHTGRAY);
     }
+}
+
+// Re-render the cached table if it is stale; call before beginFrame
+void updateScoreboard(const GameState* state, int width) {
+    if (windowSizeChanged(&scoreboardCache.windowWidth, &scoreboardCache.windowHeight)) {
+        scoreboardCache.dirty = true;
+    }
+    
+    // (Re)create the texture when the panel width changes
+    if (!scoreboardCache.loaded || scoreboardCache.width != width) {
+        if (scoreboardCache.loaded) UnloadRenderTexture(scoreboardCache.panel);
+        scoreboardCache.panel = LoadRenderTexture(width, SCOREBOARD_HEIGHT);
+        noteAssetLoad();
+        scoreboardCache.width = width;
+        scoreboardCache.loaded = true;
+        scoreboardCache.dirty = true;
+    }
+    
+    if (!scoreboardCache.dirty) return;
+    
+    beginCachedLayer(scoreboardCache.panel);
+    drawScoreboardPanel(state, 0, 0, width);
+    endCachedLayer();
+    scoreboardCache.dirty = false;
+}
+
+// Render scoreboard on the menu
+void renderScoreboard(const GameState* state, int x, int y, int width) {
+    // Fall back to drawing directly if the cache hasn't been built for this width
+    if (!scoreboardCache.loaded || scoreboardCache.dirty || scoreboardCache.width != width) {
+        drawScoreboardPanel(state, x, y, width);
+        return;
+    }
+    
+    drawCachedLayer(scoreboardCache.panel, (Vector2){ (float)x, (float)y }, 255);
+}
+
+void unloadScoreboard(void) {
+    if (!scoreboardCache.loaded) return;
+    
+    UnloadRenderTexture(scoreboardCache.panel);
+    scoreboardCache.loaded = false;
 }
\ No newline at end of file
@@ -0,0 +1,201 @@
+#include <stdbool.h>
+#include <stdio.h>
+#include <stdlib.h>
+#include <string.h>
+
+// Custom headers
+#include "typedefs.h"
+#include "config.h"
+#include "scorestore.h"
+#include "platform.h"
+#include "memtrack.h"
+
+// File layout, all fields little-endian:
+//   header: magic, version, run count, CRC-32 of the first 12 header bytes and all records
+//   record: score, wave, date packed as YYYYMMDD (0 when unknown)
+#define SCORE_HEADER_SIZE 16
+#define SCORE_RECORD_SIZE 12
+
+static unsigned int crcTable[256];
+static bool crcTableReady = false;
+
+static unsigned int updateCrc32(unsigned int crc, const unsigned char* data, size_t size) {
+    if (!crcTableReady) {
+        for (unsigned int i = 0; i < 256; i++) {
+            unsigned int value = i;
+            for (int bit = 0; bit < 8; bit++) {
+                value = (value & 1) ? (value >> 1) ^ 0xEDB88320u : value >> 1;
+            }
+            crcTable[i] = value;
+        }
+        crcTableReady = true;
+    }
+    
+    crc = ~crc;
+    for (size_t i = 0; i < size; i++) {
+        crc = crcTable[(crc ^ data[i]) & 0xFF] ^ (crc >> 8);
+    }
+    return ~crc;
+}
+
+static void writeUint32(unsigned char* out, unsigned int value) {
+    out[0] = (unsigned char)(value);
+    out[1] = (unsigned char)(value >> 8);
+    out[2] = (unsigned char)(value >> 16);
+    out[3] = (unsigned char)(value >> 24);
+}
+
+static unsigned int readUint32(const unsigned char* in) {
+    return (unsigned int)in[0] | ((unsigned int)in[1] << 8) |
+           ((unsigned int)in[2] << 16) | ((unsigned int)in[3] << 24);
+}
+
+// MM/DD/YYYY to YYYYMMDD
+static unsigned int packDate(const char* date) {
+    int month, day, year;
+    if (sscanf(date, "%d/%d/%d", &month, &day, &year) != 3) return 0;
+    if (month < 1 || month > 12 || day < 1 || day > 31 || year < 0 || year > 9999) return 0;
+    return (unsigned int)(year * 10000 + month * 100 + day);
+}
+
+static void unpackDate(unsigned int packed, char* date) {
+    if (packed == 0) {
+        date[0] = '\0';
+        return;
+    }
+    snprintf(date, 12, "%02u/%02u/%04u", (packed / 100) % 100, packed % 100, (packed / 10000) % 10000);
+}
+
+bool appendScoreRun(ScoreHistory* history, const HighScore* run) {
+    if (history->count >= history->capacity) {
+        int newCapacity = history->capacity > 0 ? history->capacity * 2 : 32;
+        HighScore* newRuns = (HighScore*)trackedRealloc(history->runs, sizeof(HighScore) * newCapacity);
+        if (newRuns == NULL) {
+            printf("Error: Failed to expand score history\n");
+            return false;
+        }
+        history->runs = newRuns;
+        history->capacity = newCapacity;
+    }
+    
+    history->runs[history->count++] = *run;
+    return true;
+}
+
+void freeScoreHistory(ScoreHistory* history) {
+    trackedFree(history->runs);
+    history->runs = NULL;
+    history->count = 0;
+    history->capacity = 0;
+}
+
+// Load a binary score file; anything truncated, corrupt or from a newer version is rejected
+bool readScoreFile(const char* path, ScoreHistory* history) {
+    FILE* file = fopen(path, "rb");
+    if (file == NULL) return false;
+    
+    fseek(file, 0, SEEK_END);
+    long size = ftell(file);
+    fseek(file, 0, SEEK_SET);
+    
+    if (size < SCORE_HEADER_SIZE) {
+        fclose(file);
+        return false;
+    }
+    
+    unsigned char* buffer = (unsigned char*)trackedMalloc((size_t)size);
+    if (buffer == NULL) {
+        fclose(file);
+        return false;
+    }
+    
+    bool valid = fread(buffer, 1, (size_t)size, file) == (size_t)size;
+    fclose(file);
+    
+    unsigned int count = valid ? readUint32(buffer + 8) : 0;
+    valid = valid &&
+            readUint32(buffer) == SCORE_FILE_MAGIC &&
+            readUint32(buffer + 4) <= SCORE_FILE_VERSION &&
+            (long)count == (size - SCORE_HEADER_SIZE) / SCORE_RECORD_SIZE &&
+            (long)(SCORE_HEADER_SIZE + count * SCORE_RECORD_SIZE) == size;
+    
+    if (valid) {
+        unsigned int crc = updateCrc32(0, buffer, 12);
+        crc = updateCrc32(crc, buffer + SCORE_HEADER_SIZE, (size_t)count * SCORE_RECORD_SIZE);
+        valid = crc == readUint32(buffer + 12);
+    }
+    
+    if (!valid) {
+        printf("Warning: Ignoring damaged score file: %s\n", path);
+        trackedFree(buffer);
+        return false;
+    }
+    
+    for (unsigned int i = 0; i < count; i++) {
+        const unsigned char* record = buffer + SCORE_HEADER_SIZE + i * SCORE_RECORD_SIZE;
+        HighScore run;
+        run.score = (int)readUint32(record);
+        run.wave = (int)readUint32(record + 4);
+        unpackDate(readUint32(record + 8), run.date);
+        if (!appendScoreRun(history, &run)) break;
+    }
+    
+    trackedFree(buffer);
+    return true;
+}
+
+// Read the old "score,wave,MM/DD/YYYY" text file
+bool importLegacyScores(const char* path, ScoreHistory* history) {
+    FILE* file = fopen(path, "r");
+    if (file == NULL) return false;
+    
+    char line[128];
+    while (fgets(line, sizeof(line), file) != NULL) {
+        HighScore run = {0};
+        if (sscanf(line, "%d,%d,%11s", &run.score, &run.wave, run.date) == 3) {
+            if (!appendScoreRun(history, &run)) break;
+        }
+    }
+    
+    fclose(file);
+    printf("Imported %d scores from %s\n", history->count, path);
+    return true;
+}
+
+// Write every run to a temporary file, flush it to disk, then rename it over the real file
+bool writeScoreFile(const char* path, const char* tempPath, const HighScore* runs, int count) {
+    size_t size = SCORE_HEADER_SIZE + (size_t)count * SCORE_RECORD_SIZE;
+    unsigned char* buffer = (unsigned char*)trackedMalloc(size);
+    if (buffer == NULL) return false;
+    
+    writeUint32(buffer, SCORE_FILE_MAGIC);
+    writeUint32(buffer + 4, SCORE_FILE_VERSION);
+    writeUint32(buffer + 8, (unsigned int)count);
+    for (int i = 0; i < count; i++) {
+        unsigned char* record = buffer + SCORE_HEADER_SIZE + (size_t)i * SCORE_RECORD_SIZE;
+        writeUint32(record, (unsigned int)runs[i].score);
+        writeUint32(record + 4, (unsigned int)runs[i].wave);
+        writeUint32(record + 8, packDate(runs[i].date));
+    }
+    
+    unsigned int crc = updateCrc32(0, buffer, 12);
+    crc = updateCrc32(crc, buffer + SCORE_HEADER_SIZE, (size_t)count * SCORE_RECORD_SIZE);
+    writeUint32(buffer + 12, crc);
+    
+    FILE* file = fopen(tempPath, "wb");
+    if (file == NULL) {
+        trackedFree(buffer);
+        return false;
+    }
+    
+    bool written = fwrite(buffer, 1, size, file) == size && syncFile(file);
+    written = (fclose(file) == 0) && written;
+    trackedFree(buffer);
+    
+    if (!written || !replaceFile(tempPath, path)) {
+        printf("Warning: Failed to save scores to %s\n", path);
+        remove(tempPath);
+        return false;
+    }
+    return true;
+}
\ No newline at end of file
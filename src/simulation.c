@@ -0,0 +1,419 @@
+#include "raylib.h"
+#include <stdbool.h>
+#include <stdio.h>
+#include <stdlib.h>
+#include <string.h>
+#include <math.h>
+
+// Custom headers
+#include "typedefs.h"
+#include "config.h"
+#include "simulation.h"
+#include "game.h"
+#include "input.h"
+#include "platform.h"
+#include "telemetry.h"
+#include "scenario.h"
+#include "profiler.h"
+#include "memtrack.h"
+#include "timerwheel.h"
+
+#define SIM_TICK_TIME (1.0 / SIM_TICK_RATE)
+
+// Set on the shared slot index when it holds a snapshot the renderer hasn't taken yet
+#define SNAPSHOT_DIRTY 4
+
+// Triple buffer: the simulation writes one slot, the renderer reads another,
+// and the third is swapped between them without either side waiting
+typedef struct {
+    RenderSnapshot slots[3];
+    int writeSlot;            // Owned by whichever thread owns the game state
+    int readSlot;             // Owned by the main thread
+    volatile int sharedSlot;  // Slot waiting to be picked up, plus SNAPSHOT_DIRTY
+} SnapshotBuffer;
+
+// Single producer (main thread), single consumer (simulation thread)
+typedef struct {
+    InputFrame frames[INPUT_QUEUE_CAPACITY];
+    volatile int head;
+    volatile int tail;
+    unsigned int carriedPressed;  // Presses from frames dropped while the queue was full
+} InputQueue;
+
+typedef struct {
+    GameState* state;
+    PlatformThread thread;
+    PlatformMutex lock;
+    PlatformCondition changed;
+    bool active;     // The simulation owns the game state and is ticking
+    bool parked;     // The simulation thread is waiting and not touching the game state
+    bool quit;
+    InputFrame input;           // Input replayed by the current tick
+    EntityPositions previous;   // Positions before the current tick
+    unsigned long long tick;
+    SimulationStats stats;      // Shared copy, guarded by lock
+} Simulation;
+
+static Simulation simulation = {0};
+static SnapshotBuffer snapshots = {0};
+static InputQueue inputQueue = {0};
+static RenderSnapshot interpolatedView;
+
+static Vector2 getRecordedPosition(bool active, float x, float y) {
+    return active ? (Vector2){ x, y } : (Vector2){ NAN, NAN };
+}
+
+// Remember where everything was before a tick so the renderer can blend toward the result
+static void recordPositions(const GameState* state, EntityPositions* positions) {
+    positions->ship = getRecordedPosition(state->ship.base.active, state->ship.base.x, state->ship.base.y);
+    for (int i = 0; i < MAX_BULLETS; i++) {
+        positions->bullets[i] = getRecordedPosition(state->bullets[i].active, state->bullets[i].x, state->bullets[i].y);
+    }
+    for (int i = 0; i < MAX_ASTEROIDS; i++) {
+        const GameObject* base = &state->asteroids[i].base;
+        positions->asteroids[i] = getRecordedPosition(base->active, base->x, base->y);
+    }
+    for (int i = 0; i < MAX_ENEMIES; i++) {
+        const GameObject* base = &state->enemies[i].base;
+        positions->enemies[i] = getRecordedPosition(base->active, base->x, base->y);
+    }
+    for (int i = 0; i < MAX_ENEMY_BULLETS; i++) {
+        const GameObject* base = &state->enemyBullets[i].base;
+        positions->enemyBullets[i] = getRecordedPosition(base->active, base->x, base->y);
+    }
+    for (int i = 0; i < MAX_PARTICLES; i++) {
+        const Particle* particle = &state->particles[i];
+        positions->particles[i] = getRecordedPosition(particle->active, particle->position.x, particle->position.y);
+    }
+    for (int i = 0; i < MAX_POWERUPS; i++) {
+        const GameObject* base = &state->powerups[i].base;
+        positions->powerups[i] = getRecordedPosition(base->active, base->x, base->y);
+    }
+}
+
+// Copy what the game screen draws; without previous positions nothing is blended
+void captureRenderSnapshot(const GameState* state, const EntityPositions* previous, RenderSnapshot* snapshot) {
+    snapshot->screenState = state->screenState;
+    snapshot->simTick = state->simTick;
+    snapshot->ship = state->ship;
+    memcpy(snapshot->bullets, state->bullets, sizeof(snapshot->bullets));
+    memcpy(snapshot->asteroids, state->asteroids, sizeof(snapshot->asteroids));
+    memcpy(snapshot->enemies, state->enemies, sizeof(snapshot->enemies));
+    memcpy(snapshot->enemyBullets, state->enemyBullets, sizeof(snapshot->enemyBullets));
+    memcpy(snapshot->particles, state->particles, sizeof(snapshot->particles));
+    memcpy(snapshot->powerups, state->powerups, sizeof(snapshot->powerups));
+    
+    if (previous != NULL) {
+        snapshot->previous = *previous;
+    } else {
+        recordPositions(state, &snapshot->previous);
+    }
+    
+    snapshot->camera = state->camera;
+    snapshot->worldWidth = state->world.width;
+    snapshot->worldHeight = state->world.height;
+    snapshot->currentWeapon = state->currentWeapon;
+    snapshot->normalAmmo = state->normalAmmo;
+    snapshot->shotgunAmmo = state->shotgunAmmo;
+    snapshot->grenadeAmmo = state->grenadeAmmo;
+    snapshot->score = state->score;
+    snapshot->lives = state->lives;
+    snapshot->health = state->health;
+    snapshot->reloadTimer = state->isReloading ? secondsUntilTick(state->reloadDoneTick, state->simTick) : 0.0f;
+    snapshot->isReloading = state->isReloading;
+    snapshot->currentWave = state->currentWave;
+    snapshot->asteroidsRemaining = state->entities.live[ENTITY_ASTEROID];
+    snapshot->entities = state->entities;
+    snapshot->enemiesSpawnedThisWave = state->enemiesSpawnedThisWave;
+    snapshot->maxEnemiesThisWave = state->maxEnemiesThisWave;
+    memcpy(snapshot->waveMessage, state->waveMessage, sizeof(snapshot->waveMessage));
+    snapshot->waveMessageTimer = secondsUntilTick(state->waveMessageEndTick, state->simTick);
+    snapshot->isInvulnerable = state->isInvulnerable;
+    snapshot->shipVisible = state->shipVisible;
+    snapshot->Debug = state->Debug;
+    snapshot->hasCustomCursor = state->hasCustomCursor;
+    snapshot->crosshairTexture = state->crosshairTexture;
+}
+
+// Fill the write slot from the game state and swap it into the shared slot
+static void publishSnapshot(void) {
+    RenderSnapshot* snapshot = &snapshots.slots[snapshots.writeSlot];
+    captureRenderSnapshot(simulation.state, &simulation.previous, snapshot);
+    snapshot->tick = simulation.tick;
+    snapshot->publishTime = getMonotonicTime();
+    
+    snapshots.writeSlot = atomicExchange(&snapshots.sharedSlot, snapshots.writeSlot | SNAPSHOT_DIRTY) & 3;
+}
+
+// Combine every queued input frame into one: latest held buttons and cursor, all presses
+static int mergeQueuedInput(InputFrame* input) {
+    int consumed = 0;
+    int head = atomicLoad(&inputQueue.head);
+    int tail = atomicLoad(&inputQueue.tail);
+    
+    while (head != tail) {
+        const InputFrame* frame = &inputQueue.frames[head];
+        input->held = frame->held;
+        input->pressed |= frame->pressed;
+        input->mouse = frame->mouse;
+        head = (head + 1) % INPUT_QUEUE_CAPACITY;
+        consumed++;
+    }
+    atomicStore(&inputQueue.head, head);
+    return consumed;
+}
+
+// Advance gameplay by one fixed step; also used directly by scripted trace runs
+void stepGame(GameState* state, const InputFrame* input) {
+    int allocationsBefore = getThreadAllocationCount();
+    
+    // A fresh game starts a new telemetry run
+    if (state->simTick == 0) {
+        beginRunTelemetry(state);
+    }
+    
+    // Stress scenarios replace what was destroyed last tick
+    updateScenario(state);
+    
+    beginSubsystem(SUBSYSTEM_INPUT);
+    handleInput(state, input);
+    endSubsystem();
+    updateGame(state, SIM_TICK_TIME);
+    
+    samplePoolTelemetry(state);
+    if (state->screenState == GAME_OVER_STATE) {
+        endRunTelemetry(state);
+    }
+    
+    // Steady-state gameplay must run out of the fixed pools
+    checkTickAllocations(state->simTick, getThreadAllocationCount() - allocationsBefore);
+    state->simTick++;
+}
+
+// Run one fixed step of gameplay
+static void runTick(SimulationStats* stats) {
+    GameState* state = simulation.state;
+    double start = getMonotonicTime();
+    beginSubsystem(SUBSYSTEM_SIMULATION);
+    
+    stats->queuedInputs = mergeQueuedInput(&simulation.input);
+    recordPositions(state, &simulation.previous);
+    stepGame(state, &simulation.input);
+    endSubsystem();
+    
+    // Presses are only acted on once
+    simulation.input.pressed = 0;
+    
+    simulation.tick++;
+    publishSnapshot();
+    
+    float tickTime = (float)(getMonotonicTime() - start);
+    stats->ticks = simulation.tick;
+    stats->tickTime = stats->tickTime * 0.9f + tickTime * 0.1f;
+}
+
+static int simulationThread(void* arg) {
+    (void)arg;
+    SimulationStats stats = {0};
+    double nextTick = 0;
+    
+    for (;;) {
+        lockMutex(&simulation.lock);
+        simulation.stats = stats;
+        
+        // Hand the game state back once gameplay stops (pause, game over) or the main thread asks for it
+        if (simulation.active && simulation.state->screenState != GAME_STATE) {
+            simulation.active = false;
+        }
+        
+        if (!simulation.active) {
+            simulation.parked = true;
+            broadcastCondition(&simulation.changed);
+            while (!simulation.active && !simulation.quit) {
+                waitCondition(&simulation.changed, &simulation.lock);
+            }
+            simulation.parked = false;
+            nextTick = getMonotonicTime();
+        }
+        
+        bool quit = simulation.quit;
+        unlockMutex(&simulation.lock);
+        if (quit) break;
+        
+        // Sleep until the next tick is due
+        double now = getMonotonicTime();
+        if (now < nextTick) {
+            sleepSeconds(nextTick - now);
+            continue;
+        }
+        
+        // After a long stall, drop the backlog instead of fast-forwarding through it
+        if (now - nextTick > SIM_MAX_CATCHUP_TICKS * SIM_TICK_TIME) {
+            stats.skippedTicks += (int)((now - nextTick) / SIM_TICK_TIME);
+            nextTick = now;
+        }
+        
+        runTick(&stats);
+        nextTick += SIM_TICK_TIME;
+    }
+    
+    lockMutex(&simulation.lock);
+    simulation.parked = true;
+    broadcastCondition(&simulation.changed);
+    unlockMutex(&simulation.lock);
+    return 0;
+}
+
+// Start the simulation thread, parked until gameplay begins
+void initSimulation(GameState* state) {
+    simulation.state = state;
+    snapshots.writeSlot = 0;
+    snapshots.sharedSlot = 1;
+    snapshots.readSlot = 2;
+    
+    if (!createMutex(&simulation.lock) || !createCondition(&simulation.changed) ||
+        !createThread(&simulation.thread, simulationThread, NULL)) {
+        printf("Error: Failed to start the simulation thread\n");
+        exit(1);
+    }
+}
+
+// Give the game state to the simulation thread
+void resumeSimulation(void) {
+    lockMutex(&simulation.lock);
+    if (!simulation.active) {
+        // Wait for the thread to finish parking so it isn't still touching the state
+        while (!simulation.parked && !simulation.quit) {
+            waitCondition(&simulation.changed, &simulation.lock);
+        }
+        
+        // The last tick may have just left gameplay; the main loop picks that up next frame
+        if (simulation.state->screenState != GAME_STATE) {
+            unlockMutex(&simulation.lock);
+            return;
+        }
+        
+        // Drop input sampled on other screens
+        atomicStore(&inputQueue.head, atomicLoad(&inputQueue.tail));
+        inputQueue.carriedPressed = 0;
+        simulation.input = (InputFrame){0};
+        
+        // Publish the current state so the first frame doesn't draw a stale snapshot
+        recordPositions(simulation.state, &simulation.previous);
+        publishSnapshot();
+        
+        simulation.active = true;
+        broadcastCondition(&simulation.changed);
+    }
+    unlockMutex(&simulation.lock);
+}
+
+// Take the game state back, waiting for the current tick to finish
+void pauseSimulation(void) {
+    lockMutex(&simulation.lock);
+    simulation.active = false;
+    while (!simulation.parked) {
+        waitCondition(&simulation.changed, &simulation.lock);
+    }
+    unlockMutex(&simulation.lock);
+}
+
+bool isSimulationActive(void) {
+    lockMutex(&simulation.lock);
+    bool active = simulation.active;
+    unlockMutex(&simulation.lock);
+    return active;
+}
+
+// Queue a main-thread input sample; when full, its presses ride along with the next frame
+void submitInputFrame(const InputFrame* frame) {
+    int tail = atomicLoad(&inputQueue.tail);
+    int next = (tail + 1) % INPUT_QUEUE_CAPACITY;
+    
+    if (next == atomicLoad(&inputQueue.head)) {
+        inputQueue.carriedPressed |= frame->pressed;
+        return;
+    }
+    
+    inputQueue.frames[tail] = *frame;
+    inputQueue.frames[tail].pressed |= inputQueue.carriedPressed;
+    inputQueue.carriedPressed = 0;
+    atomicStore(&inputQueue.tail, next);
+}
+
+// Move a position part of the way back toward where it was before the tick
+static void blendPosition(float* x, float* y, Vector2 previous, float alpha) {
+    if (isnan(previous.x)) return;
+    
+    float dx = *x - previous.x;
+    float dy = *y - previous.y;
+    if (dx * dx + dy * dy > INTERPOLATION_SNAP_DISTANCE * INTERPOLATION_SNAP_DISTANCE) return;
+    
+    *x = previous.x + dx * alpha;
+    *y = previous.y + dy * alpha;
+}
+
+// Take the newest snapshot and blend it with the tick before for the time since it was published
+const RenderSnapshot* acquireRenderSnapshot(void) {
+    if (atomicLoad(&snapshots.sharedSlot) & SNAPSHOT_DIRTY) {
+        snapshots.readSlot = atomicExchange(&snapshots.sharedSlot, snapshots.readSlot) & 3;
+    }
+    
+    const RenderSnapshot* latest = &snapshots.slots[snapshots.readSlot];
+    float alpha = (float)((getMonotonicTime() - latest->publishTime) * SIM_TICK_RATE);
+    if (alpha < 0.0f) alpha = 0.0f;
+    if (alpha > 1.0f) alpha = 1.0f;
+    
+    RenderSnapshot* view = &interpolatedView;
+    *view = *latest;
+    
+    const EntityPositions* previous = &latest->previous;
+    blendPosition(&view->ship.base.x, &view->ship.base.y, previous->ship, alpha);
+    for (int i = 0; i < MAX_BULLETS; i++) {
+        if (view->bullets[i].active) blendPosition(&view->bullets[i].x, &view->bullets[i].y, previous->bullets[i], alpha);
+    }
+    for (int i = 0; i < MAX_ASTEROIDS; i++) {
+        GameObject* base = &view->asteroids[i].base;
+        if (base->active) blendPosition(&base->x, &base->y, previous->asteroids[i], alpha);
+    }
+    for (int i = 0; i < MAX_ENEMIES; i++) {
+        GameObject* base = &view->enemies[i].base;
+        if (base->active) blendPosition(&base->x, &base->y, previous->enemies[i], alpha);
+    }
+    for (int i = 0; i < MAX_ENEMY_BULLETS; i++) {
+        GameObject* base = &view->enemyBullets[i].base;
+        if (base->active) blendPosition(&base->x, &base->y, previous->enemyBullets[i], alpha);
+    }
+    for (int i = 0; i < MAX_PARTICLES; i++) {
+        Particle* particle = &view->particles[i];
+        if (particle->active) blendPosition(&particle->position.x, &particle->position.y, previous->particles[i], alpha);
+    }
+    for (int i = 0; i < MAX_POWERUPS; i++) {
+        GameObject* base = &view->powerups[i].base;
+        if (base->active) blendPosition(&base->x, &base->y, previous->powerups[i], alpha);
+    }
+    
+    // The camera follows the ship, so it follows the blended ship too
+    view->camera.target = (Vector2){ view->ship.base.x, view->ship.base.y };
+    return view;
+}
+
+SimulationStats getSimulationStats(void) {
+    lockMutex(&simulation.lock);
+    SimulationStats stats = simulation.stats;
+    unlockMutex(&simulation.lock);
+    return stats;
+}
+
+// Stop and join the simulation thread
+void shutdownSimulation(void) {
+    lockMutex(&simulation.lock);
+    simulation.quit = true;
+    simulation.active = false;
+    broadcastCondition(&simulation.changed);
+    unlockMutex(&simulation.lock);
+    
+    joinThread(&simulation.thread);
+    destroyCondition(&simulation.changed);
+    destroyMutex(&simulation.lock);
+}
\ No newline at end of file
@@ -0,0 +1,192 @@
+#include <stdbool.h>
+#include <string.h>
+
+// Custom headers
+#include "typedefs.h"
+#include "config.h"
+#include "statehash.h"
+
+#define FNV_OFFSET_BASIS 0xcbf29ce484222325ULL
+#define FNV_PRIME 0x100000001b3ULL
+
+static const char* statePartNames[STATE_PART_COUNT] = {
+    [STATE_PART_PLAYER] = "player",
+    [STATE_PART_BULLETS] = "bullets",
+    [STATE_PART_ASTEROIDS] = "asteroids",
+    [STATE_PART_ENEMIES] = "enemies",
+    [STATE_PART_ENEMY_BULLETS] = "enemy_bullets",
+    [STATE_PART_PARTICLES] = "particles",
+    [STATE_PART_POWERUPS] = "powerups",
+    [STATE_PART_WAVE] = "wave"
+};
+
+static void hashWord(unsigned long long* hash, unsigned int value) {
+    unsigned char bytes[4] = {
+        (unsigned char)value, (unsigned char)(value >> 8), (unsigned char)(value >> 16), (unsigned char)(value >> 24)
+    };
+    for (size_t i = 0; i < sizeof(bytes); i++) {
+        *hash = (*hash ^ bytes[i]) * FNV_PRIME;
+    }
+}
+
+// Integers, flags and ticks feed the exact hash too, which must match even under a tolerance
+static void hashInt(StatePartDigest* part, int value) {
+    hashWord(&part->hash, (unsigned int)value);
+    hashWord(&part->exact, (unsigned int)value);
+}
+
+// Floats are hashed by their bits, so any reordering of float math shows up
+static void hashFloat(StatePartDigest* part, float value) {
+    unsigned int bits;
+    memcpy(&bits, &value, sizeof(bits));
+    hashWord(&part->hash, bits);
+}
+
+// One live entity: its slot, position and velocity, which also feed the tolerant sums
+static void addEntity(StatePartDigest* part, int slot, float x, float y, float dx, float dy) {
+    hashInt(part, slot);
+    hashFloat(part, x);
+    hashFloat(part, y);
+    hashFloat(part, dx);
+    hashFloat(part, dy);
+    part->active++;
+    part->sums[0] += x;
+    part->sums[1] += y;
+    part->sums[2] += dx;
+    part->sums[3] += dy;
+}
+
+static void digestPlayer(const GameState* state, StatePartDigest* part) {
+    const GameObject* ship = &state->ship.base;
+    addEntity(part, 0, ship->x, ship->y, ship->dx, ship->dy);
+    hashFloat(part, ship->angle);
+    hashInt(part, state->health);
+    hashInt(part, state->lives);
+    hashInt(part, state->score);
+    hashInt(part, state->currentWeapon);
+    hashInt(part, state->normalAmmo);
+    hashInt(part, state->shotgunAmmo);
+    hashInt(part, state->grenadeAmmo);
+    hashInt(part, state->isReloading);
+    hashInt(part, (int)state->reloadDoneTick);
+    hashInt(part, (int)state->fireReadyTick);
+    hashInt(part, (int)state->shotgunReadyTick);
+    hashInt(part, (int)state->grenadeReadyTick);
+    hashInt(part, state->isInvulnerable);
+    hashInt(part, (int)state->invulnerabilityEndTick);
+}
+
+static void digestBullets(const GameState* state, StatePartDigest* part) {
+    for (int i = 0; i < MAX_BULLETS; i++) {
+        const GameObject* bullet = &state->bullets[i];
+        if (!bullet->active) continue;
+        
+        addEntity(part, i, bullet->x, bullet->y, bullet->dx, bullet->dy);
+        hashInt(part, state->bulletWeapon[i]);
+    }
+}
+
+static void digestAsteroids(const GameState* state, StatePartDigest* part) {
+    for (int i = 0; i < MAX_ASTEROIDS; i++) {
+        const Asteroid* asteroid = &state->asteroids[i];
+        if (!asteroid->base.active) continue;
+        
+        addEntity(part, i, asteroid->base.x, asteroid->base.y, asteroid->base.dx, asteroid->base.dy);
+        hashInt(part, asteroid->size);
+        hashFloat(part, asteroid->base.radius);
+    }
+}
+
+static void digestEnemies(const GameState* state, StatePartDigest* part) {
+    for (int i = 0; i < MAX_ENEMIES; i++) {
+        const Enemy* enemy = &state->enemies[i];
+        if (!enemy->base.active) continue;
+        
+        addEntity(part, i, enemy->base.x, enemy->base.y, enemy->base.dx, enemy->base.dy);
+        hashInt(part, enemy->type);
+        hashInt(part, enemy->health);
+        hashFloat(part, enemy->base.angle);
+        hashInt(part, (int)enemy->fireReadyTick);
+        hashInt(part, enemy->burstCount);
+        hashInt(part, (int)enemy->burstReadyTick);
+        hashInt(part, enemy->isBursting);
+        hashFloat(part, enemy->moveAngle);
+        hashInt(part, (int)enemy->headingTick);
+    }
+}
+
+static void digestEnemyBullets(const GameState* state, StatePartDigest* part) {
+    for (int i = 0; i < MAX_ENEMY_BULLETS; i++) {
+        const Bullet* bullet = &state->enemyBullets[i];
+        if (!bullet->base.active) continue;
+        
+        addEntity(part, i, bullet->base.x, bullet->base.y, bullet->base.dx, bullet->base.dy);
+        hashInt(part, bullet->type);
+        hashInt(part, bullet->damage);
+        hashInt(part, bullet->isPlayerBullet);
+        hashInt(part, (int)bullet->fuseTick);
+        hashInt(part, bullet->hasExploded);
+    }
+}
+
+static void digestParticles(const GameState* state, StatePartDigest* part) {
+    for (int i = 0; i < MAX_PARTICLES; i++) {
+        const Particle* particle = &state->particles[i];
+        if (!particle->active) continue;
+        
+        addEntity(part, i, particle->position.x, particle->position.y, particle->velocity.x, particle->velocity.y);
+        hashFloat(part, particle->life);
+        hashFloat(part, particle->radius);
+    }
+}
+
+static void digestPowerups(const GameState* state, StatePartDigest* part) {
+    for (int i = 0; i < MAX_POWERUPS; i++) {
+        const Powerup* powerup = &state->powerups[i];
+        if (!powerup->base.active) continue;
+        
+        addEntity(part, i, powerup->base.x, powerup->base.y, (float)powerup->expireTick, 0.0f);
+        hashInt(part, powerup->type);
+        hashInt(part, (int)powerup->expireTick);
+    }
+}
+
+// Wave progress; the tolerant sums carry its timers
+static void digestWave(const GameState* state, StatePartDigest* part) {
+    hashInt(part, state->currentWave);
+    hashInt(part, state->entities.live[ENTITY_ASTEROID]);
+    hashInt(part, state->entities.live[ENTITY_ENEMY]);
+    hashInt(part, state->inWaveTransition);
+    hashInt(part, (int)state->nextWaveTick);
+    hashInt(part, (int)state->enemySpawnTick);
+    hashInt(part, state->enemiesSpawnedThisWave);
+    hashInt(part, state->maxEnemiesThisWave);
+    hashInt(part, state->EnemySpawnComplete);
+    hashInt(part, state->screenState);
+    hashInt(part, (int)state->simTick);
+    part->active = state->currentWave;
+    part->sums[0] = (float)state->nextWaveTick;
+    part->sums[1] = (float)state->enemySpawnTick;
+}
+
+void digestGameState(const GameState* state, StateDigest* digest) {
+    memset(digest, 0, sizeof(*digest));
+    for (int part = 0; part < STATE_PART_COUNT; part++) {
+        digest->parts[part].hash = FNV_OFFSET_BASIS;
+        digest->parts[part].exact = FNV_OFFSET_BASIS;
+    }
+    
+    digestPlayer(state, &digest->parts[STATE_PART_PLAYER]);
+    digestBullets(state, &digest->parts[STATE_PART_BULLETS]);
+    digestAsteroids(state, &digest->parts[STATE_PART_ASTEROIDS]);
+    digestEnemies(state, &digest->parts[STATE_PART_ENEMIES]);
+    digestEnemyBullets(state, &digest->parts[STATE_PART_ENEMY_BULLETS]);
+    digestParticles(state, &digest->parts[STATE_PART_PARTICLES]);
+    digestPowerups(state, &digest->parts[STATE_PART_POWERUPS]);
+    digestWave(state, &digest->parts[STATE_PART_WAVE]);
+}
+
+const char* getStatePartName(StatePart part) {
+    if (part < 0 || part >= STATE_PART_COUNT) return "unknown";
+    return statePartNames[part];
+}
\ No newline at end of file
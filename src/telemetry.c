@@ -0,0 +1,314 @@
+#include <stdbool.h>
+#include <stdio.h>
+#include <stdlib.h>
+#include <string.h>
+#include <time.h>
+
+// Custom headers
+#include "typedefs.h"
+#include "config.h"
+#include "telemetry.h"
+#include "platform.h"
+#include "lifecycle.h"
+
+// A slot is free for producers when sequence == position and ready for the writer when sequence == position + 1
+typedef struct {
+    volatile int sequence;
+    TelemetryEvent event;
+} TelemetrySlot;
+
+// Bounded multi-producer ring (simulation and main thread), drained by the writer thread
+typedef struct {
+    TelemetrySlot slots[TELEMETRY_RING_CAPACITY];
+    volatile int tail;      // Next position a producer claims
+    int head;               // Next position the writer reads, owned by the writer thread
+    volatile int dropped;   // Events lost because the ring was full
+    volatile int quit;
+    PlatformThread thread;
+    FILE* file;             // Current run's stream, owned by the writer thread
+    int written;
+    bool started;
+} Telemetry;
+
+static Telemetry telemetry = {0};
+
+// Highest occupancy of each pool during the current wave, owned by the simulation thread
+static int poolPeaks[TELEMETRY_POOL_COUNT];
+
+// Frame times since the last histogram sample, owned by the main thread
+static int frameBuckets[TELEMETRY_FRAME_BUCKETS];
+static float histogramTime = 0.0f;
+static int histogramWave = 0;
+static unsigned int histogramTick = 0;
+
+static const char* poolNames[TELEMETRY_POOL_COUNT] = {
+    [TELEMETRY_POOL_BULLETS] = "bullets",
+    [TELEMETRY_POOL_ASTEROIDS] = "asteroids",
+    [TELEMETRY_POOL_ENEMIES] = "enemies",
+    [TELEMETRY_POOL_ENEMY_BULLETS] = "enemy_bullets",
+    [TELEMETRY_POOL_PARTICLES] = "particles",
+    [TELEMETRY_POOL_POWERUPS] = "powerups"
+};
+
+// Ring positions wrap around instead of overflowing
+static int ringOffset(int position, int amount) {
+    return (int)((unsigned int)position + (unsigned int)amount);
+}
+
+static void writeUint32(unsigned char* out, unsigned int value) {
+    out[0] = (unsigned char)(value);
+    out[1] = (unsigned char)(value >> 8);
+    out[2] = (unsigned char)(value >> 16);
+    out[3] = (unsigned char)(value >> 24);
+}
+
+static void closeTelemetryFile(void) {
+    if (telemetry.file == NULL) return;
+    
+    fclose(telemetry.file);
+    telemetry.file = NULL;
+}
+
+// Each run gets its own file, named after the time it started
+static void openTelemetryFile(void) {
+    closeTelemetryFile();
+    
+    char path[64];
+    char stamp[32];
+    time_t now = time(NULL);
+    strftime(stamp, sizeof(stamp), "%Y%m%d_%H%M%S", localtime(&now));
+    snprintf(path, sizeof(path), "%s%s.bin", TELEMETRY_FILE_PREFIX, stamp);
+    
+    telemetry.file = fopen(path, "wb");
+    if (telemetry.file == NULL) {
+        printf("Warning: Could not create telemetry file %s\n", path);
+        return;
+    }
+    
+    unsigned char header[TELEMETRY_HEADER_SIZE];
+    writeUint32(header, TELEMETRY_FILE_MAGIC);
+    writeUint32(header + 4, TELEMETRY_FILE_VERSION);
+    writeUint32(header + 8, SIM_TICK_RATE);
+    writeUint32(header + 12, TELEMETRY_FRAME_BUCKETS);
+    writeUint32(header + 16, (unsigned int)(TELEMETRY_FRAME_BUCKET_WIDTH * 1000000.0f + 0.5f));
+    fwrite(header, 1, sizeof(header), telemetry.file);
+}
+
+static void writeEvent(const TelemetryEvent* event) {
+    if (event->type == TELEMETRY_RUN_START) {
+        openTelemetryFile();
+    }
+    if (telemetry.file == NULL) return;
+    
+    unsigned char record[TELEMETRY_EVENT_SIZE];
+    record[0] = event->type;
+    record[1] = event->arg;
+    record[2] = (unsigned char)(event->wave);
+    record[3] = (unsigned char)(event->wave >> 8);
+    writeUint32(record + 4, event->tick);
+    writeUint32(record + 8, (unsigned int)event->value);
+    fwrite(record, 1, sizeof(record), telemetry.file);
+    telemetry.written++;
+}
+
+// Write out everything producers have finished publishing
+static void drainTelemetry(void) {
+    bool wroteAny = false;
+    
+    for (;;) {
+        TelemetrySlot* slot = &telemetry.slots[telemetry.head & (TELEMETRY_RING_CAPACITY - 1)];
+        if (atomicLoad(&slot->sequence) != ringOffset(telemetry.head, 1)) break;
+        
+        TelemetryEvent event = slot->event;
+        atomicStore(&slot->sequence, ringOffset(telemetry.head, TELEMETRY_RING_CAPACITY));
+        telemetry.head = ringOffset(telemetry.head, 1);
+        
+        writeEvent(&event);
+        wroteAny = true;
+    }
+    
+    if (wroteAny && telemetry.file != NULL) {
+        fflush(telemetry.file);
+    }
+}
+
+static int telemetryThread(void* arg) {
+    (void)arg;
+    
+    while (!atomicLoad(&telemetry.quit)) {
+        drainTelemetry();
+        sleepSeconds(TELEMETRY_FLUSH_INTERVAL);
+    }
+    
+    // Producers have stopped by now; write whatever is left
+    drainTelemetry();
+    closeTelemetryFile();
+    return 0;
+}
+
+static void onEntitySpawned(GameState* state, EntityKind kind, int index) {
+    if (kind == ENTITY_POWERUP) {
+        recordGameTelemetry(state, TELEMETRY_POWERUP_SPAWN, state->powerups[index].type, 0);
+    }
+}
+
+static void onEntityDespawned(GameState* state, EntityKind kind, int index, DespawnCause cause) {
+    if (kind == ENTITY_ENEMY && cause == DESPAWN_SHOT) {
+        recordGameTelemetry(state, TELEMETRY_KILL, state->enemies[index].type, 0);
+    } else if (kind == ENTITY_POWERUP && cause == DESPAWN_COLLECTED) {
+        recordGameTelemetry(state, TELEMETRY_POWERUP_COLLECT, state->powerups[index].type, 0);
+    }
+}
+
+void initTelemetry(void) {
+    if (telemetry.started) return;
+    
+    for (int i = 0; i < TELEMETRY_RING_CAPACITY; i++) {
+        telemetry.slots[i].sequence = i;
+    }
+    
+    if (!createThread(&telemetry.thread, telemetryThread, NULL)) {
+        printf("Warning: Failed to start the telemetry thread, telemetry disabled\n");
+        return;
+    }
+    telemetry.started = true;
+    
+    addSpawnListener(onEntitySpawned);
+    addDespawnListener(onEntityDespawned);
+}
+
+// Safe to call from any thread; never waits
+void recordTelemetry(TelemetryEventType type, int arg, int wave, unsigned int tick, int value) {
+    if (!telemetry.started) return;
+    
+    int position = atomicLoad(&telemetry.tail);
+    TelemetrySlot* slot;
+    for (;;) {
+        slot = &telemetry.slots[position & (TELEMETRY_RING_CAPACITY - 1)];
+        int lag = ringOffset(atomicLoad(&slot->sequence), -position);
+        
+        if (lag == 0) {
+            if (atomicCompareExchange(&telemetry.tail, position, ringOffset(position, 1))) break;
+        } else if (lag < 0) {
+            // The writer hasn't caught up; losing an event beats stalling a frame
+            atomicAdd(&telemetry.dropped, 1);
+            return;
+        }
+        position = atomicLoad(&telemetry.tail);
+    }
+    
+    slot->event.type = (unsigned char)type;
+    slot->event.arg = (unsigned char)arg;
+    slot->event.wave = (unsigned short)wave;
+    slot->event.tick = tick;
+    slot->event.value = value;
+    atomicStore(&slot->sequence, ringOffset(position, 1));
+}
+
+// Stop the writer after it has flushed everything recorded so far
+void shutdownTelemetry(void) {
+    if (!telemetry.started) return;
+    
+    atomicStore(&telemetry.quit, 1);
+    joinThread(&telemetry.thread);
+    telemetry.started = false;
+    
+    int dropped = atomicLoad(&telemetry.dropped);
+    if (dropped > 0) {
+        printf("Telemetry: wrote %d events, dropped %d\n", telemetry.written, dropped);
+    }
+}
+
+const char* getTelemetryPoolName(TelemetryPool pool) {
+    if (pool < 0 || pool >= TELEMETRY_POOL_COUNT) return "unknown";
+    return poolNames[pool];
+}
+
+void recordGameTelemetry(const GameState* state, TelemetryEventType type, int arg, int value) {
+    recordTelemetry(type, arg, state->currentWave, state->simTick, value);
+}
+
+static void recordPoolPeaks(const GameState* state) {
+    for (int pool = 0; pool < TELEMETRY_POOL_COUNT; pool++) {
+        recordGameTelemetry(state, TELEMETRY_POOL_PEAK, pool, poolPeaks[pool]);
+        poolPeaks[pool] = 0;
+    }
+}
+
+// First tick of a new game; the writer starts a new file on this event
+void beginRunTelemetry(const GameState* state) {
+    if (!telemetry.started) return;
+    
+    memset(poolPeaks, 0, sizeof(poolPeaks));
+    recordGameTelemetry(state, TELEMETRY_RUN_START, 0, SIM_TICK_RATE);
+}
+
+// The game is over; close out the unfinished wave
+void endRunTelemetry(const GameState* state) {
+    if (!telemetry.started) return;
+    
+    recordGameTelemetry(state, TELEMETRY_WAVE_END, 0, (int)(state->simTick - state->waveStartTick));
+    recordPoolPeaks(state);
+    recordGameTelemetry(state, TELEMETRY_RUN_END, 0, state->score);
+}
+
+// The current wave was cleared
+void endWaveTelemetry(const GameState* state) {
+    if (!telemetry.started) return;
+    
+    recordGameTelemetry(state, TELEMETRY_WAVE_END, 1, (int)(state->simTick - state->waveStartTick));
+    recordPoolPeaks(state);
+}
+
+static void notePoolPeak(TelemetryPool pool, int active) {
+    if (active > poolPeaks[pool]) {
+        poolPeaks[pool] = active;
+    }
+}
+
+// Track pool high-water marks; called once per simulation tick.
+// Headless batch games run without telemetry, so nothing here is shared between them.
+void samplePoolTelemetry(const GameState* state) {
+    if (!telemetry.started) return;
+    
+    // Lifecycle events keep the gameplay pools counted; only particles still need a scan
+    notePoolPeak(TELEMETRY_POOL_BULLETS, state->entities.live[ENTITY_BULLET]);
+    notePoolPeak(TELEMETRY_POOL_ASTEROIDS, state->entities.live[ENTITY_ASTEROID]);
+    notePoolPeak(TELEMETRY_POOL_ENEMIES, state->entities.live[ENTITY_ENEMY]);
+    notePoolPeak(TELEMETRY_POOL_ENEMY_BULLETS, state->entities.live[ENTITY_ENEMY_BULLET]);
+    notePoolPeak(TELEMETRY_POOL_POWERUPS, state->entities.live[ENTITY_POWERUP]);
+    
+    int active = 0;
+    for (int i = 0; i < MAX_PARTICLES; i++) active += state->particles[i].active;
+    notePoolPeak(TELEMETRY_POOL_PARTICLES, active);
+}
+
+// Send the frames collected so far as one histogram sample
+void flushFrameTelemetry(void) {
+    for (int bucket = 0; bucket < TELEMETRY_FRAME_BUCKETS; bucket++) {
+        if (frameBuckets[bucket] > 0) {
+            recordTelemetry(TELEMETRY_FRAME_HISTOGRAM, bucket, histogramWave, histogramTick, frameBuckets[bucket]);
+            frameBuckets[bucket] = 0;
+        }
+    }
+    histogramTime = 0.0f;
+}
+
+// Count one gameplay frame; samples never straddle a wave so they can be lined up with it
+void recordFrameTelemetry(float frameTime, int wave, unsigned int tick) {
+    if (wave != histogramWave) {
+        flushFrameTelemetry();
+        histogramWave = wave;
+    }
+    histogramTick = tick;
+    
+    int bucket = (int)(frameTime / TELEMETRY_FRAME_BUCKET_WIDTH);
+    if (bucket < 0) bucket = 0;
+    if (bucket >= TELEMETRY_FRAME_BUCKETS) bucket = TELEMETRY_FRAME_BUCKETS - 1;
+    frameBuckets[bucket]++;
+    
+    histogramTime += frameTime;
+    if (histogramTime >= TELEMETRY_HISTOGRAM_INTERVAL) {
+        flushFrameTelemetry();
+    }
+}
\ No newline at end of file
@@ -0,0 +1,125 @@
+#include <stdbool.h>
+#include <stdio.h>
+#include <stdlib.h>
+#include <math.h>
+
+// Custom headers
+#include "typedefs.h"
+#include "config.h"
+#include "timerwheel.h"
+
+#define TIMER_WHEEL_MASK (TIMER_WHEEL_SLOTS - 1)
+
+void resetTimerWheel(TimerWheel* wheel, unsigned int tick) {
+    for (int level = 0; level < TIMER_WHEEL_LEVELS; level++) {
+        for (int slot = 0; slot < TIMER_WHEEL_SLOTS; slot++) {
+            wheel->slots[level][slot] = -1;
+        }
+    }
+    
+    for (int i = 0; i < MAX_GAME_TIMERS; i++) {
+        wheel->entries[i].next = i + 1 < MAX_GAME_TIMERS ? i + 1 : -1;
+    }
+    wheel->freeList = 0;
+    wheel->count = 0;
+    wheel->now = tick;
+}
+
+// File an entry under the finest level whose slots still reach its deadline
+static void insertTimer(TimerWheel* wheel, int index) {
+    GameTimer* timer = &wheel->entries[index];
+    unsigned int delta = timer->deadline > wheel->now ? timer->deadline - wheel->now : 0;
+    unsigned int position = delta > 0 ? timer->deadline : wheel->now;
+    
+    int level = 0;
+    while (level < TIMER_WHEEL_LEVELS - 1 && delta >= 1u << (TIMER_WHEEL_BITS * (level + 1))) {
+        level++;
+    }
+    
+    // Beyond the top level's reach: park in its farthest slot and sort again when that comes round
+    unsigned int reach = 1u << (TIMER_WHEEL_BITS * TIMER_WHEEL_LEVELS);
+    if (delta >= reach) {
+        position = wheel->now + reach - 1;
+    }
+    
+    int* slot = &wheel->slots[level][(position >> (TIMER_WHEEL_BITS * level)) & TIMER_WHEEL_MASK];
+    timer->next = *slot;
+    *slot = index;
+}
+
+bool scheduleTimer(TimerWheel* wheel, unsigned int deadline, TimerEvent event, int owner) {
+    int index = wheel->freeList;
+    if (index < 0) return false;
+    
+    wheel->freeList = wheel->entries[index].next;
+    wheel->count++;
+    
+    GameTimer* timer = &wheel->entries[index];
+    timer->deadline = deadline;
+    timer->event = event;
+    timer->owner = owner;
+    insertTimer(wheel, index);
+    return true;
+}
+
+// Move one tick on; at each boundary the coarser slot now in range is spread over the finer ones
+static void advanceTimerWheel(TimerWheel* wheel) {
+    wheel->now++;
+    
+    for (int level = TIMER_WHEEL_LEVELS - 1; level > 0; level--) {
+        unsigned int span = 1u << (TIMER_WHEEL_BITS * level);
+        if ((wheel->now & (span - 1)) != 0) continue;
+        
+        int* slot = &wheel->slots[level][(wheel->now >> (TIMER_WHEEL_BITS * level)) & TIMER_WHEEL_MASK];
+        int index = *slot;
+        *slot = -1;
+        while (index >= 0) {
+            int next = wheel->entries[index].next;
+            insertTimer(wheel, index);
+            index = next;
+        }
+    }
+}
+
+bool popExpiredTimer(TimerWheel* wheel, unsigned int tick, GameTimer* expired) {
+    for (;;) {
+        int* slot = &wheel->slots[0][wheel->now & TIMER_WHEEL_MASK];
+        if (*slot >= 0) {
+            int index = *slot;
+            *expired = wheel->entries[index];
+            *slot = expired->next;
+            
+            wheel->entries[index].next = wheel->freeList;
+            wheel->freeList = index;
+            wheel->count--;
+            return true;
+        }
+        
+        if (wheel->now >= tick) return false;
+        advanceTimerWheel(wheel);
+    }
+}
+
+unsigned int scheduleGameTimer(GameState* state, float seconds, TimerEvent event, int owner) {
+    unsigned int deadline = state->simTick + ticksFromSeconds(seconds);
+    if (!scheduleTimer(&state->timers, deadline, event, owner)) {
+#if defined(DEBUG) || defined(BENCHMARK)
+        // A lost event leaves its owner waiting on a deadline that never fires
+        printf("TIMER WHEEL FULL: event %d for owner %d dropped (MAX_GAME_TIMERS %d)\n",
+               (int)event, owner, MAX_GAME_TIMERS);
+        fflush(stdout);
+        abort();
+#endif
+    }
+    return deadline;
+}
+
+unsigned int ticksFromSeconds(float seconds) {
+    // The small margin absorbs float error in lengths that are whole ticks
+    float ticks = ceilf(seconds * SIM_TICK_RATE - 0.001f);
+    return ticks < 1.0f ? 1u : (unsigned int)ticks;
+}
+
+float secondsUntilTick(unsigned int deadline, unsigned int tick) {
+    return deadline > tick ? (float)(deadline - tick) / SIM_TICK_RATE : 0.0f;
+}
\ No newline at end of file
@@ -0,0 +1,224 @@
+#include "raylib.h"
+#include <stdbool.h>
+#include <stdio.h>
+#include <string.h>
+#include <math.h>
+
+// Custom headers
+#include "typedefs.h"
+#include "config.h"
+#include "trace.h"
+#include "statehash.h"
+#include "simulation.h"
+#include "initialize.h"
+#include "random.h"
+#include "bot.h"
+
+static void writeUint32(unsigned char* out, unsigned int value) {
+    out[0] = (unsigned char)(value);
+    out[1] = (unsigned char)(value >> 8);
+    out[2] = (unsigned char)(value >> 16);
+    out[3] = (unsigned char)(value >> 24);
+}
+
+static unsigned int readUint32(const unsigned char* in) {
+    return (unsigned int)in[0] | ((unsigned int)in[1] << 8) |
+           ((unsigned int)in[2] << 16) | ((unsigned int)in[3] << 24);
+}
+
+static void writeFloat(unsigned char* out, float value) {
+    unsigned int bits;
+    memcpy(&bits, &value, sizeof(bits));
+    writeUint32(out, bits);
+}
+
+static float readFloat(const unsigned char* in) {
+    unsigned int bits = readUint32(in);
+    float value;
+    memcpy(&value, &bits, sizeof(value));
+    return value;
+}
+
+static void encodeTick(unsigned char* out, const InputFrame* input, const StateDigest* digest) {
+    writeUint32(out, input->held);
+    writeUint32(out + 4, input->pressed);
+    writeFloat(out + 8, input->mouse.x);
+    writeFloat(out + 12, input->mouse.y);
+    
+    unsigned char* record = out + TRACE_INPUT_SIZE;
+    for (int i = 0; i < STATE_PART_COUNT; i++, record += TRACE_PART_SIZE) {
+        const StatePartDigest* part = &digest->parts[i];
+        writeUint32(record, (unsigned int)part->hash);
+        writeUint32(record + 4, (unsigned int)(part->hash >> 32));
+        writeUint32(record + 8, (unsigned int)part->exact);
+        writeUint32(record + 12, (unsigned int)(part->exact >> 32));
+        writeUint32(record + 16, (unsigned int)part->active);
+        for (int s = 0; s < 4; s++) writeFloat(record + 20 + s * 4, part->sums[s]);
+    }
+}
+
+static void decodeTick(const unsigned char* in, InputFrame* input, StateDigest* digest) {
+    input->held = readUint32(in);
+    input->pressed = readUint32(in + 4);
+    input->mouse.x = readFloat(in + 8);
+    input->mouse.y = readFloat(in + 12);
+    
+    const unsigned char* record = in + TRACE_INPUT_SIZE;
+    for (int i = 0; i < STATE_PART_COUNT; i++, record += TRACE_PART_SIZE) {
+        StatePartDigest* part = &digest->parts[i];
+        part->hash = readUint32(record) | ((unsigned long long)readUint32(record + 4) << 32);
+        part->exact = readUint32(record + 8) | ((unsigned long long)readUint32(record + 12) << 32);
+        part->active = (int)readUint32(record + 16);
+        for (int s = 0; s < 4; s++) part->sums[s] = readFloat(record + 20 + s * 4);
+    }
+}
+
+// Same seed, same fresh game: everything after this is driven by the recorded input
+static void startTraceGame(GameState* state, unsigned int seed) {
+    seedGameRandom(state, seed);
+    resetGameData(state);
+    state->screenState = GAME_STATE;
+}
+
+static int recordTrace(GameState* state, const TraceOptions* options) {
+    FILE* file = fopen(options->path, "wb");
+    if (file == NULL) {
+        printf("Error: Could not create trace %s\n", options->path);
+        return 1;
+    }
+    
+    // The tick count is filled in once the run is over
+    unsigned char header[TRACE_HEADER_SIZE];
+    writeUint32(header, TRACE_FILE_MAGIC);
+    writeUint32(header + 4, TRACE_FILE_VERSION);
+    writeUint32(header + 8, options->seed);
+    writeUint32(header + 12, (unsigned int)options->waves);
+    writeUint32(header + 16, 0);
+    writeUint32(header + 20, STATE_PART_COUNT);
+    fwrite(header, 1, sizeof(header), file);
+    
+    startTraceGame(state, options->seed);
+    unsigned int ticks = 0;
+    unsigned char record[TRACE_TICK_SIZE];
+    while (state->screenState == GAME_STATE && state->currentWave <= options->waves && ticks < TRACE_MAX_TICKS) {
+        InputFrame input;
+        StateDigest digest;
+        updateBotInput(state, &input);
+        stepGame(state, &input);
+        digestGameState(state, &digest);
+        
+        encodeTick(record, &input, &digest);
+        fwrite(record, 1, sizeof(record), file);
+        ticks++;
+    }
+    
+    writeUint32(header + 16, ticks);
+    fseek(file, 0, SEEK_SET);
+    fwrite(header, 1, sizeof(header), file);
+    bool failed = ferror(file) != 0;
+    if (fclose(file) != 0 || failed) {
+        printf("Error: Could not write trace %s\n", options->path);
+        return 1;
+    }
+    
+    printf("Recorded %u ticks (%.1f s) with seed %u to %s\n", ticks, (float)ticks / SIM_TICK_RATE, options->seed, options->path);
+    if (state->currentWave <= options->waves) {
+        printf("Warning: The run ended in wave %d before clearing %d waves\n", state->currentWave, options->waves);
+    }
+    return 0;
+}
+
+static bool sumsMatch(float expected, float actual, float tolerance) {
+    float scale = fmaxf(1.0f, fmaxf(fabsf(expected), fabsf(actual)));
+    return fabsf(expected - actual) <= tolerance * scale;
+}
+
+// Bit-exact unless a tolerance is given; even then the integer and tick fields must match
+// exactly, and only the float sums may drift
+static bool partsMatch(const StatePartDigest* expected, const StatePartDigest* actual, float tolerance) {
+    if (expected->exact != actual->exact) return false;
+    if (expected->hash == actual->hash) return true;
+    if (tolerance <= 0.0f || expected->active != actual->active) return false;
+    
+    for (int s = 0; s < 4; s++) {
+        if (!sumsMatch(expected->sums[s], actual->sums[s], tolerance)) return false;
+    }
+    return true;
+}
+
+static void reportDivergence(const GameState* state, unsigned int tick, const StateDigest* expected, const StateDigest* actual,
+                             float tolerance) {
+    printf("Trace diverged at tick %u (%.2f s, wave %d)\n", tick, (float)tick / SIM_TICK_RATE, state->currentWave);
+    for (int i = 0; i < STATE_PART_COUNT; i++) {
+        const StatePartDigest* want = &expected->parts[i];
+        const StatePartDigest* got = &actual->parts[i];
+        if (partsMatch(want, got, tolerance)) continue;
+        
+        printf("  %-14s hash %016llx, expected %016llx; live %d, expected %d\n", getStatePartName((StatePart)i),
+               got->hash, want->hash, got->active, want->active);
+        printf("  %-14s exact %016llx, expected %016llx\n", "", got->exact, want->exact);
+        printf("  %-14s sums %.4f %.4f %.4f %.4f, expected %.4f %.4f %.4f %.4f\n", "", got->sums[0], got->sums[1],
+               got->sums[2], got->sums[3], want->sums[0], want->sums[1], want->sums[2], want->sums[3]);
+    }
+}
+
+static int verifyTrace(GameState* state, const TraceOptions* options) {
+    FILE* file = fopen(options->path, "rb");
+    if (file == NULL) {
+        printf("Error: Could not open trace %s\n", options->path);
+        return 1;
+    }
+    
+    unsigned char header[TRACE_HEADER_SIZE];
+    if (fread(header, 1, sizeof(header), file) != sizeof(header) ||
+        readUint32(header) != TRACE_FILE_MAGIC || readUint32(header + 4) != TRACE_FILE_VERSION ||
+        readUint32(header + 20) != STATE_PART_COUNT) {
+        printf("Error: %s is not a version %d trace\n", options->path, TRACE_FILE_VERSION);
+        fclose(file);
+        return 1;
+    }
+    unsigned int seed = readUint32(header + 8);
+    int waves = (int)readUint32(header + 12);
+    unsigned int ticks = readUint32(header + 16);
+    
+    startTraceGame(state, seed);
+    unsigned char record[TRACE_TICK_SIZE];
+    for (unsigned int tick = 0; tick < ticks; tick++) {
+        if (fread(record, 1, sizeof(record), file) != sizeof(record)) {
+            printf("Error: %s ends after %u of %u ticks\n", options->path, tick, ticks);
+            fclose(file);
+            return 1;
+        }
+        
+        InputFrame input;
+        StateDigest expected;
+        StateDigest actual;
+        decodeTick(record, &input, &expected);
+        stepGame(state, &input);
+        digestGameState(state, &actual);
+        
+        for (int i = 0; i < STATE_PART_COUNT; i++) {
+            if (!partsMatch(&expected.parts[i], &actual.parts[i], options->tolerance)) {
+                reportDivergence(state, tick, &expected, &actual, options->tolerance);
+                fclose(file);
+                return 1;
+            }
+        }
+    }
+    fclose(file);
+    
+    if (options->tolerance > 0.0f) {
+        printf("Trace matched within %g: %u ticks, seed %u, %d waves\n", options->tolerance, ticks, seed, waves);
+    } else {
+        printf("Trace matched bit for bit: %u ticks, seed %u, %d waves\n", ticks, seed, waves);
+    }
+    return 0;
+}
+
+// Run the scripted game headless and return the process exit code
+int runTrace(GameState* state, const TraceOptions* options) {
+    if (options->mode == TRACE_RECORD) {
+        return recordTrace(state, options);
+    }
+    return verifyTrace(state, options);
+}
\ No newline at end of file
@@ -0,0 +1,159 @@
+#include "raylib.h"
+#include "rlgl.h"
+#include <stdbool.h>
+#include <math.h>
+
+// Custom headers
+#include "typedefs.h"
+#include "config.h"
+#include "viewport.h"
+#include "governor.h"
+
+// Internal render target that the whole game draws into at a logical
+// WINDOW_WIDTH x WINDOW_HEIGHT resolution, then scaled up to the window
+typedef struct {
+    RenderTexture2D target;
+    Rectangle destination;   // Letterboxed area of the window the target is drawn to
+    int windowWidth;
+    int windowHeight;
+    float renderScale;       // Scale picked on the options screen
+    float renderScaleCap;    // Upper limit set by the quality governor
+    bool dirty;
+    bool loaded;
+} Viewport;
+
+static Viewport viewport = { .renderScale = DEFAULT_RENDER_SCALE, .renderScaleCap = 1.0f, .dirty = true };
+
+// Render scales offered on the options screen
+static const float renderScaleSteps[] = { 0.5f, 0.75f, 1.0f };
+#define RENDER_SCALE_STEP_COUNT (int)(sizeof(renderScaleSteps) / sizeof(renderScaleSteps[0]))
+
+// Fit the logical resolution into the window, keeping the aspect ratio
+static Rectangle getLetterbox(int windowWidth, int windowHeight) {
+    float scale = fminf((float)windowWidth / WINDOW_WIDTH, (float)windowHeight / WINDOW_HEIGHT);
+    float width = WINDOW_WIDTH * scale;
+    float height = WINDOW_HEIGHT * scale;
+    return (Rectangle){ (windowWidth - width) / 2, (windowHeight - height) / 2, width, height };
+}
+
+// Recreate the render target for the current window size and render scale
+static void rebuildTarget(void) {
+    viewport.destination = getLetterbox(viewport.windowWidth, viewport.windowHeight);
+    
+    float scale = getEffectiveRenderScale();
+    int targetWidth = (int)(viewport.destination.width * scale);
+    int targetHeight = (int)(viewport.destination.height * scale);
+    if (targetWidth < 1) targetWidth = 1;
+    if (targetHeight < 1) targetHeight = 1;
+    
+    if (viewport.loaded) UnloadRenderTexture(viewport.target);
+    viewport.target = LoadRenderTexture(targetWidth, targetHeight);
+    SetTextureFilter(viewport.target.texture, TEXTURE_FILTER_BILINEAR);
+    viewport.loaded = true;
+    
+    // Map window mouse coordinates back into logical coordinates
+    SetMouseOffset((int)-viewport.destination.x, (int)-viewport.destination.y);
+    SetMouseScale(WINDOW_WIDTH / viewport.destination.width, WINDOW_HEIGHT / viewport.destination.height);
+    
+    viewport.dirty = false;
+}
+
+void initViewport(void) {
+    viewport.windowWidth = GetScreenWidth();
+    viewport.windowHeight = GetScreenHeight();
+    rebuildTarget();
+}
+
+// Pick up window resizes and render scale changes; safe to call every loop iteration
+void updateViewport(void) {
+    int windowWidth = GetScreenWidth();
+    int windowHeight = GetScreenHeight();
+    if (windowWidth != viewport.windowWidth || windowHeight != viewport.windowHeight) {
+        viewport.windowWidth = windowWidth;
+        viewport.windowHeight = windowHeight;
+        viewport.dirty = true;
+    }
+    
+    if (viewport.dirty) rebuildTarget();
+}
+
+// Start drawing a frame into the internal target using logical coordinates
+void beginFrame(void) {
+    updateViewport();
+    
+    BeginTextureMode(viewport.target);
+    
+    // BeginTextureMode sets up a projection in target pixels; replace it with
+    // the logical resolution so all layout code keeps using WINDOW_WIDTH/HEIGHT
+    rlMatrixMode(RL_PROJECTION);
+    rlLoadIdentity();
+    rlOrtho(0, WINDOW_WIDTH, WINDOW_HEIGHT, 0, 0.0, 1.0);
+    rlMatrixMode(RL_MODELVIEW);
+    rlLoadIdentity();
+}
+
+// Upscale the internal target to the window and present the frame
+void endFrame(void) {
+    EndTextureMode();
+    
+    BeginDrawing();
+    ClearBackground(BLACK);
+    
+    // Render textures are stored upside down
+    Rectangle source = { 0, 0, (float)viewport.target.texture.width, -(float)viewport.target.texture.height };
+    DrawTexturePro(viewport.target.texture, source, viewport.destination, (Vector2){ 0, 0 }, 0.0f, WHITE);
+    
+    // Everything before this point is frame work; EndDrawing then waits for the target FPS
+    markGovernorWorkDone();
+    EndDrawing();
+}
+
+void setRenderScale(float scale) {
+    if (scale < MIN_RENDER_SCALE) scale = MIN_RENDER_SCALE;
+    if (scale > 1.0f) scale = 1.0f;
+    if (scale == viewport.renderScale) return;
+    
+    viewport.renderScale = scale;
+    viewport.dirty = true;
+}
+
+float getRenderScale(void) {
+    return viewport.renderScale;
+}
+
+// Limit the internal resolution without changing the player's chosen scale
+void setRenderScaleCap(float cap) {
+    if (cap < MIN_RENDER_SCALE) cap = MIN_RENDER_SCALE;
+    if (cap > 1.0f) cap = 1.0f;
+    if (cap == viewport.renderScaleCap) return;
+    
+    float previousScale = getEffectiveRenderScale();
+    viewport.renderScaleCap = cap;
+    if (getEffectiveRenderScale() != previousScale) viewport.dirty = true;
+}
+
+// The scale the target is actually rendered at
+float getEffectiveRenderScale(void) {
+    return viewport.renderScale < viewport.renderScaleCap ? viewport.renderScale : viewport.renderScaleCap;
+}
+
+// Step to the next render scale on the options screen, wrapping around
+float cycleRenderScale(void) {
+    int next = 0;
+    for (int i = 0; i < RENDER_SCALE_STEP_COUNT; i++) {
+        if (renderScaleSteps[i] > viewport.renderScale + 0.01f) {
+            next = i;
+            break;
+        }
+    }
+    
+    setRenderScale(renderScaleSteps[next]);
+    return viewport.renderScale;
+}
+
+void unloadViewport(void) {
+    if (!viewport.loaded) return;
+    
+    UnloadRenderTexture(viewport.target);
+    viewport.loaded = false;
+}
\ No newline at end of file
@@ -0,0 +1,275 @@
+#include "raylib.h"
+#include <stdbool.h>
+#include <stdlib.h>
+#include <math.h>
+
+// Custom headers
+#include "typedefs.h"
+#include "config.h"
+#include "world.h"
+#include "enemies.h"
+#include "asteroidmesh.h"
+#include "random.h"
+#include "lifecycle.h"
+
+// Small deterministic generator per sector so streaming never touches the gameplay RNG
+static unsigned int sectorRandom(Sector* sector) {
+    sector->random ^= sector->random << 13;
+    sector->random ^= sector->random >> 17;
+    sector->random ^= sector->random << 5;
+    return sector->random;
+}
+
+static float sectorRandomRange(Sector* sector, float min, float max) {
+    return min + (max - min) * (float)(sectorRandom(sector) % 10001) / 10000.0f;
+}
+
+// Spread the world seed and sector index into a non-zero generator state
+static unsigned int getSectorSeed(unsigned int worldSeed, int index) {
+    unsigned int seed = worldSeed ^ ((unsigned int)index * 0x9E3779B9u);
+    seed ^= seed >> 16;
+    seed *= 0x85EBCA6Bu;
+    seed ^= seed >> 13;
+    seed *= 0xC2B2AE35u;
+    seed ^= seed >> 16;
+    return seed != 0 ? seed : 1;
+}
+
+static int getSectorAt(const World* world, float x, float y) {
+    int column = (int)(x / SECTOR_SIZE);
+    int row = (int)(y / SECTOR_SIZE);
+    if (column < 0) column = 0;
+    if (column >= world->columns) column = world->columns - 1;
+    if (row < 0) row = 0;
+    if (row >= world->rows) row = world->rows - 1;
+    return row * world->columns + column;
+}
+
+static Rectangle getSectorBounds(const World* world, int index) {
+    float x = (float)(index % world->columns) * SECTOR_SIZE;
+    float y = (float)(index / world->columns) * SECTOR_SIZE;
+    return (Rectangle){ x, y, fminf(SECTOR_SIZE, world->width - x), fminf(SECTOR_SIZE, world->height - y) };
+}
+
+// Steps between two sectors, counting diagonals as one
+static int getSectorRange(const World* world, int a, int b) {
+    int columns = abs(a % world->columns - b % world->columns);
+    int rows = abs(a / world->columns - b / world->columns);
+    return columns > rows ? columns : rows;
+}
+
+// Fill a sector the first time the ship comes near it; the same seed always gives the same contents
+static void generateSector(GameState* state, int index) {
+    Sector* sector = &state->world.sectors[index];
+    Rectangle bounds = getSectorBounds(&state->world, index);
+    
+    sector->asteroidCount = 1 + (int)(sectorRandom(sector) % SECTOR_GENERATED_ASTEROIDS);
+    for (int i = 0; i < sector->asteroidCount; i++) {
+        DormantAsteroid* asteroid = &sector->asteroids[i];
+        asteroid->size = 1 + (int)(sectorRandom(sector) % 3);
+        
+        float radius = 20.0f * asteroid->size;
+        asteroid->position.x = sectorRandomRange(sector, bounds.x + radius, bounds.x + bounds.width - radius);
+        asteroid->position.y = sectorRandomRange(sector, bounds.y + radius, bounds.y + bounds.height - radius);
+        
+        // Same speeds as wave asteroids
+        float angle = sectorRandomRange(sector, 0.0f, 2.0f * PI);
+        float speed = sectorRandomRange(sector, 1.0f, 2.0f);
+        asteroid->velocity = (Vector2){ sinf(angle) * speed, -cosf(angle) * speed };
+        asteroid->angle = (float)(sectorRandom(sector) % 360);
+        // Only picks an outline id; the meshes themselves were all built at startup
+        asteroid->meshId = acquireAsteroidMesh(asteroid->size, sectorRandom(sector));
+    }
+    
+    // Draw the enemy rolls either way so asteroids and enemies don't depend on the wave
+    int enemies = (int)(sectorRandom(sector) % (SECTOR_GENERATED_ENEMIES + 1));
+    int tankRoll = (int)(sectorRandom(sector) % 3);
+    if (state->currentWave >= SCOUT_START_WAVE) {
+        sector->tanks = (state->currentWave >= TANK_START_WAVE && tankRoll == 0 && enemies > 0) ? 1 : 0;
+        sector->scouts = enemies - sector->tanks;
+    }
+}
+
+// Pack an asteroid into the dormant sector it drifted into; a full sector leaves it
+// active in the pool, and it tries again next tick
+static void sleepAsteroid(GameState* state, Sector* sector, int index) {
+    if (sector->asteroidCount >= SECTOR_MAX_ASTEROIDS) return;
+    
+    Asteroid* asteroid = &state->asteroids[index];
+    sector->asteroids[sector->asteroidCount++] = (DormantAsteroid){
+        { asteroid->base.x, asteroid->base.y },
+        { asteroid->base.dx, asteroid->base.dy },
+        asteroid->base.angle,
+        asteroid->size,
+        asteroid->meshId
+    };
+    despawnEntity(state, ENTITY_ASTEROID, index, DESPAWN_SLEEP);
+}
+
+static void sleepEnemy(GameState* state, Sector* sector, int index) {
+    if (sector->tanks + sector->scouts >= SECTOR_MAX_ENEMIES) return;
+    
+    if (state->enemies[index].type == ENEMY_TANK) {
+        sector->tanks++;
+    } else {
+        sector->scouts++;
+    }
+    despawnEntity(state, ENTITY_ENEMY, index, DESPAWN_SLEEP);
+}
+
+static bool isClearOfShip(const GameState* state, float x, float y) {
+    float dx = x - state->ship.base.x;
+    float dy = y - state->ship.base.y;
+    return dx * dx + dy * dy >= SECTOR_SPAWN_CLEARANCE * SECTOR_SPAWN_CLEARANCE;
+}
+
+// Move whatever an active sector still holds into the gameplay pools, as far as they have room
+static void wakeSectorContents(GameState* state, int index) {
+    Sector* sector = &state->world.sectors[index];
+    
+    int slot = 0;
+    for (int i = 0; i < sector->asteroidCount; ) {
+        const DormantAsteroid* dormant = &sector->asteroids[i];
+        if (!isClearOfShip(state, dormant->position.x, dormant->position.y)) {
+            i++;
+            continue;
+        }
+        
+        while (slot < MAX_ASTEROIDS && state->asteroids[slot].base.active) slot++;
+        if (slot == MAX_ASTEROIDS) break;
+        
+        Asteroid* asteroid = &state->asteroids[slot];
+        asteroid->base = (GameObject){ dormant->position.x, dormant->position.y, dormant->velocity.x, dormant->velocity.y,
+                                       dormant->angle, 20.0f * dormant->size, false };
+        asteroid->size = dormant->size;
+        asteroid->meshId = dormant->meshId;
+        float radians = dormant->angle * PI / 180.0f;
+        asteroid->meshRotation = (Vector2){ cosf(radians), sinf(radians) };
+        spawnEntity(state, ENTITY_ASTEROID, slot);
+        
+        // Order within a sector doesn't matter, so fill the gap from the end
+        sector->asteroids[i] = sector->asteroids[--sector->asteroidCount];
+    }
+    
+    // Enemies come back at fresh spots in the sector, away from the ship
+    Rectangle bounds = getSectorBounds(&state->world, index);
+    while (sector->tanks + sector->scouts > 0) {
+        float x = sectorRandomRange(sector, bounds.x + TANK_ENEMY_RADIUS, bounds.x + bounds.width - TANK_ENEMY_RADIUS);
+        float y = sectorRandomRange(sector, bounds.y + TANK_ENEMY_RADIUS, bounds.y + bounds.height - TANK_ENEMY_RADIUS);
+        if (!isClearOfShip(state, x, y)) break;
+        
+        EnemyType type = sector->tanks > 0 ? ENEMY_TANK : ENEMY_SCOUT;
+        if (!spawnEnemyAt(state, type, x, y)) break;
+        if (type == ENEMY_TANK) {
+            sector->tanks--;
+        } else {
+            sector->scouts--;
+        }
+    }
+}
+
+// Coarse drift for a whole interval at once, bouncing inside the sector so contents never change hands
+static void updateDormantSector(World* world, int index) {
+    Sector* sector = &world->sectors[index];
+    Rectangle bounds = getSectorBounds(world, index);
+    
+    for (int i = 0; i < sector->asteroidCount; i++) {
+        DormantAsteroid* asteroid = &sector->asteroids[i];
+        float radius = 20.0f * asteroid->size;
+        asteroid->position.x += asteroid->velocity.x * SECTOR_DORMANT_INTERVAL;
+        asteroid->position.y += asteroid->velocity.y * SECTOR_DORMANT_INTERVAL;
+        
+        if (asteroid->position.x < bounds.x + radius || asteroid->position.x > bounds.x + bounds.width - radius) {
+            asteroid->velocity.x = -asteroid->velocity.x;
+            asteroid->position.x = fminf(fmaxf(asteroid->position.x, bounds.x + radius), bounds.x + bounds.width - radius);
+        }
+        if (asteroid->position.y < bounds.y + radius || asteroid->position.y > bounds.y + bounds.height - radius) {
+            asteroid->velocity.y = -asteroid->velocity.y;
+            asteroid->position.y = fminf(fmaxf(asteroid->position.y, bounds.y + radius), bounds.y + bounds.height - radius);
+        }
+    }
+}
+
+// Size the map for a new game and forget every sector
+void resetWorld(GameState* state) {
+    World* world = &state->world;
+    
+    if (world->size == WORLD_LARGE) {
+        world->width = LARGE_WORLD_WIDTH;
+        world->height = LARGE_WORLD_HEIGHT;
+        world->seed = (unsigned int)getGameRandomValue(state, 0, 0x7FFFFFFF);
+    } else {
+        world->width = MAP_WIDTH;
+        world->height = MAP_HEIGHT;
+        world->seed = 0;
+    }
+    world->columns = ((int)world->width + SECTOR_SIZE - 1) / SECTOR_SIZE;
+    world->rows = ((int)world->height + SECTOR_SIZE - 1) / SECTOR_SIZE;
+    
+    for (int i = 0; i < world->columns * world->rows; i++) {
+        Sector* sector = &world->sectors[i];
+        sector->status = SECTOR_UNGENERATED;
+        sector->random = getSectorSeed(world->seed, i);
+        sector->asteroidCount = 0;
+        sector->tanks = 0;
+        sector->scouts = 0;
+    }
+}
+
+// Stream sectors around the ship: wake the ones in range, put far ones to sleep and
+// give a share of the dormant ones their coarse update. Normal worlds run in full.
+void updateWorld(GameState* state) {
+    World* world = &state->world;
+    if (world->size != WORLD_LARGE) return;
+    
+    int shipSector = getSectorAt(world, state->ship.base.x, state->ship.base.y);
+    int sectorCount = world->columns * world->rows;
+    for (int i = 0; i < sectorCount; i++) {
+        Sector* sector = &world->sectors[i];
+        int range = getSectorRange(world, i, shipSector);
+        
+        if (range <= SECTOR_ACTIVE_RANGE && sector->status != SECTOR_ACTIVE) {
+            if (sector->status == SECTOR_UNGENERATED) generateSector(state, i);
+            sector->status = SECTOR_ACTIVE;
+        } else if (range > SECTOR_RELEASE_RANGE && sector->status == SECTOR_ACTIVE) {
+            sector->status = SECTOR_DORMANT;
+        }
+        
+        if (sector->status == SECTOR_ACTIVE) {
+            wakeSectorContents(state, i);
+        } else if (sector->status == SECTOR_DORMANT && (state->simTick + (unsigned int)i) % SECTOR_DORMANT_INTERVAL == 0) {
+            updateDormantSector(world, i);
+        }
+    }
+    
+    // Anything that left the active sectors goes to sleep where it is
+    for (int i = 0; i < MAX_ASTEROIDS; i++) {
+        Asteroid* asteroid = &state->asteroids[i];
+        if (!asteroid->base.active) continue;
+        
+        Sector* sector = &world->sectors[getSectorAt(world, asteroid->base.x, asteroid->base.y)];
+        if (sector->status != SECTOR_ACTIVE) sleepAsteroid(state, sector, i);
+    }
+    for (int i = 0; i < MAX_ENEMIES; i++) {
+        Enemy* enemy = &state->enemies[i];
+        if (!enemy->base.active) continue;
+        
+        Sector* sector = &world->sectors[getSectorAt(world, enemy->base.x, enemy->base.y)];
+        if (sector->status != SECTOR_ACTIVE) sleepEnemy(state, sector, i);
+    }
+}
+
+// Where waves may place new asteroids and enemies: the whole map, or the sectors around the ship
+Rectangle getSpawnArea(const GameState* state) {
+    const World* world = &state->world;
+    if (world->size != WORLD_LARGE) {
+        return (Rectangle){ 0.0f, 0.0f, world->width, world->height };
+    }
+    
+    int shipSector = getSectorAt(world, state->ship.base.x, state->ship.base.y);
+    float left = fmaxf(0.0f, (float)(shipSector % world->columns - SECTOR_ACTIVE_RANGE) * SECTOR_SIZE);
+    float top = fmaxf(0.0f, (float)(shipSector / world->columns - SECTOR_ACTIVE_RANGE) * SECTOR_SIZE);
+    float right = fminf(world->width, (float)(shipSector % world->columns + SECTOR_ACTIVE_RANGE + 1) * SECTOR_SIZE);
+    float bottom = fminf(world->height, (float)(shipSector / world->columns + SECTOR_ACTIVE_RANGE + 1) * SECTOR_SIZE);
+    return (Rectangle){ left, top, right - left, bottom - top };
+}
\ No newline at end of file
@@ -0,0 +1,278 @@
+#include <stdbool.h>
+#include <stdio.h>
+#include <stdlib.h>
+#include <string.h>
+
+// Custom headers
+#include "typedefs.h"
+#include "config.h"
+#include "telemetry.h"
+
+// Offline summarizer for telemetry_*.bin files written by the game.
+// Prints one CSV row per wave of every run given on the command line:
+//   telemetry_summary telemetry_20250101_120000.bin [more files...] > waves.csv
+
+#define MAX_SUMMARY_WAVES 256
+#define MAX_SUMMARY_BUCKETS 64
+#define ENEMY_TYPE_COUNT (ENEMY_SCOUT + 1)
+#define WEAPON_TYPE_COUNT (WEAPON_GRENADE + 1)
+#define POWERUP_TYPE_COUNT (POWERUP_LIFE + 1)
+
+static const char* enemyNames[ENEMY_TYPE_COUNT] = {
+    [ENEMY_TANK] = "tank",
+    [ENEMY_SCOUT] = "scout"
+};
+
+static const char* weaponNames[WEAPON_TYPE_COUNT] = {
+    [WEAPON_NORMAL] = "normal",
+    [WEAPON_SHOTGUN] = "shotgun",
+    [WEAPON_GRENADE] = "grenade"
+};
+
+static const char* damageNames[DAMAGE_SOURCE_COUNT] = {
+    [DAMAGE_ASTEROID] = "asteroid",
+    [DAMAGE_SCOUT_BULLET] = "scout_bullet",
+    [DAMAGE_TANK_GRENADE] = "tank_grenade",
+    [DAMAGE_GRENADE_BLAST] = "grenade_blast"
+};
+
+static const char* powerupNames[POWERUP_TYPE_COUNT] = {
+    [POWERUP_HEALTH] = "health",
+    [POWERUP_SHOTGUN] = "shotgun",
+    [POWERUP_GRENADE] = "grenade",
+    [POWERUP_LIFE] = "life"
+};
+
+static const char* poolNames[TELEMETRY_POOL_COUNT] = {
+    [TELEMETRY_POOL_BULLETS] = "bullets",
+    [TELEMETRY_POOL_ASTEROIDS] = "asteroids",
+    [TELEMETRY_POOL_ENEMIES] = "enemies",
+    [TELEMETRY_POOL_ENEMY_BULLETS] = "enemy_bullets",
+    [TELEMETRY_POOL_PARTICLES] = "particles",
+    [TELEMETRY_POOL_POWERUPS] = "powerups"
+};
+
+typedef struct {
+    bool seen;
+    bool ended;
+    bool cleared;
+    int durationTicks;
+    int kills[ENEMY_TYPE_COUNT];
+    int shots[WEAPON_TYPE_COUNT];
+    int projectiles[WEAPON_TYPE_COUNT];
+    int hits[WEAPON_TYPE_COUNT];
+    int damage[DAMAGE_SOURCE_COUNT];
+    int powerupsSpawned[POWERUP_TYPE_COUNT];
+    int powerupsCollected[POWERUP_TYPE_COUNT];
+    int poolPeaks[TELEMETRY_POOL_COUNT];
+    int frames[MAX_SUMMARY_BUCKETS];
+} WaveSummary;
+
+typedef struct {
+    int tickRate;
+    int bucketCount;
+    int bucketWidth;   // Microseconds
+    int finalScore;    // -1 if the run never ended (game closed mid-run)
+    WaveSummary waves[MAX_SUMMARY_WAVES];
+} RunSummary;
+
+static RunSummary run;
+
+static unsigned int readUint32(const unsigned char* in) {
+    return (unsigned int)in[0] | ((unsigned int)in[1] << 8) |
+           ((unsigned int)in[2] << 16) | ((unsigned int)in[3] << 24);
+}
+
+static void addEvent(const TelemetryEvent* event) {
+    if (event->wave >= MAX_SUMMARY_WAVES) return;
+    
+    WaveSummary* wave = &run.waves[event->wave];
+    int arg = event->arg;
+    wave->seen = true;
+    
+    switch (event->type) {
+        case TELEMETRY_RUN_END:
+            run.finalScore = event->value;
+            break;
+        case TELEMETRY_WAVE_END:
+            wave->ended = true;
+            wave->cleared = arg != 0;
+            wave->durationTicks = event->value;
+            break;
+        case TELEMETRY_KILL:
+            if (arg < ENEMY_TYPE_COUNT) wave->kills[arg]++;
+            break;
+        case TELEMETRY_SHOT:
+            if (arg < WEAPON_TYPE_COUNT) {
+                wave->shots[arg]++;
+                wave->projectiles[arg] += event->value;
+            }
+            break;
+        case TELEMETRY_HIT:
+            if (arg < WEAPON_TYPE_COUNT) wave->hits[arg]++;
+            break;
+        case TELEMETRY_DAMAGE:
+            if (arg < DAMAGE_SOURCE_COUNT) wave->damage[arg] += event->value;
+            break;
+        case TELEMETRY_POWERUP_SPAWN:
+            if (arg < POWERUP_TYPE_COUNT) wave->powerupsSpawned[arg]++;
+            break;
+        case TELEMETRY_POWERUP_COLLECT:
+            if (arg < POWERUP_TYPE_COUNT) wave->powerupsCollected[arg]++;
+            break;
+        case TELEMETRY_POOL_PEAK:
+            if (arg < TELEMETRY_POOL_COUNT && event->value > wave->poolPeaks[arg]) {
+                wave->poolPeaks[arg] = event->value;
+            }
+            break;
+        case TELEMETRY_FRAME_HISTOGRAM:
+            if (arg < run.bucketCount) wave->frames[arg] += event->value;
+            break;
+        default:
+            break;
+    }
+}
+
+static bool readRun(const char* path) {
+    FILE* file = fopen(path, "rb");
+    if (file == NULL) {
+        fprintf(stderr, "Error: Could not open %s\n", path);
+        return false;
+    }
+    
+    memset(&run, 0, sizeof(run));
+    run.finalScore = -1;
+    
+    unsigned char header[TELEMETRY_HEADER_SIZE];
+    if (fread(header, 1, sizeof(header), file) != sizeof(header) ||
+        readUint32(header) != TELEMETRY_FILE_MAGIC ||
+        readUint32(header + 4) != TELEMETRY_FILE_VERSION) {
+        fprintf(stderr, "Error: %s is not a version %d telemetry file\n", path, TELEMETRY_FILE_VERSION);
+        fclose(file);
+        return false;
+    }
+    run.tickRate = (int)readUint32(header + 8);
+    run.bucketCount = (int)readUint32(header + 12);
+    run.bucketWidth = (int)readUint32(header + 16);
+    if (run.tickRate <= 0) run.tickRate = SIM_TICK_RATE;
+    if (run.bucketCount > MAX_SUMMARY_BUCKETS) run.bucketCount = MAX_SUMMARY_BUCKETS;
+    
+    // A run cut short by a crash just ends at its last complete event
+    unsigned char record[TELEMETRY_EVENT_SIZE];
+    while (fread(record, 1, sizeof(record), file) == sizeof(record)) {
+        TelemetryEvent event;
+        event.type = record[0];
+        event.arg = record[1];
+        event.wave = (unsigned short)(record[2] | (record[3] << 8));
+        event.tick = readUint32(record + 4);
+        event.value = (int)readUint32(record + 8);
+        addEvent(&event);
+    }
+    
+    fclose(file);
+    return true;
+}
+
+// Upper edge of the bucket that holds the given fraction of frames, in milliseconds
+static float framePercentile(const WaveSummary* wave, int frameCount, float fraction) {
+    int target = (int)(frameCount * fraction + 0.5f);
+    int seen = 0;
+    for (int bucket = 0; bucket < run.bucketCount; bucket++) {
+        seen += wave->frames[bucket];
+        if (seen >= target) {
+            return (bucket + 1) * run.bucketWidth / 1000.0f;
+        }
+    }
+    return run.bucketCount * run.bucketWidth / 1000.0f;
+}
+
+static void printHeader(int bucketCount, int bucketWidth) {
+    printf("file,wave,cleared,duration_s,final_score");
+    for (int i = 0; i < ENEMY_TYPE_COUNT; i++) printf(",kills_%s", enemyNames[i]);
+    for (int i = 0; i < WEAPON_TYPE_COUNT; i++) {
+        printf(",shots_%s,projectiles_%s,hits_%s,hit_rate_%s", weaponNames[i], weaponNames[i], weaponNames[i], weaponNames[i]);
+    }
+    for (int i = 0; i < DAMAGE_SOURCE_COUNT; i++) printf(",damage_%s", damageNames[i]);
+    for (int i = 0; i < POWERUP_TYPE_COUNT; i++) printf(",spawned_%s,collected_%s", powerupNames[i], powerupNames[i]);
+    for (int i = 0; i < TELEMETRY_POOL_COUNT; i++) printf(",peak_%s", poolNames[i]);
+    printf(",frames,frame_p50_ms,frame_p95_ms,frame_p99_ms");
+    for (int i = 0; i < bucketCount; i++) {
+        if (i == bucketCount - 1) {
+            printf(",frames_%gms_up", i * bucketWidth / 1000.0);
+        } else {
+            printf(",frames_%gms", i * bucketWidth / 1000.0);
+        }
+    }
+    printf("\n");
+}
+
+static void printRun(const char* path) {
+    for (int w = 0; w < MAX_SUMMARY_WAVES; w++) {
+        const WaveSummary* wave = &run.waves[w];
+        if (!wave->seen) continue;
+        
+        printf("%s,%d,%d,", path, w, wave->cleared ? 1 : 0);
+        if (wave->ended) {
+            printf("%.2f", (float)wave->durationTicks / run.tickRate);
+        }
+        printf(",%d", run.finalScore);
+        
+        for (int i = 0; i < ENEMY_TYPE_COUNT; i++) printf(",%d", wave->kills[i]);
+        for (int i = 0; i < WEAPON_TYPE_COUNT; i++) {
+            printf(",%d,%d,%d,", wave->shots[i], wave->projectiles[i], wave->hits[i]);
+            if (wave->projectiles[i] > 0) {
+                printf("%.3f", (float)wave->hits[i] / wave->projectiles[i]);
+            }
+        }
+        for (int i = 0; i < DAMAGE_SOURCE_COUNT; i++) printf(",%d", wave->damage[i]);
+        for (int i = 0; i < POWERUP_TYPE_COUNT; i++) {
+            printf(",%d,%d", wave->powerupsSpawned[i], wave->powerupsCollected[i]);
+        }
+        for (int i = 0; i < TELEMETRY_POOL_COUNT; i++) printf(",%d", wave->poolPeaks[i]);
+        
+        int frameCount = 0;
+        for (int i = 0; i < run.bucketCount; i++) frameCount += wave->frames[i];
+        printf(",%d", frameCount);
+        if (frameCount > 0) {
+            printf(",%.1f,%.1f,%.1f", framePercentile(wave, frameCount, 0.50f),
+                   framePercentile(wave, frameCount, 0.95f), framePercentile(wave, frameCount, 0.99f));
+        } else {
+            printf(",,,");
+        }
+        for (int i = 0; i < run.bucketCount; i++) printf(",%d", wave->frames[i]);
+        printf("\n");
+    }
+}
+
+int main(int argc, char* argv[]) {
+    if (argc < 2) {
+        fprintf(stderr, "Usage: %s telemetry_file.bin [...]\n", argv[0]);
+        return 1;
+    }
+    
+    // Columns follow the first file; runs recorded with other histogram settings are skipped
+    int bucketCount = -1;
+    int bucketWidth = 0;
+    int failures = 0;
+    
+    for (int i = 1; i < argc; i++) {
+        if (!readRun(argv[i])) {
+            failures++;
+            continue;
+        }
+        
+        if (bucketCount < 0) {
+            bucketCount = run.bucketCount;
+            bucketWidth = run.bucketWidth;
+            printHeader(bucketCount, bucketWidth);
+        } else if (run.bucketCount != bucketCount || run.bucketWidth != bucketWidth) {
+            fprintf(stderr, "Warning: %s uses a different frame histogram, skipped\n", argv[i]);
+            failures++;
+            continue;
+        }
+        
+        printRun(argv[i]);
+    }
+    
+    return failures > 0 ? 1 : 0;
+}
\ No newline at end of file